@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+# This script assembles an effect program for the effect VM (src/effectVm).
+#
+# One instruction per line, a label is a name followed by ':' and a comment
+# starts with ';'. The registers are r0 to r7, an immediate is a decimal or
+# hexadecimal number and a jump target is a label or an instruction index.
+#
+#   loop:  fade  r3        ; fade the trail
+#          set   r2, r0    ; draw the head
+#          addi  r2, 1
+#          wait  0
+#          jmp   loop
+
+import argparse
+import re
+import sys
+
+REG_COUNT = 8
+
+# The opcodes and their operands, in the EffectVmOp_t order:
+# r is a register, i an immediate and j a jump target.
+OPCODES = {
+    "end": "",
+    "wait": "i",
+    "ldi": "ri",
+    "ldih": "ri",
+    "mov": "rr",
+    "add": "rrr",
+    "sub": "rrr",
+    "addi": "ri",
+    "mod": "rrr",
+    "cnt": "r",
+    "jmp": "j",
+    "jnz": "rj",
+    "fill": "r",
+    "set": "rr",
+    "get": "rr",
+    "fade": "r",
+    "shift": "r",
+    "wheel": "rr",
+    "blend": "rrr",
+}
+
+OPCODE_IDS = {name: idx for idx, name in enumerate(OPCODES)}
+
+
+class AsmError(Exception):
+    pass
+
+
+def parseLines(source):
+    labels = {}
+    instrs = []
+
+    for lineNo, line in enumerate(source.splitlines(), 1):
+        line = line.split(";", 1)[0].strip()
+        match = re.match(r"^([A-Za-z_]\w*):\s*(.*)$", line)
+        if match:
+            if match.group(1) in labels:
+                raise AsmError(f"line {lineNo}: duplicate label {match.group(1)}")
+            labels[match.group(1)] = len(instrs)
+            line = match.group(2)
+
+        if line:
+            parts = line.split(None, 1)
+            args = [a.strip() for a in parts[1].split(",")] if len(parts) > 1 else []
+            instrs.append((lineNo, parts[0].lower(), args))
+
+    return labels, instrs
+
+
+def parseReg(lineNo, arg):
+    match = re.match(r"^r([0-9]+)$", arg.lower())
+    if not match or int(match.group(1)) >= REG_COUNT:
+        raise AsmError(f"line {lineNo}: invalid register {arg}")
+
+    return int(match.group(1))
+
+
+def parseImm(lineNo, arg, labels, isJump):
+    if isJump and arg in labels:
+        return labels[arg]
+
+    try:
+        value = int(arg, 0)
+    except ValueError:
+        raise AsmError(f"line {lineNo}: invalid operand {arg}")
+
+    if not -0x8000 <= value <= 0xffff:
+        raise AsmError(f"line {lineNo}: immediate {arg} out of 16 bits")
+
+    return value & 0xffff
+
+
+def assemble(source):
+    labels, instrs = parseLines(source)
+    code = bytearray()
+
+    for lineNo, name, args in instrs:
+        if name not in OPCODES:
+            raise AsmError(f"line {lineNo}: unknown instruction {name}")
+
+        kinds = OPCODES[name]
+        if len(args) != len(kinds):
+            raise AsmError(f"line {lineNo}: {name} takes {len(kinds)} operands")
+
+        operands = [0, 0, 0]
+        regIdx = 0
+        for kind, arg in zip(kinds, args):
+            if kind == "r":
+                operands[regIdx] = parseReg(lineNo, arg)
+                regIdx += 1
+            else:
+                imm = parseImm(lineNo, arg, labels, kind == "j")
+                if kind == "j" and imm >= len(instrs):
+                    raise AsmError(f"line {lineNo}: jump target {arg} out of the program")
+                operands[1] = imm & 0xff
+                operands[2] = imm >> 8
+
+        code += bytes([OPCODE_IDS[name]] + operands)
+
+    return bytes(code)
+
+
+def toCArray(code, name):
+    lines = [f"static const uint8_t {name}[] = {{"]
+    for i in range(0, len(code), 4):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in code[i:i + 4]) + ",")
+    lines.append("};")
+
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Assemble an effect program.")
+    parser.add_argument("source", help="the program source file")
+    parser.add_argument("-o", "--output", help="the output file, stdout by default")
+    parser.add_argument("-c", "--c-array", metavar="NAME",
+                        help="output a C array with this name instead of the binary")
+    args = parser.parse_args()
+
+    with open(args.source) as source:
+        try:
+            code = assemble(source.read())
+        except AsmError as err:
+            sys.exit(f"{args.source}: {err}")
+
+    output = toCArray(code, args.c_array).encode() if args.c_array else code
+    if args.output:
+        with open(args.output, "wb") as out:
+            out.write(output)
+    else:
+        sys.stdout.buffer.write(output)
+
+
+if __name__ == "__main__":
+    main()
@@ -16,60 +16,270 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
+#include <string.h>
+
 #include "appMsg.h"
+#include "appMsgRing.h"
 #include "zephyrCommon.h"
-#include "zephyrMsgQueue.h"
 
 #define APP_MSG_MODULE_NAME app_msg_module
 
 /* Setting module logging */
 LOG_MODULE_REGISTER(APP_MSG_MODULE_NAME);
 
+#ifdef CONFIG_APP_MSG_LED_SEQ_RING
+BUILD_ASSERT((CONFIG_APP_MSG_LED_SEQ_RING_DEPTH &
+  (CONFIG_APP_MSG_LED_SEQ_RING_DEPTH - 1)) == 0,
+  "the LED sequence ring depth must be a power of 2");
+BUILD_ASSERT(CONFIG_APP_MSG_LED_SEQ_RING_DEPTH >= APP_MSG_LED_SECTION_COUNT,
+  "the LED sequence ring must hold a transaction of every section");
+
+/**
+ * @brief The LED sequence ring buffer.
+*/
+static LedSequence_t ledSeqBuffer[CONFIG_APP_MSG_LED_SEQ_RING_DEPTH];
+
 /**
- * @brief The maximum LED management message count.
+ * @brief The LED sequence ring, the sequences are popped in push order.
 */
-#define MAX_LED_MNGMT_MSG_COUNT             5
+static AppMsgRing_t ledSeqRing;
+#else
+BUILD_ASSERT(APP_MSG_LED_SECTION_COUNT <= 32,
+  "the LED sequence mailbox supports up to 32 sections");
 
 /**
- * @brief The queue IDs.
+ * @brief The LED sequence mailbox. Each section holds its latest pushed
+ *        sequence, a newer push replaces the pending one.
 */
-enum
+typedef struct
 {
-  LED_MNGMT_QUEUE = 0,                  /**< The LED management queue ID. */
-  MSG_QUEUE_COUNT,
-};
+  LedSequence_t slots[APP_MSG_LED_SECTION_COUNT];  /**< The section slots. */
+  uint32_t pending;                     /**< The pending slot mask. */
+  uint32_t coalescedCount;              /**< The replaced pending sequence count. */
+} LedSeqMailbox_t;
 
 /**
- * @brief The message queues.
+ * @brief The LED sequence mailbox.
 */
-ZephyrMsgQueue_t queues[MSG_QUEUE_COUNT];
+static LedSeqMailbox_t ledSeqMailbox;
+#endif
+
+/**
+ * @brief The LED sequence signal, raised on each pushed LED sequence.
+*/
+static struct k_poll_signal ledSeqSignal =
+  K_POLL_SIGNAL_INITIALIZER(ledSeqSignal);
 
 int appMsgInit(void)
 {
-  int rc = 0;
-  size_t msgSizes[MSG_QUEUE_COUNT] = {sizeof(LedSequence_t)};
-  size_t maxDepths[MSG_QUEUE_COUNT] = {MAX_LED_MNGMT_MSG_COUNT};
+#ifdef CONFIG_APP_MSG_LED_SEQ_RING
+  return appMsgRingInit(&ledSeqRing, ledSeqBuffer, sizeof(*ledSeqBuffer),
+    CONFIG_APP_MSG_LED_SEQ_RING_DEPTH);
+#else
+  unsigned int key = irq_lock();
+
+  memset(&ledSeqMailbox, 0x00, sizeof(ledSeqMailbox));
+
+  irq_unlock(key);
+
+  return 0;
+#endif
+}
+
+/**
+ * @brief   Check a LED management message.
+ *
+ * @param msg     The message.
+ *
+ * @return  0 if the message is valid, the error code otherwise.
+ */
+static int checkLedSequence(LedSequence_t *msg)
+{
+  if(msg->version != APP_MSG_LED_SEQ_VERSION)
+  {
+    LOG_ERR("unsupported message version: %d", msg->version);
+    return -EPROTONOSUPPORT;
+  }
 
-  for(uint8_t i = 0; i < MSG_QUEUE_COUNT && rc == 0; ++i)
+  if(msg->sectionId >= APP_MSG_LED_SECTION_COUNT)
   {
-    rc = zephyrMsgQueueInit(queues + i, msgSizes[i], maxDepths[i]);
-    if(rc < 0)
-      LOG_ERR("unable to initilize the message queue ID: %d", i);
+    LOG_ERR("invalid section ID: %d", msg->sectionId);
+    return -EINVAL;
   }
 
-  return rc;
+  if(msg->seqType >= SEQ_COUNT)
+  {
+    LOG_ERR("invalid sequence type: %d", msg->seqType);
+    return -EINVAL;
+  }
+
+#ifndef CONFIG_LED_MNGR_EFFECT_VM
+  if(msg->seqType == SEQ_PROGRAM)
+  {
+    LOG_ERR("effect program sequences are disabled");
+    return -EINVAL;
+  }
+#endif
+
+  if(msg->timeUnit != MICRO_SEC && msg->timeUnit != MILLI_SEC &&
+    msg->timeUnit != SECONDS)
+  {
+    LOG_ERR("invalid time unit: %d", msg->timeUnit);
+    return -EINVAL;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief   Push checked LED management messages in a single operation and
+ *          raise the LED sequence signal once.
+ *
+ * @param msgs    The messages.
+ * @param count   The message count.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int pushLedSequences(LedSequence_t *msgs, uint8_t count)
+{
+#ifdef CONFIG_APP_MSG_LED_SEQ_RING
+  int rc;
+
+  rc = appMsgRingPushBatch(&ledSeqRing, msgs, count);
+  if(rc < 0)
+    return rc;
+#else
+  unsigned int key;
+  uint32_t slotMask;
+
+  key = irq_lock();
+
+  for(uint8_t i = 0; i < count; ++i)
+  {
+    slotMask = BIT(msgs[i].sectionId);
+    if(ledSeqMailbox.pending & slotMask)
+      ++ledSeqMailbox.coalescedCount;
+    ledSeqMailbox.slots[msgs[i].sectionId] = msgs[i];
+    ledSeqMailbox.pending |= slotMask;
+  }
+
+  irq_unlock(key);
+#endif
+
+  k_poll_signal_raise(&ledSeqSignal, 0);
+
+  return 0;
 }
 
 int appMsgPushLedSequence(LedSequence_t *msg)
 {
-  return zephyrMsgQueuePush(queues + LED_MNGMT_QUEUE, (void*)msg,
-    ZEPHYR_TIME_FOREVER, MILLI_SEC);
+  int rc;
+
+  rc = checkLedSequence(msg);
+  if(rc < 0)
+    return rc;
+
+  return pushLedSequences(msg, 1);
+}
+
+void appMsgBeginLedTransaction(LedTransaction_t *trans)
+{
+  trans->count = 0;
+}
+
+int appMsgStageLedSequence(LedTransaction_t *trans, LedSequence_t *msg)
+{
+  uint8_t i;
+  int rc;
+
+  rc = checkLedSequence(msg);
+  if(rc < 0)
+    return rc;
+
+  for(i = 0; i < trans->count; ++i)
+  {
+    if(trans->sequences[i].sectionId == msg->sectionId)
+      break;
+  }
+
+  trans->sequences[i] = *msg;
+  if(i == trans->count)
+    ++trans->count;
+
+  return 0;
+}
+
+int appMsgCommitLedTransaction(LedTransaction_t *trans)
+{
+  int rc;
+
+  if(trans->count == 0)
+    return 0;
+
+  rc = pushLedSequences(trans->sequences, trans->count);
+  if(rc < 0)
+    return rc;
+
+  trans->count = 0;
+
+  return 0;
+}
+
+int appMsgWaitLedSequence(k_timeout_t timeout)
+{
+  int rc;
+  struct k_poll_event event;
+
+  k_poll_event_init(&event, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+    &ledSeqSignal);
+
+  rc = k_poll(&event, 1, timeout);
+  if(rc < 0)
+    return rc;
+
+  k_poll_signal_reset(&ledSeqSignal);
+
+  return 0;
+}
+
+void appMsgNotifyLedManager(void)
+{
+  k_poll_signal_raise(&ledSeqSignal, 0);
 }
 
 int appMsgPopLedSequence(LedSequence_t *msg)
 {
-  return zephyrMsgQueuePop(queues + LED_MNGMT_QUEUE, (void*)msg,
-    ZEPHYR_TIME_NO_WAIT, MILLI_SEC);
+#ifdef CONFIG_APP_MSG_LED_SEQ_RING
+  return appMsgRingPop(&ledSeqRing, msg);
+#else
+  unsigned int key;
+  uint8_t sectionId;
+
+  key = irq_lock();
+
+  if(ledSeqMailbox.pending == 0)
+  {
+    irq_unlock(key);
+    return -ENOMSG;
+  }
+
+  sectionId = find_lsb_set(ledSeqMailbox.pending) - 1;
+  *msg = ledSeqMailbox.slots[sectionId];
+  ledSeqMailbox.pending &= ~BIT(sectionId);
+
+  irq_unlock(key);
+
+  return 0;
+#endif
+}
+
+uint32_t appMsgGetCoalescedCount(void)
+{
+#ifdef CONFIG_APP_MSG_LED_SEQ_RING
+  return 0;
+#else
+  return ledSeqMailbox.coalescedCount;
+#endif
 }
 
 /** @} */
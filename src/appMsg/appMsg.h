@@ -16,9 +16,31 @@
 #ifndef APP_MESSAGES
 #define APP_MESSAGES
 
+#include <zephyr/kernel.h>
+#ifndef CONFIG_ZTEST
+#include <zephyr/devicetree.h>
+#endif
+
 #include "zephyrCommon.h"
 #include "zephyrLedStrip.h"
 
+#ifndef CONFIG_ZTEST
+/**
+ * @brief   Count a LED strip section.
+ *
+ * @param node    The section node.
+*/
+#define APP_MSG_COUNT_SECTION(node)                 + 1
+
+/**
+ * @brief The LED strip section count.
+*/
+#define APP_MSG_LED_SECTION_COUNT                                             \
+  (0 DT_FOREACH_CHILD(DT_ALIAS(led_strip), APP_MSG_COUNT_SECTION))
+#else
+#define APP_MSG_LED_SECTION_COUNT                   2
+#endif
+
 /**
  * @brief The sequence type.
 */
@@ -31,6 +53,7 @@ typedef enum
   SEQ_COLOR_RANGE,                      /**< The color range sequence. */
   SEQ_RANGE_CHASER,                     /**< The color range chaser sequence. */
   SEQ_INVERT_RANGE_CHASER,              /**< The inverted color range chaser sequence.*/
+  SEQ_PROGRAM,                          /**< The effect program sequence. */
   SEQ_COUNT,                            /**< The sequence type count. */
 } SequenceType_t;
 
@@ -50,27 +73,117 @@ typedef union
 } Color_t;
 
 /**
- * @brief The LED management message.
+ * @brief The LED management message layout version.
+*/
+#define APP_MSG_LED_SEQ_VERSION             1
+
+/**
+ * @brief The LED management message time base of a sequence without cycle.
+*/
+#define APP_MSG_TIME_FOREVER                UINT16_MAX
+
+/**
+ * @brief The 24 bits message color.
+*/
+typedef struct
+{
+  uint8_t b;                            /**< The blue value. */
+  uint8_t g;                            /**< The green value. */
+  uint8_t r;                            /**< The red value. */
+} PackedColor_t;
+
+/**
+ * @brief The LED management message. Its fields are ordered so it has no
+ *        padding, it is also the binary wire layout (little-endian).
 */
 typedef struct
 {
-  SequenceType_t seqType;               /**< The sequence type. */
-  uint32_t timeBase;                    /**< The sequence time base. */
-  ZephyrTimeUnit_t timeUnit;            /**< The sequence time unit. */
-  Color_t startColor;                   /**< The solid color or the range start color. */
-  Color_t endColor;                     /**< The range end color. */
+  uint8_t version;                      /**< The layout version (APP_MSG_LED_SEQ_VERSION). */
+  uint8_t seqType;                      /**< The sequence type (SequenceType_t). */
   uint8_t sectionId;                    /**< The section ID to apply the sequence to. */
+  uint8_t timeUnit;                     /**< The sequence time unit (ZephyrTimeUnit_t). */
+  uint16_t timeBase;                    /**< The sequence time base, APP_MSG_TIME_FOREVER for none. */
+  PackedColor_t startColor;             /**< The solid color or the range start color. */
+  PackedColor_t endColor;               /**< The range end color. */
 } LedSequence_t;
 
+BUILD_ASSERT(SEQ_COUNT <= UINT8_MAX, "the sequence type must fit in 8 bits");
+BUILD_ASSERT(sizeof(PackedColor_t) == 3, "the message color must be 24 bits");
+BUILD_ASSERT(offsetof(LedSequence_t, timeBase) == 4,
+  "the message time base must be 16 bits aligned");
+BUILD_ASSERT(offsetof(LedSequence_t, startColor) == 6 &&
+  offsetof(LedSequence_t, endColor) == 9,
+  "the message colors must follow the time base");
+BUILD_ASSERT(sizeof(LedSequence_t) == 12,
+  "the LED management message must be 12 bytes");
+
+/**
+ * @brief The LED sequence transaction. It stages the sequences of several
+ *        sections, they are committed at once so the LED manager applies
+ *        them on the same frame.
+*/
+typedef struct
+{
+  LedSequence_t sequences[APP_MSG_LED_SECTION_COUNT];  /**< The staged sequences. */
+  uint8_t count;                        /**< The staged sequence count. */
+} LedTransaction_t;
+
+/**
+ * @brief   Pack a color into a message color.
+ *
+ * @param color   The color.
+ * @param packed  The output message color.
+ */
+static inline void appMsgPackColor(const Color_t *color, PackedColor_t *packed)
+{
+  packed->b = color->b;
+  packed->g = color->g;
+  packed->r = color->r;
+}
+
 /**
- * @brief   Intialize the message queues.
+ * @brief   Unpack a message color.
+ *
+ * @param packed  The message color.
+ * @param color   The output color.
+ */
+static inline void appMsgUnpackColor(const PackedColor_t *packed,
+  Color_t *color)
+{
+  color->hexColor = (uint32_t)packed->r << 16 | (uint32_t)packed->g << 8 |
+    packed->b;
+}
+
+/**
+ * @brief   Get the message time base, in the Zephyr wrapper convention.
+ *
+ * @param msg     The message.
  *
- * @return  o if successful, the error code otherwise.
+ * @return  The time base, ZEPHYR_TIME_FOREVER for a sequence without cycle.
+ */
+static inline uint32_t appMsgGetTimeBase(const LedSequence_t *msg)
+{
+  return msg->timeBase == APP_MSG_TIME_FOREVER ? ZEPHYR_TIME_FOREVER :
+    msg->timeBase;
+}
+
+/**
+ * @brief   Intialize the messages. The LED sequences go through a per-section
+ *          mailbox, only the latest pushed sequence of a section is kept, or
+ *          through a ring keeping every sequence in push order when
+ *          CONFIG_APP_MSG_LED_SEQ_RING is enabled.
+ *
+ * @return  0 if successful, the error code otherwise.
  */
 int appMsgInit(void);
 
 /**
- * @brief   Push a LED management message in the queue.
+ * @brief   Push a LED management message in its section mailbox slot. The
+ *          push never blocks, a pending message of the same section is
+ *          replaced and counted as coalesced. With the ring, the push fails
+ *          with -ENOSPC when the ring is full, and it must only be called
+ *          from a single producer thread. A message of another layout
+ *          version is rejected.
  *
  * @param msg     The input buffer of the message.
  *
@@ -79,14 +192,72 @@ int appMsgInit(void);
 int appMsgPushLedSequence(LedSequence_t *msg);
 
 /**
- * @brief   Pop a LED management message from the queue.
+ * @brief   Begin a LED sequence transaction, dropping its staged sequences.
  *
- * @param msg     The output buffer of the message.
+ * @param trans   The transaction.
+ */
+void appMsgBeginLedTransaction(LedTransaction_t *trans);
+
+/**
+ * @brief   Stage a LED management message in a transaction. A staged message
+ *          of the same section is replaced. A message of another layout
+ *          version or of an invalid section is rejected.
+ *
+ * @param trans   The transaction.
+ * @param msg     The message to stage.
  *
  * @return  0 if successful, the error code otherwise.
  */
+int appMsgStageLedSequence(LedTransaction_t *trans, LedSequence_t *msg);
+
+/**
+ * @brief   Commit a LED sequence transaction. Its staged messages are pushed
+ *          in a single operation, so the LED manager pops all of them or none.
+ *          With the ring, the commit fails with -ENOSPC when the ring cannot
+ *          hold every staged message, and the transaction is kept. The
+ *          transaction is emptied once committed.
+ *
+ * @param trans   The transaction.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+int appMsgCommitLedTransaction(LedTransaction_t *trans);
+
+/**
+ * @brief   Wait for a LED management message to be pushed. The wake-up is
+ *          consumed, so the messages must then be popped until the mailbox
+ *          is empty.
+ *
+ * @param timeout The wait timeout, it can be an absolute deadline.
+ *
+ * @return  0 if a message was pushed or the LED manager was notified, -EAGAIN
+ *          on timeout, the error code otherwise.
+ */
+int appMsgWaitLedSequence(k_timeout_t timeout);
+
+/**
+ * @brief   Wake the LED manager up without message, so it applies a change
+ *          of its rendering mode.
+ */
+void appMsgNotifyLedManager(void);
+
+/**
+ * @brief   Pop a pending LED management message, without blocking.
+ *
+ * @param msg     The output buffer of the message.
+ *
+ * @return  0 if successful, -ENOMSG if no message is pending.
+ */
 int appMsgPopLedSequence(LedSequence_t *msg);
 
+/**
+ * @brief   Get the count of pending LED management messages replaced by a
+ *          newer message of the same section.
+ *
+ * @return  The coalesced message count.
+ */
+uint32_t appMsgGetCoalescedCount(void);
+
 #endif    /* APP_MESSAGES */
 
 /** @} */
@@ -0,0 +1,85 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      appMsgRing.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Application Messages Ring Module
+ *
+ *            This file is the implementation of the application messages
+ *            single-producer single-consumer ring.
+ *
+ * @ingroup  appMsg
+ *
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+
+#include <string.h>
+
+#include "appMsgRing.h"
+
+int appMsgRingInit(AppMsgRing_t *ring, void *buffer, size_t msgSize,
+  uint32_t depth)
+{
+  if(depth == 0 || (depth & (depth - 1)) != 0)
+    return -EINVAL;
+
+  ring->buffer = buffer;
+  ring->msgSize = msgSize;
+  ring->mask = depth - 1;
+  ring->head = 0;
+  ring->tail = 0;
+
+  return 0;
+}
+
+int appMsgRingPush(AppMsgRing_t *ring, const void *msg)
+{
+  return appMsgRingPushBatch(ring, msg, 1);
+}
+
+int appMsgRingPushBatch(AppMsgRing_t *ring, const void *msgs, uint32_t count)
+{
+  const uint8_t *msg = msgs;
+  uint32_t head = ring->head;
+
+  if(count > ring->mask + 1 - (head - ring->tail))
+    return -ENOSPC;
+
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    memcpy(ring->buffer + ((head + i) & ring->mask) * ring->msgSize, msg,
+      ring->msgSize);
+    msg += ring->msgSize;
+  }
+
+  /* The messages must be written before they are published. */
+  barrier_dmem_fence_full();
+  ring->head = head + count;
+
+  return 0;
+}
+
+int appMsgRingPop(AppMsgRing_t *ring, void *msg)
+{
+  uint32_t tail = ring->tail;
+
+  if(ring->head == tail)
+    return -ENOMSG;
+
+  /* The message must be read after its publication is seen. */
+  barrier_dmem_fence_full();
+  memcpy(msg, ring->buffer + (tail & ring->mask) * ring->msgSize,
+    ring->msgSize);
+
+  /* The message must be read before its slot is released. */
+  barrier_dmem_fence_full();
+  ring->tail = tail + 1;
+
+  return 0;
+}
+
+/** @} */
@@ -0,0 +1,87 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      appMsgRing.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Application Messages Ring Module
+ *
+ *            This file is the declaration of the application messages
+ *            single-producer single-consumer ring.
+ *
+ * @ingroup  appMsg
+ *
+ * @{
+ */
+
+#ifndef APP_MESSAGES_RING
+#define APP_MESSAGES_RING
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The single-producer single-consumer message ring. The head is only
+ *        written by the producer and the tail only by the consumer, so the
+ *        ring needs no lock, the 32 bits loads and stores being atomic.
+*/
+typedef struct
+{
+  uint8_t *buffer;                      /**< The message buffer. */
+  size_t msgSize;                       /**< The message size. */
+  uint32_t mask;                        /**< The depth mask. */
+  volatile uint32_t head;               /**< The free-running push count. */
+  volatile uint32_t tail;               /**< The free-running pop count. */
+} AppMsgRing_t;
+
+/**
+ * @brief   Initialize a message ring.
+ *
+ * @param ring        The ring.
+ * @param buffer      The message buffer, depth * msgSize bytes.
+ * @param msgSize     The message size.
+ * @param depth       The ring depth, a power of 2.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+int appMsgRingInit(AppMsgRing_t *ring, void *buffer, size_t msgSize,
+  uint32_t depth);
+
+/**
+ * @brief   Push a message in the ring, from the producer only. The push
+ *          never blocks.
+ *
+ * @param ring        The ring.
+ * @param msg         The message to push.
+ *
+ * @return  0 if successful, -ENOSPC if the ring is full.
+ */
+int appMsgRingPush(AppMsgRing_t *ring, const void *msg);
+
+/**
+ * @brief   Push messages in the ring at once, from the producer only. They
+ *          are published together, so the consumer pops all of them or none.
+ *          The push never blocks.
+ *
+ * @param ring        The ring.
+ * @param msgs        The messages to push.
+ * @param count       The message count.
+ *
+ * @return  0 if successful, -ENOSPC if the ring cannot hold every message.
+ */
+int appMsgRingPushBatch(AppMsgRing_t *ring, const void *msgs, uint32_t count);
+
+/**
+ * @brief   Pop a message from the ring, from the consumer only. The pop
+ *          never blocks.
+ *
+ * @param ring        The ring.
+ * @param msg         The output buffer of the message.
+ *
+ * @return  0 if successful, -ENOMSG if the ring is empty.
+ */
+int appMsgRingPop(AppMsgRing_t *ring, void *msg);
+
+#endif    /* APP_MESSAGES_RING */
+
+/** @} */
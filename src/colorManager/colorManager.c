@@ -14,6 +14,9 @@
  */
 
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
 
 #include "colorManager.h"
 #include "zephyrLedStrip.h"
@@ -23,39 +26,106 @@
 /* Setting module logging */
 LOG_MODULE_REGISTER(COLOR_MNGR_MODULE_NAME);
 
+/**
+ * @brief The color component to wheel ratio multiplier. Used with
+ *        COLOR_RATIO_SHIFT, it gives the same result as (x / 255) * 84 for
+ *        every 8-bit component without pulling in the soft-float library.
+*/
+#define COLOR_RATIO_MULT                      2699
+
+/**
+ * @brief The color component to wheel ratio shift.
+*/
+#define COLOR_RATIO_SHIFT                     13
+
+/**
+ * @brief   Convert a color component to its position inside a color wheel
+ *          section.
+ *
+ * @param x   The color component.
+*/
+#define COLOR_RATIO_TO_WHEEL(x)               \
+  (((uint32_t)(x) * COLOR_RATIO_MULT) >> COLOR_RATIO_SHIFT)
+
+#ifdef CONFIG_COLOR_MNGR_SWAR_FADE
+/**
+ * @brief The word with 1 in each channel, to spread a level over a word.
+*/
+#define COLOR_BYTE_LANES                      0x01010101UL
+
+/**
+ * @brief The channel low 7 bits of a word.
+*/
+#define COLOR_LOW7_MASK                       0x7f7f7f7fUL
+
+/**
+ * @brief The channel most significant bit of a word.
+*/
+#define COLOR_MSB_MASK                        0x80808080UL
+#endif
+
+#ifdef CONFIG_COLOR_MNGR_WHEEL_LUT
+/**
+ * @brief   Generate the color wheel table entry of a wheel position.
+ *
+ * @param pos   The color wheel position.
+*/
+#define COLOR_WHEEL_ENTRY(pos, ...)           \
+  {                                           \
+    .r = COLOR_WHEEL_RED(pos),                \
+    .g = COLOR_WHEEL_GRN(pos),                \
+    .b = COLOR_WHEEL_BLU(pos),                \
+  }
+
+/**
+ * @brief The color wheel table, generated at compile time and kept in flash.
+*/
+static const ZephyrRgbPixel_t colorWheel[COLOR_WHEEL_SIZE] = {
+  LISTIFY(COLOR_WHEEL_SIZE, COLOR_WHEEL_ENTRY, (,))
+};
+#endif
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+/**
+ * @brief   Generate the gamma table entry of a linear channel level. The
+ *          power of constants is folded by the compiler.
+ *
+ * @param level The linear channel level.
+*/
+#define COLOR_GAMMA_ENTRY(level, ...)                                         \
+  (uint8_t)(__builtin_pow((level) / 255.0,                                    \
+    CONFIG_LED_MNGR_GAMMA_X10 / 10.0) * 255.0 + 0.5)
+
+/**
+ * @brief The output gamma table, generated at compile time and kept in
+ *        flash.
+*/
+static const uint8_t gammaLut[COLOR_GAMMA_SIZE] = {
+  LISTIFY(COLOR_GAMMA_SIZE, COLOR_GAMMA_ENTRY, (,))
+};
+#endif
+
 /**
  * @brief   Calcultate the new color based on the color wheel position.
  *
  * @param wheelPos  The color wheel position.
- * @param red       The calculated red value.
- * @param green     The calculated green value.
- * @param blue      The calculated blue value.
+ * @param pixel     The calculated pixel color.
  */
-static void calculateNewColor(uint8_t wheelPos, uint8_t *red,
-                              uint8_t *green, uint8_t *blue)
+static inline void calculateNewColor(uint8_t wheelPos, ZephyrRgbPixel_t *pixel)
 {
-  if(wheelPos < COLOR_WHEEL_BLU_TO_GRN)
-  {
-    *red = 255 - wheelPos * 3;
-    *blue = wheelPos * 3;
-  }
-  else if(wheelPos >= COLOR_WHEEL_BLU_TO_GRN &&
-    wheelPos < COLOR_WHEEL_GRN_TO_RED)
-  {
-    *blue = 255 - (wheelPos - COLOR_WHEEL_BLU_TO_GRN) * 3;
-    *green = (wheelPos - COLOR_WHEEL_BLU_TO_GRN) * 3;
-  }
-  else
-  {
-    *green = 255 - (wheelPos - COLOR_WHEEL_GRN_TO_RED) * 3;
-    *red = (wheelPos - COLOR_WHEEL_GRN_TO_RED) * 3;
-  }
+#ifdef CONFIG_COLOR_MNGR_WHEEL_LUT
+  *pixel = colorWheel[wheelPos];
+#else
+  pixel->r = COLOR_WHEEL_RED(wheelPos);
+  pixel->g = COLOR_WHEEL_GRN(wheelPos);
+  pixel->b = COLOR_WHEEL_BLU(wheelPos);
+#endif
 }
 
 void colorMngrSetSingle(Color_t *color, ZephyrRgbPixel_t *pixels,
                         size_t pixelCnt)
 {
-  for(uint8_t i = 0; i < pixelCnt; i++)
+  for(size_t i = 0; i < pixelCnt; ++i)
   {
     pixels[i].r = color->r;
     pixels[i].g = color->g;
@@ -63,10 +133,103 @@ void colorMngrSetSingle(Color_t *color, ZephyrRgbPixel_t *pixels,
   }
 }
 
+#ifdef CONFIG_COLOR_MNGR_SWAR_FADE
+/**
+ * @brief   Subtract a level from each channel of a word, saturated to 0. The
+ *          channel low 7 bits are subtracted with their most significant bit
+ *          set, so no borrow crosses a channel, then the borrow out of each
+ *          channel clears it.
+ *
+ * @param word        The word.
+ * @param levels      The level of each channel.
+ *
+ * @return  The faded word.
+ */
+static inline uint32_t fadeWord(uint32_t word, uint32_t levels)
+{
+  uint32_t diff;
+  uint32_t borrow;
+
+  diff = ((word | COLOR_MSB_MASK) - (levels & COLOR_LOW7_MASK)) ^
+    (~(word ^ levels) & COLOR_MSB_MASK);
+  borrow = ((~word & levels) | (~(word ^ levels) & diff)) & COLOR_MSB_MASK;
+
+  return diff & ~((borrow << 1) - (borrow >> 7));
+}
+
+/**
+ * @brief   Add a level to each channel of a word, saturated to 255. The
+ *          channel low 7 bits are added, so no carry crosses a channel, then
+ *          the carry out of each channel sets it.
+ *
+ * @param word        The word.
+ * @param levels      The level of each channel.
+ *
+ * @return  The unfaded word.
+ */
+static inline uint32_t unfadeWord(uint32_t word, uint32_t levels)
+{
+  uint32_t sum;
+  uint32_t carry;
+
+  sum = (word & COLOR_LOW7_MASK) + (levels & COLOR_LOW7_MASK);
+  carry = ((word & levels) | ((word | levels) & sum)) & COLOR_MSB_MASK;
+  sum ^= (word ^ levels) & COLOR_MSB_MASK;
+
+  return sum | ((carry << 1) - (carry >> 7));
+}
+
+/**
+ * @brief   Apply a word kernel to the pixel channels, a word (4 channels) at
+ *          a time. The last partial word is loaded with 0 channels.
+ *
+ * @param kernel      The word kernel.
+ * @param level       The level of every channel.
+ * @param pixels      The pixel buffer.
+ * @param pixelCnt    The count of pixel to manage.
+ */
+static inline void applyWordKernel(uint32_t (*kernel)(uint32_t, uint32_t),
+                                   uint8_t level, ZephyrRgbPixel_t *pixels,
+                                   size_t pixelCnt)
+{
+  uint8_t *bytes = (uint8_t *)pixels;
+  size_t len = pixelCnt * sizeof(*pixels);
+  uint32_t levels = level * COLOR_BYTE_LANES;
+  uint32_t word;
+  size_t i;
+
+  for(i = 0; i + sizeof(word) <= len; i += sizeof(word))
+  {
+    memcpy(&word, bytes + i, sizeof(word));
+    word = kernel(word, levels);
+    memcpy(bytes + i, &word, sizeof(word));
+  }
+
+  if(i < len)
+  {
+    word = 0;
+    memcpy(&word, bytes + i, len - i);
+    word = kernel(word, levels);
+    memcpy(bytes + i, &word, len - i);
+  }
+}
+
+void colorMngrApplyFade(uint8_t fadeLvl, ZephyrRgbPixel_t *pixels,
+                        size_t pixelCnt)
+{
+  applyWordKernel(fadeWord, fadeLvl, pixels, pixelCnt);
+}
+
+void colorMngrApplyUnfade(uint8_t unfadeLvl, ZephyrRgbPixel_t *pixels,
+                          size_t pixelCnt)
+{
+  applyWordKernel(unfadeWord, unfadeLvl, pixels, pixelCnt);
+}
+#else
 void colorMngrApplyFade(uint8_t fadeLvl, ZephyrRgbPixel_t *pixels,
                         size_t pixelCnt)
 {
-  for(uint8_t i = 0; i < pixelCnt; ++i)
+  for(size_t i = 0; i < pixelCnt; ++i)
   {
     pixels[i].r = (int32_t)(pixels[i].r - fadeLvl) <= 0 ? 0 :
       pixels[i].r - fadeLvl;
@@ -80,7 +243,7 @@ void colorMngrApplyFade(uint8_t fadeLvl, ZephyrRgbPixel_t *pixels,
 void colorMngrApplyUnfade(uint8_t unfadeLvl, ZephyrRgbPixel_t *pixels,
                           size_t pixelCnt)
 {
-  for(uint8_t i = 0; i < pixelCnt; ++i)
+  for(size_t i = 0; i < pixelCnt; ++i)
   {
     pixels[i].r = (uint32_t)(pixels[i].r + unfadeLvl) >= 255 ? 255 :
       pixels[i].r + unfadeLvl;
@@ -90,23 +253,25 @@ void colorMngrApplyUnfade(uint8_t unfadeLvl, ZephyrRgbPixel_t *pixels,
       pixels[i].b + unfadeLvl;
   }
 }
+#endif
 
-void colorMngrApplyFadeTrail(uint8_t fadeLvl, uint32_t trailStart,
+void colorMngrApplyFadeTrail(uint32_t fadeStep, uint32_t trailStart,
                              bool isAscending, ZephyrRgbPixel_t *pixels,
                              size_t pixelCnt)
 {
   ZephyrRgbPixel_t *pixelPntr = pixels + trailStart;
   size_t pixelCntr = 0;
+  uint32_t fade = 0;
+  uint8_t fadeLvl;
 
   while(pixelCntr < pixelCnt)
   {
-    pixelPntr->r = (int32_t)(pixelPntr->r - pixelCntr * fadeLvl) <= 0 ? 0 :
-      pixelPntr->r - pixelCntr * fadeLvl;
-    pixelPntr->g = (int32_t)(pixelPntr->g - pixelCntr * fadeLvl) <= 0 ? 0 :
-      pixelPntr->g - pixelCntr * fadeLvl;
-    pixelPntr->b = (int32_t)(pixelPntr->b - pixelCntr * fadeLvl) <= 0 ? 0 :
-      pixelPntr->b - pixelCntr * fadeLvl;
+    fadeLvl = fade >> COLOR_STEP_SHIFT;
+    pixelPntr->r = pixelPntr->r <= fadeLvl ? 0 : pixelPntr->r - fadeLvl;
+    pixelPntr->g = pixelPntr->g <= fadeLvl ? 0 : pixelPntr->g - fadeLvl;
+    pixelPntr->b = pixelPntr->b <= fadeLvl ? 0 : pixelPntr->b - fadeLvl;
 
+    fade = MIN(fade + fadeStep, COLOR_STEP_MAX);
     pixelCntr++;
     if(isAscending)
     {
@@ -123,50 +288,43 @@ void colorMngrApplyFadeTrail(uint8_t fadeLvl, uint32_t trailStart,
   }
 }
 
-void colorMngrUpdateRange(uint8_t wheelStart, uint8_t wheelEnd, bool reset,
+void colorMngrUpdateRange(uint8_t *wheelPos, uint8_t wheelStart,
+                          uint8_t wheelEnd, uint8_t step, bool reset,
                           ZephyrRgbPixel_t *pixels, size_t pixelCnt)
 {
-  static uint8_t wheelPos = 0;
-  uint8_t red = 0;
-  uint8_t green = 0;
-  uint8_t blue = 0;
+  ZephyrRgbPixel_t color;
+  uint16_t span = (uint8_t)(wheelEnd - wheelStart) + 1;
+  uint16_t offset;
 
   if(reset)
-    wheelPos = wheelStart;
-
-  calculateNewColor(wheelPos, &red, &green, &blue);
-
-  for(uint8_t i = 0; i < pixelCnt; ++i)
+    *wheelPos = wheelStart;
+  else
   {
-    pixels[i].r = red;
-    pixels[i].g = green;
-    pixels[i].b = blue;
+    offset = (uint8_t)(*wheelPos - wheelStart) + step;
+    while(offset >= span)
+      offset -= span;
+    *wheelPos = wheelStart + offset;
   }
 
-  ++wheelPos;
-  if(wheelPos > wheelEnd && wheelPos < wheelStart)
-    wheelPos = wheelStart;
+  calculateNewColor(*wheelPos, &color);
+
+  for(size_t i = 0; i < pixelCnt; ++i)
+    pixels[i] = color;
 }
 
 void colorMngrApplyRangeTrail(uint32_t trailStart, uint8_t wheelStart,
                               uint8_t wheelEnd, bool isAscending,
                               ZephyrRgbPixel_t *pixels, size_t pixelCnt)
 {
-  uint8_t red = 0;
-  uint8_t green = 0;
-  uint8_t blue = 0;
-  uint8_t step = (wheelEnd - wheelStart) / pixelCnt;
-  uint8_t wheelPos = wheelStart;
+  uint32_t step = ((uint32_t)(uint8_t)(wheelEnd - wheelStart) <<
+    COLOR_STEP_SHIFT) / pixelCnt;
+  uint32_t offset = 0;
   size_t pixelCntr = 0;
   ZephyrRgbPixel_t *pixelPntr = pixels + trailStart;
 
   while(pixelCntr < pixelCnt)
   {
-    calculateNewColor(wheelPos, &red, &green, &blue);
-
-    pixelPntr->r = red;
-    pixelPntr->g = green;
-    pixelPntr->b = blue;
+    calculateNewColor(wheelStart + (offset >> COLOR_STEP_SHIFT), pixelPntr);
 
     ++pixelCntr;
     if(isAscending)
@@ -182,12 +340,56 @@ void colorMngrApplyRangeTrail(uint32_t trailStart, uint8_t wheelStart,
         pixelPntr = pixels + pixelCnt - 1;
     }
 
-    wheelPos += step;
-    if(wheelPos > wheelEnd && wheelPos < wheelStart)
-      wheelPos = wheelStart;
+    offset += step;
+  }
+}
+
+void colorMngrApplyLerp(uint32_t weight, const ZephyrRgbPixel_t *target,
+                        ZephyrRgbPixel_t *pixels, size_t pixelCnt)
+{
+  uint32_t inverse = COLOR_LERP_ONE - weight;
+
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    pixels[i].r = (pixels[i].r * inverse + target[i].r * weight +
+      COLOR_LERP_ONE / 2) >> COLOR_LERP_SHIFT;
+    pixels[i].g = (pixels[i].g * inverse + target[i].g * weight +
+      COLOR_LERP_ONE / 2) >> COLOR_LERP_SHIFT;
+    pixels[i].b = (pixels[i].b * inverse + target[i].b * weight +
+      COLOR_LERP_ONE / 2) >> COLOR_LERP_SHIFT;
   }
 }
 
+#ifdef CONFIG_LED_MNGR_GAMMA
+void colorMngrApplyGamma(const ZephyrRgbPixel_t *src, ZephyrRgbPixel_t *dst,
+                         size_t pixelCnt)
+{
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    dst[i].r = gammaLut[src[i].r];
+    dst[i].g = gammaLut[src[i].g];
+    dst[i].b = gammaLut[src[i].b];
+  }
+}
+
+const uint8_t *colorMngrGetGammaLut(void)
+{
+  return gammaLut;
+}
+#endif
+
+void colorMngrGetWheelColor(uint8_t wheelPos, Color_t *color)
+{
+  ZephyrRgbPixel_t pixel;
+
+  calculateNewColor(wheelPos, &pixel);
+
+  color->hexColor = 0;
+  color->r = pixel.r;
+  color->g = pixel.g;
+  color->b = pixel.b;
+}
+
 uint8_t colorMngrConvertColor(Color_t *color)
 {
   uint8_t wheelPos;
@@ -195,15 +397,15 @@ uint8_t colorMngrConvertColor(Color_t *color)
   if(color->hexColor == 0xff0000)
     wheelPos = 0;
   else if(color->r && color->b)
-    wheelPos = ((float)color->b / 255) * 84;
+    wheelPos = COLOR_RATIO_TO_WHEEL(color->b);
   else if(color->hexColor == 0x0000ff)
-    wheelPos = 85;
+    wheelPos = COLOR_WHEEL_BLU_TO_GRN;
   else if(color->b && color->g)
-    wheelPos = ((float)color->g / 255) * 84 + 85;
+    wheelPos = COLOR_RATIO_TO_WHEEL(color->g) + COLOR_WHEEL_BLU_TO_GRN;
   else if(color->hexColor == 0x00ff00)
-    wheelPos = 170;
+    wheelPos = COLOR_WHEEL_GRN_TO_RED;
   else
-    wheelPos = ((float)color->r / 255) * 84 + 170;
+    wheelPos = COLOR_RATIO_TO_WHEEL(color->r) + COLOR_WHEEL_GRN_TO_RED;
 
   return wheelPos;
 }
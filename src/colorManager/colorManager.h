@@ -34,6 +34,67 @@
 */
 #define COLOR_WHEEL_GRN_TO_RED                170
 
+/**
+ * @brief The color wheel position count.
+*/
+#define COLOR_WHEEL_SIZE                      256
+
+/**
+ * @brief The fixed-point fractional bit count of the trail steps (16.16).
+*/
+#define COLOR_STEP_SHIFT                      16
+
+/**
+ * @brief The greatest trail step, a whole level or wheel position range.
+*/
+#define COLOR_STEP_MAX                        (UINT8_MAX << COLOR_STEP_SHIFT)
+
+/**
+ * @brief The lerp weight fraction bit count. The weight is kept at 16 bits,
+ *        so the one over the remaining frame count weights of a long
+ *        transition do not truncate to 0.
+*/
+#define COLOR_LERP_SHIFT                      16
+
+/**
+ * @brief The lerp weight reaching the target pixels.
+*/
+#define COLOR_LERP_ONE                        (1 << COLOR_LERP_SHIFT)
+
+/**
+ * @brief The gamma table entry count, one per channel level.
+*/
+#define COLOR_GAMMA_SIZE                      256
+
+/**
+ * @brief   Calculate the red component of a color wheel position.
+ *
+ * @param pos   The color wheel position.
+*/
+#define COLOR_WHEEL_RED(pos)                                                  \
+  ((pos) < COLOR_WHEEL_BLU_TO_GRN ? 255 - (pos) * 3 :                         \
+   (pos) < COLOR_WHEEL_GRN_TO_RED ? 0 : ((pos) - COLOR_WHEEL_GRN_TO_RED) * 3)
+
+/**
+ * @brief   Calculate the green component of a color wheel position.
+ *
+ * @param pos   The color wheel position.
+*/
+#define COLOR_WHEEL_GRN(pos)                                                  \
+  ((pos) < COLOR_WHEEL_BLU_TO_GRN ? 0 :                                       \
+   (pos) < COLOR_WHEEL_GRN_TO_RED ? ((pos) - COLOR_WHEEL_BLU_TO_GRN) * 3 :    \
+   255 - ((pos) - COLOR_WHEEL_GRN_TO_RED) * 3)
+
+/**
+ * @brief   Calculate the blue component of a color wheel position.
+ *
+ * @param pos   The color wheel position.
+*/
+#define COLOR_WHEEL_BLU(pos)                                                  \
+  ((pos) < COLOR_WHEEL_BLU_TO_GRN ? (pos) * 3 :                               \
+   (pos) < COLOR_WHEEL_GRN_TO_RED ?                                           \
+   255 - ((pos) - COLOR_WHEEL_BLU_TO_GRN) * 3 : 0)
+
 /**
  * @brief   Set the given pixels to a single color.
  *
@@ -45,7 +106,8 @@ void colorMngrSetSingle(Color_t *color, ZephyrRgbPixel_t *pixels,
                         size_t pixelCnt);
 
 /**
- * @brief   Apply a constant fade on a set of pixel.
+ * @brief   Apply a constant fade on a set of pixel. Each channel is
+ *          saturated to 0.
  *
  * @param fadeLvl     The amount of fade to use,
  * @param pixels      The pixel buffer.
@@ -55,7 +117,8 @@ void colorMngrApplyFade(uint8_t fadeLvl, ZephyrRgbPixel_t *pixels,
                         size_t pixelCnt);
 
 /**
- * @brief   Apply a constant unfade on a set of pixel.
+ * @brief   Apply a constant unfade on a set of pixel. Each channel is
+ *          saturated to 255.
  *
  * @param unfadeLvl   The amount of unfade to use.
  * @param pixel       The pixel buffer.
@@ -65,34 +128,43 @@ void colorMngrApplyUnfade(uint8_t unfadeLvl, ZephyrRgbPixel_t *pixels,
                           size_t pixelCnt);
 
 /**
- * @brief   Apply a fade trail on a set of pixels.
+ * @brief   Apply a fade trail on a set of pixels. Each pixel of the trail is
+ *          faded by one more step than the previous one.
  *
- * @param fadeLvl     The amount of fade to use.
+ * @param fadeStep    The fade step between 2 pixels (16.16), up to
+ *                    COLOR_STEP_MAX.
  * @param trailStart  The strip ID marking the trail starting point.
  * @param isAscending The ascending trail flag.
  * @param pixels      The pixel buffer.
  * @param pixelCnt    The count pixel to manage.
  */
-void colorMngrApplyFadeTrail(uint8_t fadeLvl, uint32_t trailStart,
+void colorMngrApplyFadeTrail(uint32_t fadeStep, uint32_t trailStart,
                              bool isAscending, ZephyrRgbPixel_t *pixels,
                              size_t pixelCnt);
 
 /**
  * @brief   Update the color of a set of pixel in the given color range by the
  *          given step. The range is given by the color wheel start and end.
+ *          The reset frame sets the pixels to the range start.
  *
+ * @param wheelPos    The color wheel position state of the pixels.
  * @param wheelStart  The starting color wheel posioton of the range.
  * @param wheelEnd    The ending color wheel position of the range.
+ * @param step        The count of wheel position to move by, wrapping inside
+ *                    the range, when not resetting.
  * @param reset       The reset flag.
  * @param pixels      The pixel buffer.
  * @param pixelCnt    The count of pixel to manage.
  */
-void colorMngrUpdateRange(uint8_t wheelStart, uint8_t wheelEnd, bool reset,
+void colorMngrUpdateRange(uint8_t *wheelPos, uint8_t wheelStart,
+                          uint8_t wheelEnd, uint8_t step, bool reset,
                           ZephyrRgbPixel_t *pixels, size_t pixelCnt);
 
 /**
  * @brief   Apply a color range trail to a set of pixels. The range is given by
- *          the color wheel start and end.
+ *          the color wheel start and end, wrapping around the wheel when the
+ *          end is before the start. The range is spread over the pixels with
+ *          a 16.16 wheel step, so it stays even on long strips.
  *
  * @param trailStart  The strip ID marking the trail starting point.
  * @param wheelStart  The starting color wheel posioton of the range.
@@ -105,6 +177,45 @@ void colorMngrApplyRangeTrail(uint32_t trailStart, uint8_t wheelStart,
                               uint8_t wheelEnd, bool isAscending,
                               ZephyrRgbPixel_t *pixels, size_t pixelCnt);
 
+/**
+ * @brief   Move a set of pixels toward target pixels by a fixed-point
+ *          weight (linear interpolation).
+ *
+ * @param weight      The target weight, from 0 to COLOR_LERP_ONE.
+ * @param target      The target pixels.
+ * @param pixels      The pixel buffer.
+ * @param pixelCnt    The count of pixel to manage.
+ */
+void colorMngrApplyLerp(uint32_t weight, const ZephyrRgbPixel_t *target,
+                        ZephyrRgbPixel_t *pixels, size_t pixelCnt);
+
+/**
+ * @brief   Apply the output gamma correction to a set of pixels.
+ *
+ * @param src         The linear pixels.
+ * @param dst         The gamma corrected pixels, it can be the linear pixels.
+ * @param pixelCnt    The count of pixel to manage.
+ */
+void colorMngrApplyGamma(const ZephyrRgbPixel_t *src, ZephyrRgbPixel_t *dst,
+                         size_t pixelCnt);
+
+/**
+ * @brief   Get the output gamma table, to fuse the gamma correction into
+ *          another pass over the pixels.
+ *
+ * @return  The gamma table, COLOR_GAMMA_SIZE entries indexed by the linear
+ *          channel level.
+ */
+const uint8_t *colorMngrGetGammaLut(void);
+
+/**
+ * @brief   Get the color of a color wheel position.
+ *
+ * @param wheelPos    The color wheel position.
+ * @param color       The output color.
+ */
+void colorMngrGetWheelColor(uint8_t wheelPos, Color_t *color);
+
 /**
  * @brief   Convert a RGB HEX color to a color wheel position.
  *
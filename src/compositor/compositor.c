@@ -0,0 +1,325 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      compositor.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Compositor Module
+ *
+ *            This file is the implementation of the compositor module. The
+ *            blend kernels work a word (4 channels) at a time, the channel
+ *            layout of the pixels does not matter as every channel is blended
+ *            the same way.
+ *
+ * @ingroup  compositor
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
+
+#include "compositor.h"
+
+#define COMPOSITOR_MODULE_NAME compositor_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(COMPOSITOR_MODULE_NAME);
+
+BUILD_ASSERT(APP_MSG_LED_SECTION_COUNT * CONFIG_LED_MNGR_COMPOSITOR_LAYERS <= 32,
+  "the compositor mailbox supports up to 32 layers");
+
+/**
+ * @brief The blend weight of the layer only.
+*/
+#define COMPOSITOR_WEIGHT_ONE                       256
+
+/**
+ * @brief The even channels of a word.
+*/
+#define COMPOSITOR_EVEN_MASK                        0x00ff00ffUL
+
+/**
+ * @brief The rounding of the even and odd channel products.
+*/
+#define COMPOSITOR_ROUND                            0x00800080UL
+
+/**
+ * @brief The channel low 7 bits of a word.
+*/
+#define COMPOSITOR_LOW7_MASK                        0x7f7f7f7fUL
+
+/**
+ * @brief The channel most significant bit of a word.
+*/
+#define COMPOSITOR_MSB_MASK                         0x80808080UL
+
+/**
+ * @brief The compare guard bit of the even channels of a word.
+*/
+#define COMPOSITOR_GUARD_MASK                       0x01000100UL
+
+/**
+ * @brief The blend kernel of a word.
+*/
+typedef uint32_t (*CompositorBlendWord_t)(uint32_t below, uint32_t layer,
+                                          uint32_t weight);
+
+/**
+ * @brief The layer mailbox. Each layer holds its latest set value.
+*/
+typedef struct
+{
+  CompositorLayer_t slots[APP_MSG_LED_SECTION_COUNT *
+    CONFIG_LED_MNGR_COMPOSITOR_LAYERS]; /**< The layer slots. */
+  uint32_t pending;                     /**< The pending slot mask. */
+} CompositorMailbox_t;
+
+/**
+ * @brief The layer mailbox.
+*/
+static CompositorMailbox_t mailbox;
+
+int compositorSetLayer(const CompositorLayer_t *layer)
+{
+  unsigned int key;
+  uint8_t slot;
+
+  if(layer->seq.version != APP_MSG_LED_SEQ_VERSION)
+    return -EPROTONOSUPPORT;
+
+  if(layer->layerId >= CONFIG_LED_MNGR_COMPOSITOR_LAYERS ||
+    layer->seq.sectionId >= APP_MSG_LED_SECTION_COUNT ||
+    layer->blendMode >= COMPOSITOR_BLEND_COUNT ||
+    layer->seq.seqType >= SEQ_COUNT || layer->seq.seqType == SEQ_PROGRAM)
+    return -EINVAL;
+
+  slot = layer->seq.sectionId * CONFIG_LED_MNGR_COMPOSITOR_LAYERS +
+    layer->layerId;
+
+  key = irq_lock();
+
+  mailbox.slots[slot] = *layer;
+  mailbox.pending |= BIT(slot);
+
+  irq_unlock(key);
+
+  appMsgNotifyLedManager();
+
+  return 0;
+}
+
+int compositorPopLayer(CompositorLayer_t *layer)
+{
+  unsigned int key;
+  uint8_t slot;
+
+  key = irq_lock();
+
+  if(mailbox.pending == 0)
+  {
+    irq_unlock(key);
+    return -ENOMSG;
+  }
+
+  slot = find_lsb_set(mailbox.pending) - 1;
+  *layer = mailbox.slots[slot];
+  mailbox.pending &= ~BIT(slot);
+
+  irq_unlock(key);
+
+  return 0;
+}
+
+/**
+ * @brief   Mix 2 words, channel by channel. Each 16 bits lane holds one
+ *          channel product, up to 255 * 256, so the lanes never carry.
+ *
+ * @param below       The word at weight 0.
+ * @param layer       The word at weight COMPOSITOR_WEIGHT_ONE.
+ * @param weight      The layer weight.
+ *
+ * @return  The mixed word.
+ */
+static inline uint32_t mixWord(uint32_t below, uint32_t layer, uint32_t weight)
+{
+  uint32_t inverse = COMPOSITOR_WEIGHT_ONE - weight;
+  uint32_t even;
+  uint32_t odd;
+
+  even = ((below & COMPOSITOR_EVEN_MASK) * inverse +
+    (layer & COMPOSITOR_EVEN_MASK) * weight + COMPOSITOR_ROUND) >> 8;
+  odd = ((below >> 8 & COMPOSITOR_EVEN_MASK) * inverse +
+    (layer >> 8 & COMPOSITOR_EVEN_MASK) * weight + COMPOSITOR_ROUND);
+
+  return (even & COMPOSITOR_EVEN_MASK) | (odd & ~COMPOSITOR_EVEN_MASK);
+}
+
+/**
+ * @brief   The normal blend kernel.
+ *
+ * @param below       The word below.
+ * @param layer       The layer word.
+ * @param weight      The layer weight.
+ *
+ * @return  The blended word.
+ */
+static uint32_t blendNormal(uint32_t below, uint32_t layer, uint32_t weight)
+{
+  return mixWord(below, layer, weight);
+}
+
+/**
+ * @brief   The additive blend kernel. The layer is scaled by its weight, then
+ *          added with a per channel saturation.
+ *
+ * @param below       The word below.
+ * @param layer       The layer word.
+ * @param weight      The layer weight.
+ *
+ * @return  The blended word.
+ */
+static uint32_t blendAdd(uint32_t below, uint32_t layer, uint32_t weight)
+{
+  uint32_t sum;
+  uint32_t carry;
+
+  layer = mixWord(0, layer, weight);
+  sum = (below & COMPOSITOR_LOW7_MASK) + (layer & COMPOSITOR_LOW7_MASK);
+  carry = ((below & layer) | ((below | layer) & sum)) & COMPOSITOR_MSB_MASK;
+  sum ^= (below ^ layer) & COMPOSITOR_MSB_MASK;
+
+  return sum | ((carry << 1) - (carry >> 7));
+}
+
+/**
+ * @brief   Multiply 2 channels, 255 being one.
+ *
+ * @param a           The first channel.
+ * @param b           The second channel.
+ *
+ * @return  The channel product.
+ */
+static inline uint32_t multiplyChannel(uint32_t a, uint32_t b)
+{
+  uint32_t product = (a & 0xff) * (b & 0xff) + 128;
+
+  return (product + (product >> 8)) >> 8;
+}
+
+/**
+ * @brief   The multiply blend kernel. The product is mixed with the word
+ *          below by the layer weight.
+ *
+ * @param below       The word below.
+ * @param layer       The layer word.
+ * @param weight      The layer weight.
+ *
+ * @return  The blended word.
+ */
+static uint32_t blendMultiply(uint32_t below, uint32_t layer, uint32_t weight)
+{
+  uint32_t product;
+
+  product = multiplyChannel(below, layer) |
+    multiplyChannel(below >> 8, layer >> 8) << 8 |
+    multiplyChannel(below >> 16, layer >> 16) << 16 |
+    multiplyChannel(below >> 24, layer >> 24) << 24;
+
+  return mixWord(below, product, weight);
+}
+
+/**
+ * @brief   Select the greatest even channels of 2 words. The guard bit above
+ *          each channel is kept by the subtraction when a >= b.
+ *
+ * @param a           The first word even channels.
+ * @param b           The second word even channels.
+ *
+ * @return  The greatest even channels.
+ */
+static inline uint32_t maxEvenChannels(uint32_t a, uint32_t b)
+{
+  uint32_t isGreater = ((a | COMPOSITOR_GUARD_MASK) - b) &
+    COMPOSITOR_GUARD_MASK;
+  uint32_t mask = isGreater - (isGreater >> 8);
+
+  return (a & mask) | (b & ~mask & COMPOSITOR_EVEN_MASK);
+}
+
+/**
+ * @brief   The max blend kernel. The greatest channels are mixed with the
+ *          word below by the layer weight.
+ *
+ * @param below       The word below.
+ * @param layer       The layer word.
+ * @param weight      The layer weight.
+ *
+ * @return  The blended word.
+ */
+static uint32_t blendMax(uint32_t below, uint32_t layer, uint32_t weight)
+{
+  uint32_t greatest;
+
+  greatest = maxEvenChannels(below & COMPOSITOR_EVEN_MASK,
+    layer & COMPOSITOR_EVEN_MASK) |
+    maxEvenChannels(below >> 8 & COMPOSITOR_EVEN_MASK,
+    layer >> 8 & COMPOSITOR_EVEN_MASK) << 8;
+
+  return mixWord(below, greatest, weight);
+}
+
+/**
+ * @brief The blend kernels, indexed by blend mode.
+*/
+static const CompositorBlendWord_t blendWords[COMPOSITOR_BLEND_COUNT] = {
+  [COMPOSITOR_BLEND_NORMAL] = blendNormal,
+  [COMPOSITOR_BLEND_ADD] = blendAdd,
+  [COMPOSITOR_BLEND_MULTIPLY] = blendMultiply,
+  [COMPOSITOR_BLEND_MAX] = blendMax,
+};
+
+void compositorBlend(uint8_t blendMode, uint8_t alpha,
+                     const ZephyrRgbPixel_t *src, ZephyrRgbPixel_t *dst,
+                     size_t pixelCnt)
+{
+  const uint8_t *layerBytes = (const uint8_t *)src;
+  uint8_t *belowBytes = (uint8_t *)dst;
+  size_t len = pixelCnt * sizeof(*dst);
+  CompositorBlendWord_t blendWord;
+  uint32_t weight;
+  uint32_t below;
+  uint32_t layer;
+  size_t i;
+
+  if(alpha == 0 || blendMode >= COMPOSITOR_BLEND_COUNT)
+    return;
+
+  blendWord = blendWords[blendMode];
+  weight = alpha + (alpha >> 7);
+
+  for(i = 0; i + sizeof(below) <= len; i += sizeof(below))
+  {
+    memcpy(&below, belowBytes + i, sizeof(below));
+    memcpy(&layer, layerBytes + i, sizeof(layer));
+    below = blendWord(below, layer, weight);
+    memcpy(belowBytes + i, &below, sizeof(below));
+  }
+
+  if(i < len)
+  {
+    below = 0;
+    layer = 0;
+    memcpy(&below, belowBytes + i, len - i);
+    memcpy(&layer, layerBytes + i, len - i);
+    below = blendWord(below, layer, weight);
+    memcpy(belowBytes + i, &below, len - i);
+  }
+}
+#endif
+
+/** @} */
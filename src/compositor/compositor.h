@@ -0,0 +1,98 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      compositor.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Compositor Module
+ *
+ *            This file is the declaration of the compositor module. Each
+ *            section can stack up to CONFIG_LED_MNGR_COMPOSITOR_LAYERS
+ *            overlay layers on top of its sequence. Each layer runs its own
+ *            sequence and is blended over the layers below with an 8 bits
+ *            alpha and a blend mode.
+ *
+ *            The producer (the host link) sets the layers in a per-layer
+ *            mailbox, the consumer (the LED manager) pops them between 2
+ *            frames.
+ *
+ * @defgroup  compositor compositor
+ *
+ * @{
+ */
+
+#ifndef COMPOSITOR
+#define COMPOSITOR
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "appMsg.h"
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief The compositor blend modes.
+*/
+typedef enum
+{
+  COMPOSITOR_BLEND_NORMAL,              /**< The layer covers the layers below. */
+  COMPOSITOR_BLEND_ADD,                 /**< The layer is added to the layers below, saturated. */
+  COMPOSITOR_BLEND_MULTIPLY,            /**< The layer multiplies the layers below. */
+  COMPOSITOR_BLEND_MAX,                 /**< The brightest channel of the layer and the layers below. */
+  COMPOSITOR_BLEND_COUNT,               /**< The blend mode count. */
+} CompositorBlendMode_t;
+
+/**
+ * @brief The compositor layer. It is also the binary wire layout
+ *        (little-endian). A layer with a 0 alpha is disabled.
+*/
+typedef struct
+{
+  uint8_t layerId;                      /**< The overlay layer ID, 0 for the lowest. */
+  uint8_t alpha;                        /**< The layer alpha, 255 for opaque. */
+  uint8_t blendMode;                    /**< The blend mode (CompositorBlendMode_t). */
+  uint8_t reserved;                     /**< Reserved, 0. */
+  LedSequence_t seq;                    /**< The layer sequence, with its section ID. */
+} CompositorLayer_t;
+
+BUILD_ASSERT(sizeof(CompositorLayer_t) == 16,
+  "the compositor layer must be 16 bytes");
+
+/**
+ * @brief   Set a section overlay layer. A pending layer of the same section
+ *          and layer ID is replaced. Producer side.
+ *
+ * @param layer       The layer.
+ *
+ * @return  0 if successful, -EINVAL if the layer, section, blend mode or
+ *          sequence type is invalid, -EPROTONOSUPPORT if the sequence layout
+ *          version is not supported.
+ */
+int compositorSetLayer(const CompositorLayer_t *layer);
+
+/**
+ * @brief   Pop a pending layer. Consumer side.
+ *
+ * @param layer       The output layer.
+ *
+ * @return  0 if successful, -ENOMSG if no layer is pending.
+ */
+int compositorPopLayer(CompositorLayer_t *layer);
+
+/**
+ * @brief   Blend a layer span over the pixels below.
+ *
+ * @param blendMode   The blend mode.
+ * @param alpha       The layer alpha.
+ * @param src         The layer pixels.
+ * @param dst         The pixels below, updated with the blended pixels.
+ * @param pixelCnt    The pixel count.
+ */
+void compositorBlend(uint8_t blendMode, uint8_t alpha,
+                     const ZephyrRgbPixel_t *src, ZephyrRgbPixel_t *dst,
+                     size_t pixelCnt);
+
+#endif    /* COMPOSITOR */
+
+/** @} */
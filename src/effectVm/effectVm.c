@@ -0,0 +1,455 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      effectVm.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Effect VM Module
+ *
+ *            This file is the implementation of the effect VM module.
+ *
+ * @ingroup  effectVm
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
+
+#include "colorManager.h"
+#include "effectVm.h"
+
+#define EFFECT_VM_MODULE_NAME effect_vm_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(EFFECT_VM_MODULE_NAME);
+
+BUILD_ASSERT(CONFIG_LED_MNGR_EFFECT_VM_SIZE % EFFECT_VM_INSTR_SIZE == 0 &&
+  CONFIG_LED_MNGR_EFFECT_VM_SIZE <= UINT16_MAX,
+  "the effect program size must be a multiple of 4, up to 65535 bytes");
+
+BUILD_ASSERT(EFFECT_VM_OP_COUNT <= UINT8_MAX, "the opcode must fit in 8 bits");
+
+/**
+ * @brief The first operand register flag of an opcode.
+*/
+#define EFFECT_VM_ARG_REG_A                         BIT(0)
+
+/**
+ * @brief The second operand register flag of an opcode.
+*/
+#define EFFECT_VM_ARG_REG_B                         BIT(1)
+
+/**
+ * @brief The third operand register flag of an opcode.
+*/
+#define EFFECT_VM_ARG_REG_C                         BIT(2)
+
+/**
+ * @brief The immediate operand flag of an opcode.
+*/
+#define EFFECT_VM_ARG_IMM                           BIT(3)
+
+/**
+ * @brief The jump target operand flag of an opcode.
+*/
+#define EFFECT_VM_ARG_JUMP                          BIT(4)
+
+/**
+ * @brief The blend weight of the second color only.
+*/
+#define EFFECT_VM_BLEND_ONE                         256
+
+/**
+ * @brief The operand flags of each opcode, used by the verifier.
+*/
+static const uint8_t opArgs[EFFECT_VM_OP_COUNT] = {
+  [EFFECT_VM_OP_END] = 0,
+  [EFFECT_VM_OP_WAIT] = EFFECT_VM_ARG_IMM,
+  [EFFECT_VM_OP_LDI] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_IMM,
+  [EFFECT_VM_OP_LDIH] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_IMM,
+  [EFFECT_VM_OP_MOV] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B,
+  [EFFECT_VM_OP_ADD] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B |
+    EFFECT_VM_ARG_REG_C,
+  [EFFECT_VM_OP_SUB] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B |
+    EFFECT_VM_ARG_REG_C,
+  [EFFECT_VM_OP_ADDI] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_IMM,
+  [EFFECT_VM_OP_MOD] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B |
+    EFFECT_VM_ARG_REG_C,
+  [EFFECT_VM_OP_CNT] = EFFECT_VM_ARG_REG_A,
+  [EFFECT_VM_OP_JMP] = EFFECT_VM_ARG_IMM | EFFECT_VM_ARG_JUMP,
+  [EFFECT_VM_OP_JNZ] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_IMM |
+    EFFECT_VM_ARG_JUMP,
+  [EFFECT_VM_OP_FILL] = EFFECT_VM_ARG_REG_A,
+  [EFFECT_VM_OP_SET] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B,
+  [EFFECT_VM_OP_GET] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B,
+  [EFFECT_VM_OP_FADE] = EFFECT_VM_ARG_REG_A,
+  [EFFECT_VM_OP_SHIFT] = EFFECT_VM_ARG_REG_A,
+  [EFFECT_VM_OP_WHEEL] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B,
+  [EFFECT_VM_OP_BLEND] = EFFECT_VM_ARG_REG_A | EFFECT_VM_ARG_REG_B |
+    EFFECT_VM_ARG_REG_C,
+};
+
+/**
+ * @brief The program staging buffer, written by the producer.
+*/
+static uint8_t staging[CONFIG_LED_MNGR_EFFECT_VM_SIZE];
+
+/**
+ * @brief The running program, only accessed by the consumer.
+*/
+static uint8_t program[CONFIG_LED_MNGR_EFFECT_VM_SIZE];
+
+/**
+ * @brief The running program instruction count.
+*/
+static uint16_t instrCount;
+
+/**
+ * @brief The loaded program length, valid while the pending flag is set.
+*/
+static uint16_t pendingLen;
+
+/**
+ * @brief The loaded program pending flag, set by the producer and cleared
+ *        by the consumer once the program is swapped in.
+*/
+static volatile bool isPending;
+
+/**
+ * @brief The statistics.
+*/
+static EffectVmStats_t stats;
+
+/**
+ * @brief   Verify the program instructions: the opcodes, the register
+ *          operands, the jump targets and the unused operands, which must
+ *          be 0.
+ *
+ * @param code        The program.
+ * @param count       The instruction count.
+ *
+ * @return  0 if the program is valid, -ENOEXEC otherwise.
+ */
+static int verifyProgram(const uint8_t *code, uint16_t count)
+{
+  const uint8_t *instr;
+  uint8_t args;
+
+  for(uint16_t i = 0; i < count; ++i)
+  {
+    instr = code + i * EFFECT_VM_INSTR_SIZE;
+    if(instr[0] >= EFFECT_VM_OP_COUNT)
+      return -ENOEXEC;
+
+    args = opArgs[instr[0]];
+    if(args & EFFECT_VM_ARG_REG_A ? instr[1] >= EFFECT_VM_REG_COUNT :
+      instr[1] != 0)
+      return -ENOEXEC;
+
+    if(args & EFFECT_VM_ARG_IMM)
+    {
+      if(args & EFFECT_VM_ARG_JUMP && (instr[2] | instr[3] << 8) >= count)
+        return -ENOEXEC;
+      continue;
+    }
+
+    if(args & EFFECT_VM_ARG_REG_B ? instr[2] >= EFFECT_VM_REG_COUNT :
+      instr[2] != 0)
+      return -ENOEXEC;
+
+    if(args & EFFECT_VM_ARG_REG_C ? instr[3] >= EFFECT_VM_REG_COUNT :
+      instr[3] != 0)
+      return -ENOEXEC;
+  }
+
+  return 0;
+}
+
+int effectVmWrite(uint16_t offset, const uint8_t *data, size_t len)
+{
+  if(isPending)
+    return -EBUSY;
+
+  if(offset + len > sizeof(staging))
+    return -EINVAL;
+
+  memcpy(staging + offset, data, len);
+
+  return 0;
+}
+
+int effectVmLoad(uint16_t len)
+{
+  int rc;
+
+  if(isPending)
+    return -EBUSY;
+
+  if(len == 0 || len > sizeof(staging) || len % EFFECT_VM_INSTR_SIZE != 0)
+    return -EINVAL;
+
+  rc = verifyProgram(staging, len / EFFECT_VM_INSTR_SIZE);
+  if(rc < 0)
+  {
+    LOG_ERR("invalid effect program");
+    return rc;
+  }
+
+  pendingLen = len;
+  barrier_dmem_fence_full();
+  isPending = true;
+
+  appMsgNotifyLedManager();
+
+  return 0;
+}
+
+bool effectVmSync(void)
+{
+  if(!isPending)
+    return false;
+
+  memcpy(program, staging, pendingLen);
+  instrCount = pendingLen / EFFECT_VM_INSTR_SIZE;
+  stats.programSize = pendingLen;
+  ++stats.loadCount;
+
+  barrier_dmem_fence_full();
+  isPending = false;
+
+  return true;
+}
+
+bool effectVmIsRunning(EffectVmCtx_t *ctx)
+{
+  return !ctx->isStopped;
+}
+
+/**
+ * @brief   Convert a color register into a pixel.
+ *
+ * @param reg         The color register.
+ * @param pixel       The output pixel.
+ */
+static inline void regToPixel(uint32_t reg, ZephyrRgbPixel_t *pixel)
+{
+  pixel->r = reg >> 16;
+  pixel->g = reg >> 8;
+  pixel->b = reg;
+}
+
+/**
+ * @brief   Convert a pixel into a color register.
+ *
+ * @param pixel       The pixel.
+ *
+ * @return  The color register.
+ */
+static inline uint32_t pixelToReg(const ZephyrRgbPixel_t *pixel)
+{
+  return (uint32_t)pixel->r << 16 | (uint32_t)pixel->g << 8 | pixel->b;
+}
+
+/**
+ * @brief   Blend a color channel.
+ *
+ * @param from        The channel at weight 0.
+ * @param to          The channel at weight EFFECT_VM_BLEND_ONE.
+ * @param weight      The weight.
+ *
+ * @return  The blended channel.
+ */
+static inline uint32_t blendChannel(uint8_t from, uint8_t to, uint32_t weight)
+{
+  return (from * (EFFECT_VM_BLEND_ONE - weight) + to * weight +
+    EFFECT_VM_BLEND_ONE / 2) >> 8;
+}
+
+/**
+ * @brief   Reverse a pixel range in place.
+ *
+ * @param pixels      The first pixel of the range.
+ * @param pixelCnt    The range pixel count.
+ */
+static void reversePixels(ZephyrRgbPixel_t *pixels, size_t pixelCnt)
+{
+  ZephyrRgbPixel_t pixel;
+
+  for(size_t i = 0; i < pixelCnt / 2; ++i)
+  {
+    pixel = pixels[i];
+    pixels[i] = pixels[pixelCnt - 1 - i];
+    pixels[pixelCnt - 1 - i] = pixel;
+  }
+}
+
+/**
+ * @brief   Rotate the pixels in place toward the last one.
+ *
+ * @param moves       The pixel count to rotate by.
+ * @param pixels      The pixel buffer.
+ * @param pixelCnt    The pixel count.
+ */
+static void rotatePixels(uint32_t moves, ZephyrRgbPixel_t *pixels,
+                         size_t pixelCnt)
+{
+  moves %= pixelCnt;
+  if(moves == 0)
+    return;
+
+  reversePixels(pixels, pixelCnt);
+  reversePixels(pixels, moves);
+  reversePixels(pixels + moves, pixelCnt - moves);
+}
+
+/**
+ * @brief   Reset a section program context.
+ *
+ * @param ctx         The section program context.
+ * @param startColor  The sequence start color.
+ * @param endColor    The sequence end color.
+ */
+static void resetContext(EffectVmCtx_t *ctx, Color_t *startColor,
+                         Color_t *endColor)
+{
+  memset(ctx, 0x00, sizeof(*ctx));
+  ctx->regs[0] = startColor->hexColor & 0xffffff;
+  ctx->regs[1] = endColor->hexColor & 0xffffff;
+  ctx->isStopped = instrCount == 0;
+}
+
+bool effectVmRunFrame(EffectVmCtx_t *ctx, Color_t *startColor,
+                      Color_t *endColor, bool reset, ZephyrRgbPixel_t *pixels,
+                      size_t pixelCnt)
+{
+  uint32_t *regs = ctx->regs;
+  const uint8_t *instr;
+  uint32_t *ra;
+  uint16_t imm;
+  Color_t color;
+  bool dirty = false;
+
+  if(reset)
+    resetContext(ctx, startColor, endColor);
+  else if(ctx->waitFrames > 0)
+  {
+    --ctx->waitFrames;
+    return false;
+  }
+
+  for(uint32_t budget = CONFIG_LED_MNGR_EFFECT_VM_BUDGET;
+    budget > 0 && !ctx->isStopped; --budget)
+  {
+    if(ctx->pc >= instrCount)
+    {
+      ctx->isStopped = true;
+      break;
+    }
+
+    instr = program + ctx->pc * EFFECT_VM_INSTR_SIZE;
+    ra = regs + instr[1];
+    imm = instr[2] | instr[3] << 8;
+    ++ctx->pc;
+
+    switch(instr[0])
+    {
+      case EFFECT_VM_OP_END:
+        ctx->isStopped = true;
+      break;
+      case EFFECT_VM_OP_WAIT:
+        ctx->waitFrames = imm;
+        return dirty;
+      case EFFECT_VM_OP_LDI:
+        *ra = imm;
+      break;
+      case EFFECT_VM_OP_LDIH:
+        *ra = (*ra & 0xffff) | (uint32_t)imm << 16;
+      break;
+      case EFFECT_VM_OP_MOV:
+        *ra = regs[instr[2]];
+      break;
+      case EFFECT_VM_OP_ADD:
+        *ra = regs[instr[2]] + regs[instr[3]];
+      break;
+      case EFFECT_VM_OP_SUB:
+        *ra = regs[instr[2]] - regs[instr[3]];
+      break;
+      case EFFECT_VM_OP_ADDI:
+        *ra += (int16_t)imm;
+      break;
+      case EFFECT_VM_OP_MOD:
+        *ra = regs[instr[3]] == 0 ? 0 : regs[instr[2]] % regs[instr[3]];
+      break;
+      case EFFECT_VM_OP_CNT:
+        *ra = pixelCnt;
+      break;
+      case EFFECT_VM_OP_JMP:
+        ctx->pc = imm;
+      break;
+      case EFFECT_VM_OP_JNZ:
+        if(*ra != 0)
+          ctx->pc = imm;
+      break;
+      case EFFECT_VM_OP_FILL:
+        color.hexColor = *ra;
+        colorMngrSetSingle(&color, pixels, pixelCnt);
+        dirty = true;
+      break;
+      case EFFECT_VM_OP_SET:
+        regToPixel(regs[instr[2]], pixels + *ra % pixelCnt);
+        dirty = true;
+      break;
+      case EFFECT_VM_OP_GET:
+        *ra = pixelToReg(pixels + regs[instr[2]] % pixelCnt);
+      break;
+      case EFFECT_VM_OP_FADE:
+        colorMngrApplyFade(MIN(*ra, UINT8_MAX), pixels, pixelCnt);
+        dirty = true;
+      break;
+      case EFFECT_VM_OP_SHIFT:
+        rotatePixels(*ra, pixels, pixelCnt);
+        dirty = true;
+      break;
+      case EFFECT_VM_OP_WHEEL:
+        colorMngrGetWheelColor(regs[instr[2]], &color);
+        *ra = color.hexColor;
+      break;
+      case EFFECT_VM_OP_BLEND:
+        imm = MIN(regs[instr[3]], EFFECT_VM_BLEND_ONE);
+        *ra = blendChannel(*ra >> 16, regs[instr[2]] >> 16, imm) << 16 |
+          blendChannel(*ra >> 8, regs[instr[2]] >> 8, imm) << 8 |
+          blendChannel(*ra, regs[instr[2]], imm);
+      break;
+      default:
+        ctx->isStopped = true;
+      break;
+    }
+  }
+
+  if(!ctx->isStopped)
+  {
+    ctx->isStopped = true;
+    ++stats.faultCount;
+    LOG_WRN("effect program over its frame budget");
+  }
+
+  return dirty;
+}
+
+void effectVmGetStats(EffectVmStats_t *out)
+{
+  unsigned int key = irq_lock();
+
+  *out = stats;
+
+  irq_unlock(key);
+}
+#endif
+
+/** @} */
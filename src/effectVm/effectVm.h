@@ -0,0 +1,189 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      effectVm.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Effect VM Module
+ *
+ *            This file is the declaration of the effect VM module, the
+ *            interpreter of the effect programs uploaded by the main
+ *            controller and run by the SEQ_PROGRAM sequences.
+ *
+ *            A program is a list of 4 bytes instructions: an opcode, then
+ *            3 operands a, b and c. The instructions taking an immediate
+ *            hold it in b (LSB) and c (MSB). The VM has EFFECT_VM_REG_COUNT
+ *            32 bits registers, a color register holds 0x00RRGGBB. On the
+ *            sequence reset, r0 holds the sequence start color, r1 its end
+ *            color, and the other registers are cleared.
+ *
+ *            Each section running the program has its own registers and
+ *            program counter. On each frame deadline, the program runs from
+ *            its program counter up to a WAIT or an END. A program running
+ *            more than CONFIG_LED_MNGR_EFFECT_VM_BUDGET instructions in a
+ *            frame is faulted and stopped.
+ *
+ *            The producer (the host link) writes the program in a staging
+ *            buffer and loads it once verified. The consumer (the LED
+ *            manager) swaps it in between 2 frames.
+ *
+ * @defgroup  effectVm effectVm
+ *
+ * @{
+ */
+
+#ifndef EFFECT_VM
+#define EFFECT_VM
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "appMsg.h"
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief The register count.
+*/
+#define EFFECT_VM_REG_COUNT                         8
+
+/**
+ * @brief The instruction size, in bytes.
+*/
+#define EFFECT_VM_INSTR_SIZE                        4
+
+/**
+ * @brief   Encode an instruction with register operands.
+ *
+ * @param op    The opcode.
+ * @param a     The first operand.
+ * @param b     The second operand.
+ * @param c     The third operand.
+*/
+#define EFFECT_VM_INSTR(op, a, b, c)                (op), (a), (b), (c)
+
+/**
+ * @brief   Encode an instruction with a register and an immediate operand.
+ *
+ * @param op    The opcode.
+ * @param a     The register operand.
+ * @param imm   The 16 bits immediate operand.
+*/
+#define EFFECT_VM_INSTR_IMM(op, a, imm)                                       \
+  (op), (a), ((imm) & 0xff), (((imm) >> 8) & 0xff)
+
+/**
+ * @brief The effect VM opcodes.
+*/
+typedef enum
+{
+  EFFECT_VM_OP_END,                     /**< Stop the program: END. */
+  EFFECT_VM_OP_WAIT,                    /**< End the frame and skip imm frames: WAIT imm. */
+  EFFECT_VM_OP_LDI,                     /**< Load an immediate: LDI ra, imm. */
+  EFFECT_VM_OP_LDIH,                    /**< Load an immediate in the 16 MSB: LDIH ra, imm. */
+  EFFECT_VM_OP_MOV,                     /**< Copy a register: MOV ra, rb. */
+  EFFECT_VM_OP_ADD,                     /**< Add: ADD ra, rb, rc. */
+  EFFECT_VM_OP_SUB,                     /**< Subtract: SUB ra, rb, rc. */
+  EFFECT_VM_OP_ADDI,                    /**< Add a signed immediate: ADDI ra, imm. */
+  EFFECT_VM_OP_MOD,                     /**< Modulo, 0 by 0: MOD ra, rb, rc. */
+  EFFECT_VM_OP_CNT,                     /**< Load the section pixel count: CNT ra. */
+  EFFECT_VM_OP_JMP,                     /**< Jump to an instruction: JMP imm. */
+  EFFECT_VM_OP_JNZ,                     /**< Jump if not zero: JNZ ra, imm. */
+  EFFECT_VM_OP_FILL,                    /**< Set every pixel to a color: FILL ra. */
+  EFFECT_VM_OP_SET,                     /**< Set the pixel ra (modulo the pixel count) to a color: SET ra, rb. */
+  EFFECT_VM_OP_GET,                     /**< Load the pixel rb (modulo the pixel count) color: GET ra, rb. */
+  EFFECT_VM_OP_FADE,                    /**< Fade every pixel, up to 255 levels: FADE ra. */
+  EFFECT_VM_OP_SHIFT,                   /**< Rotate the pixels toward the last one: SHIFT ra. */
+  EFFECT_VM_OP_WHEEL,                   /**< Load a color wheel color: WHEEL ra, rb. */
+  EFFECT_VM_OP_BLEND,                   /**< Blend 2 colors, rc from 0 (ra) to 256 (rb): BLEND ra, rb, rc. */
+  EFFECT_VM_OP_COUNT,                   /**< The opcode count. */
+} EffectVmOp_t;
+
+/**
+ * @brief The program context of a section.
+*/
+typedef struct
+{
+  uint32_t regs[EFFECT_VM_REG_COUNT];   /**< The registers. */
+  uint16_t pc;                          /**< The program counter (instruction). */
+  uint16_t waitFrames;                  /**< The frames left to wait. */
+  bool isStopped;                       /**< The program ended or faulted flag. */
+} EffectVmCtx_t;
+
+/**
+ * @brief The effect VM statistics.
+*/
+typedef struct
+{
+  uint16_t programSize;                 /**< The loaded program size (bytes). */
+  uint32_t loadCount;                   /**< The loaded program count. */
+  uint32_t faultCount;                  /**< The programs faulted over the budget. */
+} EffectVmStats_t;
+
+/**
+ * @brief   Write a chunk of program in the staging buffer. Producer side.
+ *
+ * @param offset      The chunk offset in the program.
+ * @param data        The chunk data.
+ * @param len         The chunk length.
+ *
+ * @return  0 if successful, -EBUSY if a loaded program is not swapped in yet,
+ *          -EINVAL if the chunk is out of the buffer.
+ */
+int effectVmWrite(uint16_t offset, const uint8_t *data, size_t len);
+
+/**
+ * @brief   Verify and load the program in the staging buffer. It is swapped
+ *          in by the LED manager before its next frame. Producer side.
+ *
+ * @param len         The program length.
+ *
+ * @return  0 if successful, -EBUSY if a loaded program is not swapped in yet,
+ *          -EINVAL if the program length is invalid, -ENOEXEC if the program
+ *          is invalid.
+ */
+int effectVmLoad(uint16_t len);
+
+/**
+ * @brief   Swap in the loaded program. Consumer side.
+ *
+ * @return  True if a program was swapped in, false otherwise.
+ */
+bool effectVmSync(void);
+
+/**
+ * @brief   Check if a section program still runs, i.e. it needs to be run on
+ *          every frame.
+ *
+ * @param ctx         The section program context.
+ *
+ * @return  True if the program runs, false if it ended or faulted.
+ */
+bool effectVmIsRunning(EffectVmCtx_t *ctx);
+
+/**
+ * @brief   Run the section program for the next frame. Consumer side.
+ *
+ * @param ctx         The section program context.
+ * @param startColor  The sequence start color, loaded in r0 on reset.
+ * @param endColor    The sequence end color, loaded in r1 on reset.
+ * @param reset       The reset flag of the sequence.
+ * @param pixels      The pixel buffer.
+ * @param pixelCnt    The pixel count.
+ *
+ * @return  True if the pixels were updated, false otherwise.
+ */
+bool effectVmRunFrame(EffectVmCtx_t *ctx, Color_t *startColor,
+                      Color_t *endColor, bool reset, ZephyrRgbPixel_t *pixels,
+                      size_t pixelCnt);
+
+/**
+ * @brief   Get the effect VM statistics.
+ *
+ * @param stats       The output statistics.
+ */
+void effectVmGetStats(EffectVmStats_t *stats);
+
+#endif    /* EFFECT_VM */
+
+/** @} */
@@ -0,0 +1,62 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      effectVmCmd.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Effect VM Command Module
+ *
+ *            This file is the implementation of the effect VM commands.
+ *
+ * @ingroup  effectVm
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+#include <zephyr/shell/shell.h>
+
+#include "effectVm.h"
+
+/**
+ * @brief The effect command usage.
+*/
+#define EFFECT_USAGE            "Effect program related commands."
+
+/**
+ * @brief The effect stats command usage.
+*/
+#define EFFECT_STATS_USAGE      "Display the effect program statistics: effect stats"
+
+/**
+ * @brief   Execute the effect stats command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStats(const struct shell *shell, size_t argc, char **argv)
+{
+  EffectVmStats_t stats;
+
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  effectVmGetStats(&stats);
+
+  shell_print(shell, "program: %u bytes", stats.programSize);
+  shell_print(shell, "loads: %u", stats.loadCount);
+  shell_print(shell, "faults: %u", stats.faultCount);
+
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(effect_sub,
+  SHELL_CMD(stats, NULL, EFFECT_STATS_USAGE, execStats),
+  SHELL_SUBCMD_SET_END);
+SHELL_CMD_REGISTER(effect, &effect_sub, EFFECT_USAGE, NULL);
+#endif
+
+/** @} */
@@ -0,0 +1,146 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      frameScheduler.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Scheduler Module
+ *
+ *            This file is the implementation of the frame scheduler module.
+ *
+ * @ingroup  frameScheduler
+ *
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <string.h>
+
+#include "frameScheduler.h"
+
+#define FRAME_SCHED_MODULE_NAME frame_sched_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(FRAME_SCHED_MODULE_NAME);
+
+BUILD_ASSERT(IS_ENABLED(CONFIG_TIMEOUT_64BIT),
+  "the frame scheduler needs absolute timeouts");
+
+/**
+ * @brief The frame schedule.
+*/
+typedef struct
+{
+  uint32_t fps;                         /**< The target frame rate. */
+  uint32_t periodTicks;                 /**< The whole ticks of a frame period. */
+  uint32_t periodRemain;                /**< The tick remainder of a frame period. */
+  uint32_t remainAcc;                   /**< The tick remainder accumulator. */
+  int64_t deadline;                     /**< The next frame deadline (ticks). */
+} FrameSchedule_t;
+
+/**
+ * @brief The frame schedule.
+*/
+static FrameSchedule_t schedule;
+
+/**
+ * @brief The frame timing statistics.
+*/
+static FrameSchedStats_t stats;
+
+/**
+ * @brief   Move the deadline by one frame period. The period remainder is
+ *          spread over the frames so the frame rate does not drift.
+ */
+static void advanceDeadline(void)
+{
+  schedule.deadline += schedule.periodTicks;
+  schedule.remainAcc += schedule.periodRemain;
+  if(schedule.remainAcc >= schedule.fps)
+  {
+    schedule.remainAcc -= schedule.fps;
+    ++schedule.deadline;
+  }
+}
+
+int frameSchedInit(uint32_t fps)
+{
+  if(fps == 0 || fps > CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+  {
+    LOG_ERR("invalid frame rate: %d", fps);
+    return -EINVAL;
+  }
+
+  schedule.fps = fps;
+  schedule.periodTicks = CONFIG_SYS_CLOCK_TICKS_PER_SEC / fps;
+  schedule.periodRemain = CONFIG_SYS_CLOCK_TICKS_PER_SEC % fps;
+  frameSchedRestart();
+
+  frameSchedResetStats();
+
+  return 0;
+}
+
+void frameSchedRestart(void)
+{
+  schedule.remainAcc = 0;
+  schedule.deadline = k_uptime_ticks();
+  advanceDeadline();
+}
+
+uint32_t frameSchedGetFps(void)
+{
+  return schedule.fps;
+}
+
+k_timeout_t frameSchedGetNextDeadline(void)
+{
+  int64_t now = k_uptime_ticks();
+
+  if(now > schedule.deadline)
+  {
+    ++stats.missedCount;
+    while(now > schedule.deadline)
+    {
+      ++stats.overrunCount;
+      advanceDeadline();
+    }
+  }
+
+  return K_TIMEOUT_ABS_TICKS(schedule.deadline);
+}
+
+void frameSchedStartFrame(void)
+{
+  uint32_t jitter;
+
+  jitter = k_ticks_to_us_floor32(k_uptime_ticks() - schedule.deadline);
+  stats.lastJitter = jitter;
+  if(jitter > stats.maxJitter)
+    stats.maxJitter = jitter;
+  ++stats.frameCount;
+
+  advanceDeadline();
+}
+
+void frameSchedGetStats(FrameSchedStats_t *out)
+{
+  unsigned int key = irq_lock();
+
+  *out = stats;
+
+  irq_unlock(key);
+}
+
+void frameSchedResetStats(void)
+{
+  unsigned int key = irq_lock();
+
+  memset(&stats, 0x00, sizeof(stats));
+
+  irq_unlock(key);
+}
+
+/** @} */
@@ -0,0 +1,89 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      frameScheduler.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Scheduler Module
+ *
+ *            This file is the declaration of the frame scheduler module.
+ *
+ * @defgroup  frameScheduler frameScheduler
+ *
+ * @{
+ */
+
+#ifndef FRAME_SCHEDULER
+#define FRAME_SCHEDULER
+
+#include <zephyr/kernel.h>
+
+#include <stdint.h>
+
+/**
+ * @brief The frame timing statistics.
+*/
+typedef struct
+{
+  uint32_t frameCount;                  /**< The scheduled frame count. */
+  uint32_t missedCount;                 /**< The missed deadline count. */
+  uint32_t overrunCount;                /**< The dropped frame period count. */
+  uint32_t lastJitter;                  /**< The last wake-up jitter (usec). */
+  uint32_t maxJitter;                   /**< The maximum wake-up jitter (usec). */
+} FrameSchedStats_t;
+
+/**
+ * @brief   Initialize the frame scheduler. The first frame deadline is one
+ *          frame period from now.
+ *
+ * @param fps         The target frame rate.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+int frameSchedInit(uint32_t fps);
+
+/**
+ * @brief   Restart the schedule after an idle period. The next frame deadline
+ *          is one frame period from now and the idle time is not counted as
+ *          missed deadlines.
+ */
+void frameSchedRestart(void);
+
+/**
+ * @brief   Get the target frame rate.
+ *
+ * @return  The target frame rate.
+ */
+uint32_t frameSchedGetFps(void);
+
+/**
+ * @brief   Get the next frame deadline as an absolute timeout. The deadlines
+ *          are absolute, so the render time does not add to the frame
+ *          period. When the deadline is already passed, it is counted as
+ *          missed and the schedule skips to the next deadline in the future.
+ *
+ * @return  The next frame deadline.
+ */
+k_timeout_t frameSchedGetNextDeadline(void);
+
+/**
+ * @brief   Start the frame of the reached deadline. The wake-up jitter is
+ *          recorded and the schedule moves to the next deadline.
+ */
+void frameSchedStartFrame(void);
+
+/**
+ * @brief   Get the frame timing statistics.
+ *
+ * @param stats       The output statistics.
+ */
+void frameSchedGetStats(FrameSchedStats_t *stats);
+
+/**
+ * @brief   Reset the frame timing statistics.
+ */
+void frameSchedResetStats(void);
+
+#endif    /* FRAME_SCHEDULER */
+
+/** @} */
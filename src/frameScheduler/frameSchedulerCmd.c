@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      frameSchedulerCmd.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Scheduler Command Module
+ *
+ *            This file is the implementation of the frame scheduler commands.
+ *
+ * @ingroup  frameScheduler
+ *
+ * @{
+ */
+
+#include <zephyr/shell/shell.h>
+
+#include "frameScheduler.h"
+
+/**
+ * @brief The frame command usage.
+*/
+#define FRAME_USAGE           "Frame timing related commands."
+
+/**
+ * @brief The frame stats command usage.
+*/
+#define FRAME_STATS_USAGE     "Display the frame timing statistics: frame stats"
+
+/**
+ * @brief The frame reset command usage.
+*/
+#define FRAME_RESET_USAGE     "Reset the frame timing statistics: frame reset"
+
+/**
+ * @brief   Execute the frame stats command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStats(const struct shell *shell, size_t argc, char **argv)
+{
+  FrameSchedStats_t stats;
+
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  frameSchedGetStats(&stats);
+
+  shell_print(shell, "target FPS: %u", frameSchedGetFps());
+  shell_print(shell, "frames: %u", stats.frameCount);
+  shell_print(shell, "missed deadlines: %u", stats.missedCount);
+  shell_print(shell, "overruns: %u", stats.overrunCount);
+  shell_print(shell, "last jitter: %u us", stats.lastJitter);
+  shell_print(shell, "max jitter: %u us", stats.maxJitter);
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the frame reset command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execReset(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  frameSchedResetStats();
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(frame_sub,
+  SHELL_CMD(stats, NULL, FRAME_STATS_USAGE, execStats),
+  SHELL_CMD(reset, NULL, FRAME_RESET_USAGE, execReset),
+  SHELL_SUBCMD_SET_END);
+SHELL_CMD_REGISTER(frame, &frame_sub, FRAME_USAGE, NULL);
+
+/** @} */
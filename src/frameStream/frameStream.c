@@ -0,0 +1,357 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      frameStream.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Stream Module
+ *
+ *            This file is the implementation of the frame stream module.
+ *
+ * @ingroup  frameStream
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_STREAM
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/barrier.h>
+
+#include <string.h>
+
+#include "appMsg.h"
+#include "frameStream.h"
+
+#define FRAME_STREAM_MODULE_NAME frame_stream_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(FRAME_STREAM_MODULE_NAME);
+
+#ifndef CONFIG_ZTEST
+/**
+ * @brief The frame pixel count.
+*/
+#define FRAME_STREAM_PIXEL_COUNT                                              \
+  DT_PROP(DT_ALIAS(led_strip), chain_length)
+#else
+#define FRAME_STREAM_PIXEL_COUNT                    18
+#endif
+
+BUILD_ASSERT(FRAME_STREAM_PIXEL_COUNT <= UINT16_MAX,
+  "the streamed frames address up to 65535 LEDs");
+
+BUILD_ASSERT(CONFIG_LED_MNGR_STREAM_SLOTS >= 2 &&
+  (CONFIG_LED_MNGR_STREAM_SLOTS & (CONFIG_LED_MNGR_STREAM_SLOTS - 1)) == 0,
+  "the stream slot count must be a power of 2, at least 2");
+
+/**
+ * @brief The frame slot ring. The head is only written by the producer and
+ *        the tail by the consumer.
+*/
+typedef struct
+{
+  volatile uint32_t head;               /**< The published frame count. */
+  volatile uint32_t tail;               /**< The latched frame count. */
+  volatile bool isActive;               /**< The stream started flag. */
+  bool isFrameOpen;                     /**< The producer frame in progress flag. */
+  bool isDropping;                      /**< The producer frame dropping flag. */
+  bool isInvalid;                       /**< The producer frame decoding error flag. */
+  bool isPrimed;                        /**< The consumer first frame latched flag. */
+} FrameStreamRing_t;
+
+/**
+ * @brief The slot index mask.
+*/
+#define FRAME_STREAM_SLOT_MASK                      (CONFIG_LED_MNGR_STREAM_SLOTS - 1)
+
+/**
+ * @brief The frame slots.
+*/
+static ZephyrRgbPixel_t slots[CONFIG_LED_MNGR_STREAM_SLOTS]
+  [FRAME_STREAM_PIXEL_COUNT];
+
+/**
+ * @brief The frame slot ring.
+*/
+static FrameStreamRing_t ring;
+
+/**
+ * @brief The statistics.
+*/
+static FrameStreamStats_t stats;
+
+/**
+ * @brief   Count a statistics event, the producer and the consumer updating
+ *          the statistics from their own thread.
+ *
+ * @param counter     The event counter.
+ */
+static void countEvent(uint32_t *counter)
+{
+  unsigned int key = irq_lock();
+
+  ++(*counter);
+
+  irq_unlock(key);
+}
+
+/**
+ * @brief   Get the slot of the frame in progress, opening a new frame if
+ *          needed. When every slot is full, the new frame is dropped up to
+ *          its end. A delta frame starts from the last published frame.
+ *
+ * @param isDelta     The delta frame flag.
+ *
+ * @return  The frame pixels, NULL if the frame is dropped.
+ */
+static ZephyrRgbPixel_t *getFramePixels(bool isDelta)
+{
+  if(!ring.isFrameOpen)
+  {
+    ring.isFrameOpen = true;
+    ring.isInvalid = false;
+    ring.isDropping = ring.head - ring.tail >= CONFIG_LED_MNGR_STREAM_SLOTS;
+    if(!ring.isDropping && isDelta)
+      memcpy(slots[ring.head & FRAME_STREAM_SLOT_MASK],
+        slots[(ring.head - 1) & FRAME_STREAM_SLOT_MASK], sizeof(slots[0]));
+  }
+
+  if(ring.isDropping || ring.isInvalid)
+    return NULL;
+
+  return slots[ring.head & FRAME_STREAM_SLOT_MASK];
+}
+
+/**
+ * @brief   End a write in the frame in progress. On the frame last write, the
+ *          frame is closed and published unless it was dropped.
+ *
+ * @param isLast      The frame last write flag.
+ *
+ * @return  0 if successful, -EBADMSG if the frame had a decoding error,
+ *          -ENOSPC if the frame is dropped.
+ */
+static int endWrite(bool isLast)
+{
+  if(!isLast)
+  {
+    if(ring.isInvalid)
+      return -EBADMSG;
+    return ring.isDropping ? -ENOSPC : 0;
+  }
+
+  ring.isFrameOpen = false;
+
+  if(ring.isInvalid)
+  {
+    countEvent(&stats.decodeErrorCount);
+    return -EBADMSG;
+  }
+
+  if(ring.isDropping)
+  {
+    countEvent(&stats.overrunCount);
+    return -ENOSPC;
+  }
+
+  /* The frame must be written before it is published. */
+  barrier_dmem_fence_full();
+  ++ring.head;
+
+  return 0;
+}
+
+/**
+ * @brief   Copy streamed pixels.
+ *
+ * @param pixels      The output pixels.
+ * @param rgb         The streamed pixels.
+ * @param pixelCnt    The pixel count.
+ */
+static void copyPixels(ZephyrRgbPixel_t *pixels, const uint8_t *rgb,
+  size_t pixelCnt)
+{
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    pixels[i].r = rgb[0];
+    pixels[i].g = rgb[1];
+    pixels[i].b = rgb[2];
+    rgb += FRAME_STREAM_PIXEL_SIZE;
+  }
+}
+
+/**
+ * @brief   Decode the delta operations in place into the frame pixels.
+ *
+ * @param pixels      The frame pixels.
+ * @param firstLed    The LED of the first operation.
+ * @param ops         The delta operations.
+ * @param len         The operations length.
+ *
+ * @return  0 if successful, -EBADMSG if the operations are invalid.
+ */
+static int decodeDelta(ZephyrRgbPixel_t *pixels, uint16_t firstLed,
+  const uint8_t *ops, size_t len)
+{
+  ZephyrRgbPixel_t color;
+  size_t led = firstLed;
+  size_t i = 0;
+  uint8_t count;
+  uint8_t op;
+
+  while(i < len)
+  {
+    op = ops[i++];
+    count = (op & ~FRAME_STREAM_OP_MASK) + 1;
+    if(led + count > FRAME_STREAM_PIXEL_COUNT)
+      return -EBADMSG;
+
+    switch(op & FRAME_STREAM_OP_MASK)
+    {
+      case FRAME_STREAM_OP_SKIP:
+      break;
+      case FRAME_STREAM_OP_LITERAL:
+        if(i + count * FRAME_STREAM_PIXEL_SIZE > len)
+          return -EBADMSG;
+        copyPixels(pixels + led, ops + i, count);
+        i += count * FRAME_STREAM_PIXEL_SIZE;
+      break;
+      case FRAME_STREAM_OP_RUN:
+        if(i + FRAME_STREAM_PIXEL_SIZE > len)
+          return -EBADMSG;
+        copyPixels(&color, ops + i, 1);
+        i += FRAME_STREAM_PIXEL_SIZE;
+        for(uint8_t j = 0; j < count; ++j)
+          pixels[led + j] = color;
+      break;
+      default:
+        return -EBADMSG;
+      break;
+    }
+
+    led += count;
+  }
+
+  return 0;
+}
+
+void frameStreamStart(void)
+{
+  ring.isFrameOpen = false;
+  ring.isActive = true;
+
+  appMsgNotifyLedManager();
+}
+
+void frameStreamStop(void)
+{
+  ring.isActive = false;
+
+  appMsgNotifyLedManager();
+}
+
+bool frameStreamIsActive(void)
+{
+  return ring.isActive;
+}
+
+size_t frameStreamGetPixelCount(void)
+{
+  return FRAME_STREAM_PIXEL_COUNT;
+}
+
+int frameStreamWrite(uint16_t firstLed, const uint8_t *rgb, size_t pixelCnt)
+{
+  ZephyrRgbPixel_t *pixels;
+  bool isLast;
+
+  if(!ring.isActive)
+    return -EPERM;
+
+  if(pixelCnt == 0 || firstLed + pixelCnt > FRAME_STREAM_PIXEL_COUNT)
+  {
+    LOG_ERR("invalid stream pixels: %d, %d", firstLed, pixelCnt);
+    return -EINVAL;
+  }
+
+  isLast = firstLed + pixelCnt == FRAME_STREAM_PIXEL_COUNT;
+
+  pixels = getFramePixels(false);
+  if(pixels)
+    copyPixels(pixels + firstLed, rgb, pixelCnt);
+
+  return endWrite(isLast);
+}
+
+int frameStreamWriteDelta(uint16_t firstLed, const uint8_t *ops, size_t len,
+  bool isLast)
+{
+  ZephyrRgbPixel_t *pixels;
+
+  if(!ring.isActive)
+    return -EPERM;
+
+  if(firstLed > FRAME_STREAM_PIXEL_COUNT)
+  {
+    LOG_ERR("invalid stream delta LED: %d", firstLed);
+    return -EINVAL;
+  }
+
+  pixels = getFramePixels(true);
+  if(pixels && decodeDelta(pixels, firstLed, ops, len) < 0)
+    ring.isInvalid = true;
+
+  return endWrite(isLast);
+}
+
+int frameStreamLatch(ZephyrRgbPixel_t *pixels)
+{
+  if(ring.head == ring.tail)
+  {
+    if(ring.isPrimed)
+      countEvent(&stats.underrunCount);
+    return -ENOMSG;
+  }
+
+  /* The frame must be read after its publication is seen. */
+  barrier_dmem_fence_full();
+  memcpy(pixels, slots[ring.tail & FRAME_STREAM_SLOT_MASK],
+    sizeof(slots[0]));
+
+  /* The slot must be released after it is read. */
+  barrier_dmem_fence_full();
+  ++ring.tail;
+
+  ring.isPrimed = true;
+  countEvent(&stats.frameCount);
+
+  return 0;
+}
+
+void frameStreamFlush(void)
+{
+  ring.tail = ring.head;
+  ring.isPrimed = false;
+}
+
+void frameStreamGetStats(FrameStreamStats_t *out)
+{
+  unsigned int key = irq_lock();
+
+  *out = stats;
+
+  irq_unlock(key);
+}
+
+void frameStreamResetStats(void)
+{
+  unsigned int key = irq_lock();
+
+  memset(&stats, 0x00, sizeof(stats));
+
+  irq_unlock(key);
+}
+#endif
+
+/** @} */
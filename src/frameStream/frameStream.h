@@ -0,0 +1,176 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      frameStream.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Stream Module
+ *
+ *            This file is the declaration of the frame stream module, the
+ *            raw pixel frames streamed by the main controller.
+ *
+ *            The frames go through a ring of frame slots. The producer
+ *            writes a frame in place in its slot and the frame is published
+ *            once its last LED is written. The LED manager latches the
+ *            oldest published frame on each frame deadline. The producer
+ *            and the consumer must each be a single thread.
+ *
+ *            A frame is either written raw, or as a delta of the last
+ *            published frame. A delta is a list of operations, each one an
+ *            opcode byte holding the operation in its 2 MSB and its LED
+ *            count minus 1 in its 6 LSB:
+ *            - skip: the LEDs are unchanged.
+ *            - literal: one pixel per LED follows.
+ *            - run: one pixel follows, repeated on every LED.
+ *            When a frame is dropped, the next delta must be encoded against
+ *            the last published frame, and the first frame after the stream
+ *            start must be raw.
+ *
+ * @defgroup  frameStream frameStream
+ *
+ * @{
+ */
+
+#ifndef FRAME_STREAM
+#define FRAME_STREAM
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief The streamed pixel size, in bytes (red, green, blue).
+*/
+#define FRAME_STREAM_PIXEL_SIZE                     3
+
+/**
+ * @brief The delta operation mask of an opcode.
+*/
+#define FRAME_STREAM_OP_MASK                        0xc0
+
+/**
+ * @brief The delta skip operation.
+*/
+#define FRAME_STREAM_OP_SKIP                        0x00
+
+/**
+ * @brief The delta literal operation.
+*/
+#define FRAME_STREAM_OP_LITERAL                     0x40
+
+/**
+ * @brief The delta run operation.
+*/
+#define FRAME_STREAM_OP_RUN                         0x80
+
+/**
+ * @brief The maximum LED count of a delta operation.
+*/
+#define FRAME_STREAM_OP_MAX_COUNT                   64
+
+/**
+ * @brief The frame stream statistics.
+*/
+typedef struct
+{
+  uint32_t frameCount;                  /**< The latched frame count. */
+  uint32_t underrunCount;               /**< The frame deadlines without a new frame. */
+  uint32_t overrunCount;                /**< The frames dropped while every slot was full. */
+  uint32_t decodeErrorCount;            /**< The delta frames dropped on a decoding error. */
+} FrameStreamStats_t;
+
+/**
+ * @brief   Start the stream. The LED manager bypasses the sequences until the
+ *          stream is stopped. Producer side.
+ */
+void frameStreamStart(void);
+
+/**
+ * @brief   Stop the stream. The LED manager drops the pending frames and
+ *          renders the sequences again. Producer side.
+ */
+void frameStreamStop(void);
+
+/**
+ * @brief   Check if the stream is started.
+ *
+ * @return  True if the stream is started, false otherwise.
+ */
+bool frameStreamIsActive(void);
+
+/**
+ * @brief   Get the streamed frame pixel count.
+ *
+ * @return  The frame pixel count.
+ */
+size_t frameStreamGetPixelCount(void);
+
+/**
+ * @brief   Write pixels in the current frame. The frame is published once its
+ *          last LED is written, the LEDs not written keep the content of an
+ *          older frame. When every slot is full, the frame is dropped up to
+ *          its last LED and counted as overrun. Producer side.
+ *
+ * @param firstLed    The first written LED.
+ * @param rgb         The pixels, FRAME_STREAM_PIXEL_SIZE bytes per pixel.
+ * @param pixelCnt    The pixel count.
+ *
+ * @return  0 if successful, -EPERM if the stream is not started, -EINVAL if
+ *          the pixels are out of the frame, -ENOSPC if the frame is dropped.
+ */
+int frameStreamWrite(uint16_t firstLed, const uint8_t *rgb, size_t pixelCnt);
+
+/**
+ * @brief   Decode delta operations in place into the current frame. The frame
+ *          starts from the last published frame and it is published after
+ *          its last write. When every slot is full, the frame is dropped up
+ *          to its last write and counted as overrun. When the operations are
+ *          invalid, the frame is dropped up to its last write and counted as
+ *          decoding error. Producer side.
+ *
+ * @param firstLed    The LED of the first operation.
+ * @param ops         The delta operations.
+ * @param len         The operations length.
+ * @param isLast      The frame last write flag.
+ *
+ * @return  0 if successful, -EPERM if the stream is not started, -EINVAL if
+ *          the first LED is out of the frame, -EBADMSG if the frame has a
+ *          decoding error, -ENOSPC if the frame is dropped.
+ */
+int frameStreamWriteDelta(uint16_t firstLed, const uint8_t *ops, size_t len,
+  bool isLast);
+
+/**
+ * @brief   Latch the oldest published frame. When no frame is published, the
+ *          frame deadline is counted as underrun once a first frame was
+ *          latched. Consumer side.
+ *
+ * @param pixels      The output pixels, frameStreamGetPixelCount() pixels.
+ *
+ * @return  0 if successful, -ENOMSG if no frame is published.
+ */
+int frameStreamLatch(ZephyrRgbPixel_t *pixels);
+
+/**
+ * @brief   Drop the published frames after the stream was stopped. Consumer
+ *          side.
+ */
+void frameStreamFlush(void);
+
+/**
+ * @brief   Get the frame stream statistics.
+ *
+ * @param stats       The output statistics.
+ */
+void frameStreamGetStats(FrameStreamStats_t *stats);
+
+/**
+ * @brief   Reset the frame stream statistics.
+ */
+void frameStreamResetStats(void);
+
+#endif    /* FRAME_STREAM */
+
+/** @} */
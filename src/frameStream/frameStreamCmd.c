@@ -0,0 +1,91 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      frameStreamCmd.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Stream Command Module
+ *
+ *            This file is the implementation of the frame stream commands.
+ *
+ * @ingroup  frameStream
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_STREAM
+#include <zephyr/shell/shell.h>
+
+#include "frameStream.h"
+
+/**
+ * @brief The stream command usage.
+*/
+#define STREAM_USAGE          "Raw frame stream related commands."
+
+/**
+ * @brief The stream stats command usage.
+*/
+#define STREAM_STATS_USAGE    "Display the frame stream statistics: stream stats"
+
+/**
+ * @brief The stream reset command usage.
+*/
+#define STREAM_RESET_USAGE    "Reset the frame stream statistics: stream reset"
+
+/**
+ * @brief   Execute the stream stats command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStats(const struct shell *shell, size_t argc, char **argv)
+{
+  FrameStreamStats_t stats;
+
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  frameStreamGetStats(&stats);
+
+  shell_print(shell, "active: %s", frameStreamIsActive() ? "yes" : "no");
+  shell_print(shell, "frames: %u", stats.frameCount);
+  shell_print(shell, "underruns: %u", stats.underrunCount);
+  shell_print(shell, "overruns: %u", stats.overrunCount);
+  shell_print(shell, "decoding errors: %u", stats.decodeErrorCount);
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the stream reset command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execReset(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  frameStreamResetStats();
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(stream_sub,
+  SHELL_CMD(stats, NULL, STREAM_STATS_USAGE, execStats),
+  SHELL_CMD(reset, NULL, STREAM_RESET_USAGE, execReset),
+  SHELL_SUBCMD_SET_END);
+SHELL_CMD_REGISTER(stream, &stream_sub, STREAM_USAGE, NULL);
+#endif
+
+/** @} */
@@ -0,0 +1,796 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      hostLink.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Host Link Module
+ *
+ *            This file is the implementation of the host link module.
+ *
+ * @ingroup  hostLink
+ *
+ * @{
+ */
+
+#ifdef CONFIG_HOST_LINK
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/crc.h>
+
+#include <string.h>
+
+#include "appMsg.h"
+#include "compositor.h"
+#include "effectVm.h"
+#include "frameStream.h"
+#include "hostLink.h"
+#include "ledManager.h"
+#include "timeline.h"
+#include "zephyrThread.h"
+
+#define HOST_LINK_MODULE_NAME host_link_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(HOST_LINK_MODULE_NAME);
+
+/**
+ * @brief The thread name.
+*/
+#define HOST_LINK_THREAD_NAME                       "hostLink"
+
+/**
+ * @brief The thread priority, below the LED manager so the frames keep
+ *        their timing.
+*/
+#define HOST_LINK_PRIORITY                          2
+
+/**
+ * @brief The frame delimiter.
+*/
+#define HOST_LINK_FRAME_DELIMITER                   0x00
+
+/**
+ * @brief The frame command size.
+*/
+#define HOST_LINK_CMD_SIZE                          1
+
+/**
+ * @brief The frame CRC size.
+*/
+#define HOST_LINK_CRC_SIZE                          2
+
+/**
+ * @brief The frame CRC seed.
+*/
+#define HOST_LINK_CRC_SEED                          0xffff
+
+/**
+ * @brief The maximum decoded frame size.
+*/
+#define HOST_LINK_MAX_FRAME_SIZE                                              \
+  (HOST_LINK_CMD_SIZE + CONFIG_HOST_LINK_MAX_PAYLOAD + HOST_LINK_CRC_SIZE)
+
+/**
+ * @brief   Get the maximum COBS encoded size of a frame, without delimiter.
+ *
+ * @param size    The decoded frame size.
+*/
+#define HOST_LINK_COBS_SIZE(size)                   ((size) + (size) / 254 + 1)
+
+/**
+ * @brief The reply frame size.
+*/
+#define HOST_LINK_REPLY_SIZE                                                  \
+  (HOST_LINK_CMD_SIZE + sizeof(int8_t) + HOST_LINK_CRC_SIZE)
+
+/**
+ * @brief The RX buffer count.
+*/
+#define HOST_LINK_RX_BUFFER_COUNT                   2
+
+K_THREAD_STACK_DEFINE(hostLink_stack, CONFIG_HOST_LINK_STACK_SIZE);
+
+/**
+ * @brief The RX frame semaphore, given when a frame is received.
+*/
+K_SEM_DEFINE(rxFrameSem, 0, 1);
+
+/**
+ * @brief The COBS encoded RX frame buffer.
+*/
+typedef struct
+{
+  uint8_t data[HOST_LINK_COBS_SIZE(HOST_LINK_MAX_FRAME_SIZE)];  /**< The encoded frame. */
+  size_t len;                           /**< The encoded frame length. */
+} HostLinkRxBuffer_t;
+
+/**
+ * @brief The RX buffers, filled by the UART ISR and processed by the thread.
+ *        The head is only written by the ISR and the tail by the thread.
+*/
+typedef struct
+{
+  HostLinkRxBuffer_t buffers[HOST_LINK_RX_BUFFER_COUNT];  /**< The frame buffers. */
+  volatile uint32_t head;               /**< The received frame count. */
+  volatile uint32_t tail;               /**< The processed frame count. */
+  bool isDiscarding;                    /**< The frame discarding flag. */
+} HostLinkRx_t;
+
+#ifndef CONFIG_ZTEST
+/**
+ * @brief The host link UART.
+*/
+static const struct device *uartDev = DEVICE_DT_GET(DT_ALIAS(host_link));
+#else
+static const struct device *uartDev;
+#endif
+
+/**
+ * @brief The thread data structure.
+*/
+static ZephyrThread_t thread = {
+  .stack = hostLink_stack,
+  .stackSize = K_THREAD_STACK_SIZEOF(hostLink_stack),
+  .priority = HOST_LINK_PRIORITY,
+};
+
+/**
+ * @brief The RX buffers.
+*/
+static HostLinkRx_t rx;
+
+/**
+ * @brief The statistics.
+*/
+static HostLinkStats_t stats;
+
+/**
+ * @brief The decoded frame, kept out of the thread stack. Only the thread
+ *        decodes the frames.
+*/
+static uint8_t rxFrame[HOST_LINK_MAX_FRAME_SIZE];
+
+/**
+ * @brief   Count a statistics event from the thread, the ISR updating the
+ *          statistics too.
+ *
+ * @param counter     The event counter.
+ */
+static void countEvent(uint32_t *counter)
+{
+  unsigned int key = irq_lock();
+
+  ++(*counter);
+
+  irq_unlock(key);
+}
+
+/**
+ * @brief   Encode a frame with COBS.
+ *
+ * @param data        The frame to encode.
+ * @param len         The frame length.
+ * @param encoded     The output encoded frame, HOST_LINK_COBS_SIZE(len) bytes.
+ *
+ * @return  The encoded frame length.
+ */
+static size_t cobsEncode(const uint8_t *data, size_t len, uint8_t *encoded)
+{
+  size_t codeIdx = 0;
+  size_t outIdx = 1;
+  uint8_t code = 1;
+
+  for(size_t i = 0; i < len; ++i)
+  {
+    if(data[i] != HOST_LINK_FRAME_DELIMITER)
+    {
+      encoded[outIdx++] = data[i];
+      ++code;
+    }
+
+    if(data[i] == HOST_LINK_FRAME_DELIMITER || code == 0xff)
+    {
+      encoded[codeIdx] = code;
+      codeIdx = outIdx++;
+      code = 1;
+    }
+  }
+
+  encoded[codeIdx] = code;
+
+  return outIdx;
+}
+
+/**
+ * @brief   Decode a COBS encoded frame.
+ *
+ * @param encoded     The encoded frame, without delimiter.
+ * @param len         The encoded frame length.
+ * @param data        The output frame.
+ * @param maxLen      The output frame maximum length.
+ *
+ * @return  The frame length if successful, -EBADMSG if the encoding is
+ *          invalid, -EMSGSIZE if the frame is too long.
+ */
+static int cobsDecode(const uint8_t *encoded, size_t len, uint8_t *data,
+  size_t maxLen)
+{
+  size_t outIdx = 0;
+  size_t i = 0;
+  uint8_t code;
+
+  while(i < len)
+  {
+    code = encoded[i++];
+    if(code == HOST_LINK_FRAME_DELIMITER || i + code - 1 > len)
+      return -EBADMSG;
+
+    if(outIdx + code - 1 > maxLen)
+      return -EMSGSIZE;
+
+    for(uint8_t j = 1; j < code; ++j)
+      data[outIdx++] = encoded[i++];
+
+    if(code < 0xff && i < len)
+    {
+      if(outIdx == maxLen)
+        return -EMSGSIZE;
+      data[outIdx++] = HOST_LINK_FRAME_DELIMITER;
+    }
+  }
+
+  return outIdx;
+}
+
+/**
+ * @brief   Append the CRC to a frame.
+ *
+ * @param frame       The frame.
+ * @param len         The frame length, without CRC.
+ *
+ * @return  The frame length with CRC.
+ */
+static size_t appendCrc(uint8_t *frame, size_t len)
+{
+  uint16_t crc = crc16_itu_t(HOST_LINK_CRC_SEED, frame, len);
+
+  frame[len] = crc & 0xff;
+  frame[len + 1] = crc >> 8;
+
+  return len + HOST_LINK_CRC_SIZE;
+}
+
+/**
+ * @brief   Send a reply frame.
+ *
+ * @param cmd         The replied command.
+ * @param status      The command status.
+ */
+static void sendReply(uint8_t cmd, int status)
+{
+  uint8_t frame[HOST_LINK_REPLY_SIZE];
+  uint8_t encoded[HOST_LINK_COBS_SIZE(HOST_LINK_REPLY_SIZE)];
+  size_t len;
+
+  frame[0] = cmd | HOST_LINK_REPLY_FLAG;
+  frame[1] = (uint8_t)(int8_t)status;
+  len = appendCrc(frame, HOST_LINK_CMD_SIZE + sizeof(int8_t));
+  len = cobsEncode(frame, len, encoded);
+
+  for(size_t i = 0; i < len; ++i)
+    uart_poll_out(uartDev, encoded[i]);
+  uart_poll_out(uartDev, HOST_LINK_FRAME_DELIMITER);
+}
+
+/**
+ * @brief   Execute the LED sequence command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execSequence(const uint8_t *payload, size_t len)
+{
+  LedSequence_t seq;
+
+  if(len != sizeof(seq))
+    return -EMSGSIZE;
+
+  memcpy(&seq, payload, sizeof(seq));
+
+  return appMsgPushLedSequence(&seq);
+}
+
+/**
+ * @brief   Execute the LED sequence batch command. The sequences are staged in
+ *          a transaction and committed at once, none is applied if one is
+ *          invalid.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execSequenceBatch(const uint8_t *payload, size_t len)
+{
+  LedTransaction_t trans;
+  LedSequence_t seq;
+  int rc;
+
+  if(len == 0 || len % sizeof(seq) != 0 ||
+    len / sizeof(seq) > APP_MSG_LED_SECTION_COUNT)
+    return -EMSGSIZE;
+
+  appMsgBeginLedTransaction(&trans);
+
+  for(size_t i = 0; i < len; i += sizeof(seq))
+  {
+    memcpy(&seq, payload + i, sizeof(seq));
+    rc = appMsgStageLedSequence(&trans, &seq);
+    if(rc < 0)
+      return rc;
+  }
+
+  return appMsgCommitLedTransaction(&trans);
+}
+
+#ifdef CONFIG_LED_MNGR_STREAM
+/**
+ * @brief   Execute the frame stream command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execStream(const uint8_t *payload, size_t len)
+{
+  if(len != 1)
+    return -EMSGSIZE;
+
+  switch(payload[0])
+  {
+    case 0:
+      frameStreamStop();
+    break;
+    case 1:
+      frameStreamStart();
+    break;
+    default:
+      return -EINVAL;
+    break;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the stream frame chunk command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execFrame(const uint8_t *payload, size_t len)
+{
+  uint16_t firstLed;
+
+  if(len <= sizeof(firstLed) ||
+    (len - sizeof(firstLed)) % FRAME_STREAM_PIXEL_SIZE != 0)
+    return -EMSGSIZE;
+
+  firstLed = payload[0] | payload[1] << 8;
+
+  return frameStreamWrite(firstLed, payload + sizeof(firstLed),
+    (len - sizeof(firstLed)) / FRAME_STREAM_PIXEL_SIZE);
+}
+
+/**
+ * @brief   Execute the stream frame delta command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execFrameDelta(const uint8_t *payload, size_t len)
+{
+  const size_t headerLen = sizeof(uint8_t) + sizeof(uint16_t);
+  uint16_t firstLed;
+
+  if(len < headerLen)
+    return -EMSGSIZE;
+
+  firstLed = payload[1] | payload[2] << 8;
+
+  return frameStreamWriteDelta(firstLed, payload + headerLen, len - headerLen,
+    payload[0] & HOST_LINK_DELTA_LAST_FLAG);
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_TIMELINE
+/**
+ * @brief   Execute the timeline show command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execTimeline(const uint8_t *payload, size_t len)
+{
+  if(len != 1)
+    return -EMSGSIZE;
+
+  switch(payload[0])
+  {
+    case 0:
+      timelineStop();
+    break;
+    case 1:
+      return timelinePlay();
+    break;
+    default:
+      return -EINVAL;
+    break;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the timeline show chunk command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execTimelineWrite(const uint8_t *payload, size_t len)
+{
+  uint16_t offset;
+
+  if(len <= sizeof(offset))
+    return -EMSGSIZE;
+
+  offset = payload[0] | payload[1] << 8;
+
+  return timelineWrite(offset, payload + sizeof(offset),
+    len - sizeof(offset));
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+/**
+ * @brief   Execute the effect program chunk command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execProgramWrite(const uint8_t *payload, size_t len)
+{
+  uint16_t offset;
+
+  if(len <= sizeof(offset))
+    return -EMSGSIZE;
+
+  offset = payload[0] | payload[1] << 8;
+
+  return effectVmWrite(offset, payload + sizeof(offset),
+    len - sizeof(offset));
+}
+
+/**
+ * @brief   Execute the effect program load command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execProgramLoad(const uint8_t *payload, size_t len)
+{
+  if(len != sizeof(uint16_t))
+    return -EMSGSIZE;
+
+  return effectVmLoad(payload[0] | payload[1] << 8);
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+/**
+ * @brief   Execute the overlay layer command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execLayer(const uint8_t *payload, size_t len)
+{
+  CompositorLayer_t layer;
+
+  if(len != sizeof(layer))
+    return -EMSGSIZE;
+
+  memcpy(&layer, payload, sizeof(layer));
+
+  return compositorSetLayer(&layer);
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+/**
+ * @brief   Execute the transition time command.
+ *
+ * @param payload     The command payload.
+ * @param len         The payload length.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execTransition(const uint8_t *payload, size_t len)
+{
+  if(len != sizeof(uint16_t))
+    return -EMSGSIZE;
+
+  ledMngrSetTransitionTime(payload[0] | payload[1] << 8);
+
+  return 0;
+}
+#endif
+
+/**
+ * @brief   Decode, check and execute a received frame. A frame with a bad
+ *          encoding or CRC is counted and dropped without reply.
+ *
+ * @param encoded     The COBS encoded frame, without delimiter.
+ * @param len         The encoded frame length.
+ *
+ * @return  The command status if the frame is valid, the error code
+ *          otherwise.
+ */
+static int processFrame(const uint8_t *encoded, size_t len)
+{
+  uint8_t *frame = rxFrame;
+  const uint8_t *payload = frame + HOST_LINK_CMD_SIZE;
+  size_t payloadLen;
+  uint16_t crc;
+  int frameLen;
+  int rc;
+
+  frameLen = cobsDecode(encoded, len, frame, sizeof(rxFrame));
+  if(frameLen < HOST_LINK_CMD_SIZE + HOST_LINK_CRC_SIZE)
+  {
+    countEvent(&stats.framingErrorCount);
+    return frameLen < 0 ? frameLen : -EBADMSG;
+  }
+
+  payloadLen = frameLen - HOST_LINK_CMD_SIZE - HOST_LINK_CRC_SIZE;
+  crc = payload[payloadLen] | payload[payloadLen + 1] << 8;
+  if(crc16_itu_t(HOST_LINK_CRC_SEED, frame, frameLen - HOST_LINK_CRC_SIZE) !=
+    crc)
+  {
+    countEvent(&stats.crcErrorCount);
+    return -EILSEQ;
+  }
+
+  countEvent(&stats.frameCount);
+
+  switch(frame[0])
+  {
+    case HOST_LINK_CMD_PING:
+      rc = payloadLen == 0 ? 0 : -EMSGSIZE;
+    break;
+    case HOST_LINK_CMD_SEQUENCE:
+      rc = execSequence(payload, payloadLen);
+    break;
+    case HOST_LINK_CMD_SEQUENCE_BATCH:
+      rc = execSequenceBatch(payload, payloadLen);
+    break;
+#ifdef CONFIG_LED_MNGR_STREAM
+    case HOST_LINK_CMD_STREAM:
+      rc = execStream(payload, payloadLen);
+    break;
+    case HOST_LINK_CMD_FRAME:
+      rc = execFrame(payload, payloadLen);
+    break;
+    case HOST_LINK_CMD_FRAME_DELTA:
+      rc = execFrameDelta(payload, payloadLen);
+    break;
+#endif
+#ifdef CONFIG_LED_MNGR_TIMELINE
+    case HOST_LINK_CMD_TIMELINE:
+      rc = execTimeline(payload, payloadLen);
+    break;
+    case HOST_LINK_CMD_TIMELINE_WRITE:
+      rc = execTimelineWrite(payload, payloadLen);
+    break;
+#endif
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+    case HOST_LINK_CMD_PROGRAM_WRITE:
+      rc = execProgramWrite(payload, payloadLen);
+    break;
+    case HOST_LINK_CMD_PROGRAM_LOAD:
+      rc = execProgramLoad(payload, payloadLen);
+    break;
+#endif
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+    case HOST_LINK_CMD_LAYER:
+      rc = execLayer(payload, payloadLen);
+    break;
+#endif
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+    case HOST_LINK_CMD_TRANSITION:
+      rc = execTransition(payload, payloadLen);
+    break;
+#endif
+    default:
+      rc = -ENOTSUP;
+    break;
+  }
+
+  sendReply(frame[0], rc);
+
+  return rc;
+}
+
+/**
+ * @brief   Store a received byte in the current RX buffer. The frame is handed
+ *          over to the thread on its delimiter. When every RX buffer is
+ *          waiting to be processed, or the frame is too long, the frame is
+ *          discarded up to its delimiter.
+ *
+ * @param byte        The received byte.
+ */
+static void receiveByte(uint8_t byte)
+{
+  HostLinkRxBuffer_t *buffer = rx.buffers +
+    (rx.head % HOST_LINK_RX_BUFFER_COUNT);
+
+  if(byte == HOST_LINK_FRAME_DELIMITER)
+  {
+    /* With every buffer pending, the current buffer is still queued. */
+    if(!rx.isDiscarding && rx.head - rx.tail >= HOST_LINK_RX_BUFFER_COUNT)
+      ++stats.overrunCount;
+    else if(!rx.isDiscarding && buffer->len > 0)
+    {
+      /* The frame must be written before it is handed over. */
+      barrier_dmem_fence_full();
+      ++rx.head;
+      k_sem_give(&rxFrameSem);
+    }
+    rx.isDiscarding = false;
+    return;
+  }
+
+  if(rx.isDiscarding)
+    return;
+
+  if(rx.head - rx.tail >= HOST_LINK_RX_BUFFER_COUNT)
+  {
+    ++stats.overrunCount;
+    rx.isDiscarding = true;
+    return;
+  }
+
+  if(buffer->len == sizeof(buffer->data))
+  {
+    ++stats.framingErrorCount;
+    buffer->len = 0;
+    rx.isDiscarding = true;
+    return;
+  }
+
+  buffer->data[buffer->len++] = byte;
+}
+
+/**
+ * @brief   The UART ISR, storing the received bytes.
+ *
+ * @param dev         The UART device.
+ * @param userData    The user data.
+ */
+static void uartIsr(const struct device *dev, void *userData)
+{
+  uint8_t byte;
+
+  ARG_UNUSED(userData);
+
+  if(!uart_irq_update(dev))
+    return;
+
+  while(uart_irq_rx_ready(dev) && uart_fifo_read(dev, &byte, 1) == 1)
+    receiveByte(byte);
+}
+
+/**
+ * @brief   Process the received frames.
+ */
+static void processPendingFrames(void)
+{
+  HostLinkRxBuffer_t *buffer;
+
+  while(rx.tail != rx.head)
+  {
+    /* The frame must be read after its hand-over is seen. */
+    barrier_dmem_fence_full();
+    buffer = rx.buffers + (rx.tail % HOST_LINK_RX_BUFFER_COUNT);
+
+    processFrame(buffer->data, buffer->len);
+    buffer->len = 0;
+
+    /* The buffer must be released after it is processed. */
+    barrier_dmem_fence_full();
+    ++rx.tail;
+  }
+}
+
+/**
+ * @brief   The host link thread.
+ *
+ * @param p1          First user parameter.
+ * @param p2          Second user parameter.
+ * @param p3          Third user parameter.
+ */
+static void hostLinkThread(void *p1, void *p2, void *p3)
+{
+  while(true)
+  {
+    k_sem_take(&rxFrameSem, K_FOREVER);
+    processPendingFrames();
+  }
+}
+
+int hostLinkInit(void)
+{
+  int rc;
+
+  if(!device_is_ready(uartDev))
+  {
+    LOG_ERR("the host link UART is not ready");
+    return -ENODEV;
+  }
+
+  rc = uart_irq_callback_user_data_set(uartDev, uartIsr, NULL);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to set the host link UART ISR");
+    return rc;
+  }
+
+  thread.entry = hostLinkThread;
+  zephyrThreadCreate(&thread, HOST_LINK_THREAD_NAME, ZEPHYR_TIME_NO_WAIT,
+    MILLI_SEC);
+
+  uart_irq_rx_enable(uartDev);
+
+  return 0;
+}
+
+void hostLinkGetStats(HostLinkStats_t *out)
+{
+  unsigned int key = irq_lock();
+
+  *out = stats;
+
+  irq_unlock(key);
+}
+
+void hostLinkResetStats(void)
+{
+  unsigned int key = irq_lock();
+
+  memset(&stats, 0x00, sizeof(stats));
+
+  irq_unlock(key);
+}
+#endif
+
+/** @} */
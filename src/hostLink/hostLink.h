@@ -0,0 +1,89 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      hostLink.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Host Link Module
+ *
+ *            This file is the declaration of the host link module, the
+ *            binary protocol of the main controller on USART2.
+ *
+ *            A frame is COBS encoded and ends with a 0x00 delimiter. Once
+ *            decoded, it holds a command byte, the command payload and the
+ *            CRC-16/CCITT-FALSE (little-endian) of the command and payload.
+ *            Each valid frame gets a reply frame holding the command with
+ *            HOST_LINK_REPLY_FLAG set and the signed status of the command.
+ *
+ * @defgroup  hostLink hostLink
+ *
+ * @{
+ */
+
+#ifndef HOST_LINK
+#define HOST_LINK
+
+#include <stdint.h>
+
+/**
+ * @brief The reply flag of the reply command byte.
+*/
+#define HOST_LINK_REPLY_FLAG                        0x80
+
+/**
+ * @brief The frame last write flag of the stream frame delta command.
+*/
+#define HOST_LINK_DELTA_LAST_FLAG                   0x01
+
+/**
+ * @brief The host link commands.
+*/
+typedef enum
+{
+  HOST_LINK_CMD_PING = 0x01,            /**< The ping command, no payload. */
+  HOST_LINK_CMD_SEQUENCE = 0x02,        /**< The LED sequence command, a LedSequence_t payload. */
+  HOST_LINK_CMD_STREAM = 0x03,          /**< The frame stream command, a start (1) or stop (0) byte payload. */
+  HOST_LINK_CMD_FRAME = 0x04,           /**< The stream frame chunk command, a little-endian first LED and RGB pixels payload. */
+  HOST_LINK_CMD_FRAME_DELTA = 0x05,     /**< The stream frame delta command, a flags byte, a little-endian first LED and delta operations payload. */
+  HOST_LINK_CMD_SEQUENCE_BATCH = 0x06,  /**< The LED sequence batch command, one LedSequence_t per section payload, applied on the same frame. */
+  HOST_LINK_CMD_TIMELINE = 0x07,        /**< The timeline show command, a play (1) or stop (0) byte payload. */
+  HOST_LINK_CMD_TIMELINE_WRITE = 0x08,  /**< The timeline show chunk command, a little-endian offset and show bytes payload. */
+  HOST_LINK_CMD_PROGRAM_WRITE = 0x09,   /**< The effect program chunk command, a little-endian offset and program bytes payload. */
+  HOST_LINK_CMD_PROGRAM_LOAD = 0x0a,    /**< The effect program load command, a little-endian program length payload. */
+  HOST_LINK_CMD_LAYER = 0x0b,           /**< The overlay layer command, a CompositorLayer_t payload. */
+  HOST_LINK_CMD_TRANSITION = 0x0c,      /**< The transition time command, a little-endian time (ms) payload. */
+} HostLinkCmd_t;
+
+/**
+ * @brief The host link statistics.
+*/
+typedef struct
+{
+  uint32_t frameCount;                  /**< The valid frame count. */
+  uint32_t crcErrorCount;               /**< The CRC error count. */
+  uint32_t framingErrorCount;           /**< The COBS or frame size error count. */
+  uint32_t overrunCount;                /**< The frames dropped while the RX buffers were full. */
+} HostLinkStats_t;
+
+/**
+ * @brief   Initialize the host link and start receiving frames.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+int hostLinkInit(void);
+
+/**
+ * @brief   Get the host link statistics.
+ *
+ * @param stats       The output statistics.
+ */
+void hostLinkGetStats(HostLinkStats_t *stats);
+
+/**
+ * @brief   Reset the host link statistics.
+ */
+void hostLinkResetStats(void);
+
+#endif    /* HOST_LINK */
+
+/** @} */
@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      hostLinkCmd.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Host Link Command Module
+ *
+ *            This file is the implementation of the host link commands.
+ *
+ * @ingroup  hostLink
+ *
+ * @{
+ */
+
+#ifdef CONFIG_HOST_LINK
+#include <zephyr/shell/shell.h>
+
+#include "hostLink.h"
+
+/**
+ * @brief The link command usage.
+*/
+#define LINK_USAGE            "Host link related commands."
+
+/**
+ * @brief The link stats command usage.
+*/
+#define LINK_STATS_USAGE      "Display the host link statistics: link stats"
+
+/**
+ * @brief The link reset command usage.
+*/
+#define LINK_RESET_USAGE      "Reset the host link statistics: link reset"
+
+/**
+ * @brief   Execute the link stats command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStats(const struct shell *shell, size_t argc, char **argv)
+{
+  HostLinkStats_t stats;
+
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  hostLinkGetStats(&stats);
+
+  shell_print(shell, "frames: %u", stats.frameCount);
+  shell_print(shell, "CRC errors: %u", stats.crcErrorCount);
+  shell_print(shell, "framing errors: %u", stats.framingErrorCount);
+  shell_print(shell, "overruns: %u", stats.overrunCount);
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the link reset command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execReset(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  hostLinkResetStats();
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(link_sub,
+  SHELL_CMD(stats, NULL, LINK_STATS_USAGE, execStats),
+  SHELL_CMD(reset, NULL, LINK_RESET_USAGE, execReset),
+  SHELL_SUBCMD_SET_END);
+SHELL_CMD_REGISTER(link, &link_sub, LINK_USAGE, NULL);
+#endif
+
+/** @} */
@@ -15,9 +15,21 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/drivers/led_strip.h>
+
+#include <string.h>
 
 #include "appMsg.h"
+#include "colorManager.h"
+#include "compositor.h"
+#include "effectVm.h"
+#include "frameScheduler.h"
+#include "frameStream.h"
+#include "ledManager.h"
+#include "powerLimiter.h"
 #include "sequenceManager.h"
+#include "timeline.h"
+#include "ws2812Encoder.h"
 #include "zephyrLedStrip.h"
 #include "zephyrThread.h"
 
@@ -32,36 +44,121 @@ LOG_MODULE_REGISTER(LED_MNGR_MODULE_NAME);
 #define LED_MNGR_THREAD_NAME                        "ledMngr"
 
 /**
- * @brief The thread stack size.
+ * @brief The thread priority.
 */
-#define LED_MNGR_STACK_SIZE                         256
+#define LED_MNGR_PRIORITY                           1
+
+K_THREAD_STACK_DEFINE(ledMngr_stack, CONFIG_LED_MNGR_STACK_SIZE);
 
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
 /**
- * @brief The thread priority.
+ * @brief The transfer thread name.
 */
-#define LED_MNGR_PRIORITY                           1
+#define LED_MNGR_TX_THREAD_NAME                     "ledMngrTx"
 
 /**
- * @brief The thread default sleep time.
+ * @brief The transfer thread priority, above the render thread so the
+ *        transfer starts as soon as a frame is ready.
 */
-#define LED_MNGR_DEFAULT_SLEEP                      100
+#define LED_MNGR_TX_PRIORITY                        0
 
-K_THREAD_STACK_DEFINE(ledMngr_stack, LED_MNGR_STACK_SIZE);
+K_THREAD_STACK_DEFINE(ledMngrTx_stack, CONFIG_LED_MNGR_TX_STACK_SIZE);
+
+/**
+ * @brief The transfer ready semaphore, given when the front buffer holds a
+ *        new frame to send.
+*/
+K_SEM_DEFINE(txReadySem, 0, 1);
+
+/**
+ * @brief The transfer done semaphore, given when the front buffer was sent.
+*/
+K_SEM_DEFINE(txDoneSem, 1, 1);
+#endif
+
+/**
+ * @brief The LED strip section.
+*/
+typedef struct
+{
+  const char *name;             /**< The section name. */
+  uint32_t firstLed;            /**< The strip ID of the section first LED. */
+  uint32_t lastLed;             /**< The strip ID of the section last LED. */
+} LedSection_t;
+
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+/**
+ * @brief The overlay layer of a section.
+*/
+typedef struct
+{
+  CompositorLayer_t config;     /**< The layer configuration and sequence. */
+  Color_t startColor;           /**< The unpacked sequence start color. */
+  Color_t endColor;             /**< The unpacked sequence end color. */
+  SequenceContext_t seqCtx;     /**< The sequence context. */
+  bool reset;                   /**< The reset flag, set when the layer is set. */
+} LedLayer_t;
+#endif
 
 #ifndef CONFIG_ZTEST
+/**
+ * @brief   Check the LED strip section range at build time.
+ *
+ * @param node    The section node.
+*/
+#define LED_MNGR_SECTION_CHECK(node)                                          \
+  BUILD_ASSERT(DT_PROP(node, first_led) <= DT_PROP(node, last_led) &&         \
+    DT_PROP(node, last_led) < DT_PROP(DT_ALIAS(led_strip), chain_length),     \
+    "invalid LED strip section range");
+
+/**
+ * @brief   Generate the LED strip section table entry.
+ *
+ * @param node    The section node.
+*/
+#define LED_MNGR_SECTION_ENTRY(node)                                          \
+  {                                                                           \
+    .name = DT_PROP(node, label),                                             \
+    .firstLed = DT_PROP(node, first_led),                                     \
+    .lastLed = DT_PROP(node, last_led),                                       \
+  },
+
+/**
+ * @brief The LED strip pixel count.
+*/
+#define LED_MNGR_PIXEL_COUNT                                                  \
+  DT_PROP(DT_ALIAS(led_strip), chain_length)
+
 static ZephyrLedStrip_t ledStrip = {
   .dev = DEVICE_DT_GET(DT_ALIAS(led_strip)),
-  .pixelCount = DT_PROP(DT_ALIAS(led_strip), chain_length),
+  .pixelCount = LED_MNGR_PIXEL_COUNT,
+};
+
+DT_FOREACH_CHILD(DT_ALIAS(led_strip), LED_MNGR_SECTION_CHECK)
+
+/**
+ * @brief The LED strip sections, indexed by section ID.
+*/
+static const LedSection_t sections[] = {
+  DT_FOREACH_CHILD(DT_ALIAS(led_strip), LED_MNGR_SECTION_ENTRY)
 };
 #else
+#define LED_MNGR_PIXEL_COUNT                        18
+
 static ZephyrLedStrip_t ledStrip;
+
+static const LedSection_t sections[] = {
+  {.name = "left", .firstLed = 0, .lastLed = 8},
+  {.name = "right", .firstLed = 9, .lastLed = 17},
+};
 #endif
 
-typedef struct
-{
-  uint32_t firstLed;            /**< The strip ID of the section first LED. */
-  uint32_t lastLed;             /**< The strip ID of the section last LED. */
-} LedSection_t;
+/**
+ * @brief The LED strip section count.
+*/
+#define LED_MNGR_SECTION_COUNT                      ARRAY_SIZE(sections)
+
+BUILD_ASSERT(LED_MNGR_SECTION_COUNT > 0, "the LED strip has no section");
 
 /**
  * @brief The Thread data structure.
@@ -72,89 +169,933 @@ ZephyrThread_t thread = {
   .priority = LED_MNGR_PRIORITY,
 };
 
-LedSection_t section;
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+/**
+ * @brief The transfer thread data structure.
+*/
+static ZephyrThread_t txThread = {
+  .stack = ledMngrTx_stack,
+  .stackSize = K_THREAD_STACK_SIZEOF(ledMngrTx_stack),
+  .priority = LED_MNGR_TX_PRIORITY,
+};
+
+/**
+ * @brief The second frame buffer.
+*/
+static ZephyrRgbPixel_t framePixels[LED_MNGR_PIXEL_COUNT];
 
 /**
- * @brief   The LED manager thread.
+ * @brief The front buffer, sent to the LED strip.
+*/
+static ZephyrRgbPixel_t *frontPixels;
+#endif
+
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+/**
+ * @brief The SPI symbols of the strip, kept between frames so only the
+ *        dirty sections are encoded.
+*/
+static uint32_t spiSymbols[LED_MNGR_PIXEL_COUNT * WS2812_ENC_WORDS_PER_LED];
+#endif
+
+#if (defined(CONFIG_LED_MNGR_GAMMA) || defined(CONFIG_LED_MNGR_POWER_LIMIT)) && \
+  !defined(CONFIG_LED_MNGR_DOUBLE_BUFFER) && !defined(CONFIG_LED_MNGR_SPI_ENCODER)
+/**
+ * @brief The output stages are applied through the output pixels.
+*/
+#define LED_MNGR_OUTPUT_PIXELS
+
+/**
+ * @brief The output frame, gamma corrected and scaled to the current budget,
+ *        sent to the LED strip. The back buffer stays linear at full level,
+ *        the sequences updating their pixels in place.
+*/
+static ZephyrRgbPixel_t outputPixels[LED_MNGR_PIXEL_COUNT];
+#endif
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+/**
+ * @brief The power limiter scale of the last refreshed frame.
+*/
+static uint16_t powerScale = POWER_LIMITER_SCALE_ONE;
+#endif
+
+/**
+ * @brief The back buffer, the sections are rendered into.
+*/
+static ZephyrRgbPixel_t *backPixels;
+
+/**
+ * @brief The sequence of each section.
+*/
+static LedSequence_t sequences[LED_MNGR_SECTION_COUNT];
+
+/**
+ * @brief The unpacked start color of each section sequence.
+*/
+static Color_t startColors[LED_MNGR_SECTION_COUNT];
+
+/**
+ * @brief The unpacked end color of each section sequence.
+*/
+static Color_t endColors[LED_MNGR_SECTION_COUNT];
+
+/**
+ * @brief The sequence context of each section.
+*/
+static SequenceContext_t seqCtxs[LED_MNGR_SECTION_COUNT];
+
+/**
+ * @brief The dirty flag of each section, set when its pixels were updated
+ *        since the last strip refresh.
+*/
+static bool dirties[LED_MNGR_SECTION_COUNT];
+
+/**
+ * @brief The reset flag of each section, set when a new sequence is applied.
+*/
+static bool resets[LED_MNGR_SECTION_COUNT];
+
+/**
+ * @brief The idle flag, set when every section is static.
+*/
+static bool isIdle;
+
+#ifdef CONFIG_LED_MNGR_STREAM
+/**
+ * @brief The streaming flag, set while the frame stream is started.
+*/
+static bool isStreaming;
+#endif
+
+#ifdef CONFIG_LED_MNGR_TIMELINE
+/**
+ * @brief The show playing flag, set while the timeline show is played.
+*/
+static bool isShowPlaying;
+#endif
+
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+/**
+ * @brief The effect program context of each section.
+*/
+static EffectVmCtx_t vmCtxs[LED_MNGR_SECTION_COUNT];
+#endif
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+/**
+ * @brief The transition time in milliseconds, 0 for a hard cut.
+*/
+static volatile uint16_t transitionMs = CONFIG_LED_MNGR_CROSSFADE_TIME;
+
+/**
+ * @brief The transition pixels. A section in transition renders its new
+ *        sequence into its span, while its back buffer span moves from the
+ *        last frame of the old sequence toward it.
+*/
+static ZephyrRgbPixel_t fadePixels[LED_MNGR_PIXEL_COUNT];
+
+/**
+ * @brief The remaining transition frame count of each section, 0 when the
+ *        section is not in transition.
+*/
+static uint16_t fadeFrames[LED_MNGR_SECTION_COUNT];
+#endif
+
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+/**
+ * @brief The overlay layers of each section.
+*/
+static LedLayer_t layers[LED_MNGR_SECTION_COUNT][CONFIG_LED_MNGR_COMPOSITOR_LAYERS];
+
+/**
+ * @brief The layer pixels of the sections with an overlay: the section
+ *        sequences, then each overlay layer. They keep the layer frames
+ *        between 2 renderings, the sequences updating their pixels in place.
+*/
+static ZephyrRgbPixel_t layerPixels[CONFIG_LED_MNGR_COMPOSITOR_LAYERS + 1][LED_MNGR_PIXEL_COUNT];
+
+/**
+ * @brief   Check if a section has an enabled overlay layer.
+ *
+ * @param sectionId   The section ID.
+ *
+ * @return  True if the section has an overlay, false otherwise.
+ */
+static bool hasOverlay(uint8_t sectionId)
+{
+  for(uint8_t i = 0; i < CONFIG_LED_MNGR_COMPOSITOR_LAYERS; ++i)
+  {
+    if(layers[sectionId][i].config.alpha != 0)
+      return true;
+  }
+
+  return false;
+}
+#endif
+
+/**
+ * @brief   Get the pixels a section is rendered into: the transition pixels
+ *          while the section is in transition, the back buffer otherwise.
+ *
+ * @param sectionId   The section ID.
+ *
+ * @return  The section output pixels.
+ */
+static ZephyrRgbPixel_t *getOutputPixels(uint8_t sectionId)
+{
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+  if(fadeFrames[sectionId] != 0)
+    return fadePixels;
+#endif
+
+  return backPixels;
+}
+
+/**
+ * @brief   Render the next frame of a sequence.
+ *
+ * @param sectionId   The section ID.
+ * @param seq         The sequence.
+ * @param ctx         The sequence context.
+ * @param startColor  The unpacked sequence start color.
+ * @param endColor    The unpacked sequence end color.
+ * @param reset       The reset flag of the sequence.
+ * @param pixels      The section pixels.
+ * @param dirty       The output pixels updated flag.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int renderSequence(uint8_t sectionId, LedSequence_t *seq,
+                          SequenceContext_t *ctx, Color_t *startColor,
+                          Color_t *endColor, bool reset,
+                          ZephyrRgbPixel_t *pixels, bool *dirty)
+{
+  size_t pixelCnt = sections[sectionId].lastLed -
+    sections[sectionId].firstLed + 1;
+
+  if(reset)
+  {
+    appMsgUnpackColor(&seq->startColor, startColor);
+    appMsgUnpackColor(&seq->endColor, endColor);
+    seqMngrSetCycle(ctx, appMsgGetTimeBase(seq), seq->timeUnit,
+      frameSchedGetFps());
+  }
+
+  switch(seq->seqType)
+  {
+    case SEQ_SOLID:
+      *dirty = seqMngrUpdateSolidFrame(ctx, startColor, reset, pixels,
+        pixelCnt);
+    break;
+    case SEQ_SOLID_BREATHER:
+      *dirty = seqMngrUpdateSingleBreatherFrame(ctx, startColor, reset,
+        pixels, pixelCnt);
+    break;
+    case SEQ_FADE_CHASER:
+      *dirty = seqMngrUpdateFadeChaserFrame(ctx, startColor, false,
+        reset, pixels, pixelCnt);
+    break;
+    case SEQ_INVERT_FADE_CHASER:
+      *dirty = seqMngrUpdateFadeChaserFrame(ctx, startColor, true, reset,
+        pixels, pixelCnt);
+    break;
+    case SEQ_COLOR_RANGE:
+      *dirty = seqMngrUpdateColorRangeFrame(ctx, startColor,
+        endColor, reset, pixels, pixelCnt);
+    break;
+    case SEQ_RANGE_CHASER:
+      *dirty = seqMngrUpdateColorRangeChaserFrame(ctx, startColor,
+        endColor, false, reset, pixels, pixelCnt);
+    break;
+    case SEQ_INVERT_RANGE_CHASER:
+      *dirty = seqMngrUpdateColorRangeChaserFrame(ctx, startColor,
+        endColor, true, reset, pixels, pixelCnt);
+    break;
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+    case SEQ_PROGRAM:
+      *dirty = effectVmRunFrame(vmCtxs + sectionId, startColor, endColor,
+        reset, pixels, pixelCnt);
+    break;
+#endif
+    default:
+      /* stop the context so the section is not rendered on each frame */
+      memset(ctx, 0x00, sizeof(*ctx));
+      LOG_ERR("unsupported sequence type: %d", seq->seqType);
+      return -ENOTSUP;
+    break;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief   Render the next frame of a section sequence and set the section
+ *          dirty flag if its pixels were updated. A section with an overlay
+ *          renders its sequence into the sequence layer pixels, a section in
+ *          transition into the transition pixels.
+ *
+ * @param sectionId   The section ID.
+ * @param reset       The reset flag of the sequence.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int renderSection(uint8_t sectionId, bool reset)
+{
+  ZephyrRgbPixel_t *pixels = getOutputPixels(sectionId);
+  bool dirty;
+  int rc;
+
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+  if(hasOverlay(sectionId))
+    pixels = layerPixels[0];
+#endif
+
+  rc = renderSequence(sectionId, sequences + sectionId, seqCtxs + sectionId,
+    startColors + sectionId, endColors + sectionId, reset,
+    pixels + sections[sectionId].firstLed, &dirty);
+  if(rc < 0)
+    return rc;
+
+  dirties[sectionId] |= dirty;
+
+  return 0;
+}
+
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+/**
+ * @brief   The LED strip transfer thread. It sends the front buffer while
+ *          the next frame is rendered into the back buffer.
  *
  * @param p1          First user parameter.
  * @param p2          Second user parameter.
  * @param p3          Third user parameter.
  */
-static void ledMngrThread(void *p1, void *p2, void *p3)
+static void ledMngrTxThread(void *p1, void *p2, void *p3)
 {
   int rc;
-  bool reset = true;
-  LedSequence_t seq = {
-    .seqType = SEQ_SOLID,
-    .timeBase = ZEPHYR_TIME_FOREVER,
-    .startColor.hexColor = 0xffffff,
-  };
 
   while(true)
   {
-    rc = appMsgPopLedSequence(&seq);
-    if(rc == 0)
-      reset = true;
+    k_sem_take(&txReadySem, K_FOREVER);
+
+    rc = led_strip_update_rgb(ledStrip.dev, frontPixels, ledStrip.pixelCount);
+    if(rc < 0)
+      LOG_ERR("unable to update the LED strip");
+
+    k_sem_give(&txDoneSem);
+  }
+}
+
+/**
+ * @brief   Hand the back buffer over to the transfer thread. The buffers are
+ *          swapped once the previous transfer is done, and the new back
+ *          buffer gets a copy of the frame so the sequences keep rendering
+ *          on top of it. The output gamma correction and the power limiter
+ *          scale are then applied to the front buffer only.
+ */
+static void swapBuffers(void)
+{
+  ZephyrRgbPixel_t *pixels;
+
+  k_sem_take(&txDoneSem, K_FOREVER);
+
+  pixels = frontPixels;
+  frontPixels = backPixels;
+  backPixels = pixels;
+  memcpy(backPixels, frontPixels, ledStrip.pixelCount * sizeof(*backPixels));
+#ifdef CONFIG_LED_MNGR_GAMMA
+  colorMngrApplyGamma(frontPixels, frontPixels, ledStrip.pixelCount);
+#endif
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+  if(powerScale != POWER_LIMITER_SCALE_ONE)
+    powerLimiterApply(powerScale, frontPixels, frontPixels,
+      ledStrip.pixelCount);
+#endif
+
+  k_sem_give(&txReadySem);
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+/**
+ * @brief   Encode the dirty sections into the strip SPI symbols.
+ */
+static void encodeDirtySections(void)
+{
+  uint32_t firstLed;
+
+  for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+  {
+    if(dirties[i])
+    {
+      firstLed = sections[i].firstLed;
+      ws2812EncEncode(backPixels + firstLed,
+        sections[i].lastLed - firstLed + 1,
+        spiSymbols + firstLed * WS2812_ENC_WORDS_PER_LED);
+    }
+  }
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+/**
+ * @brief   Get the power limiter scale of the frame. The scale covers the
+ *          whole strip, so with the SPI encoder every section is encoded
+ *          again when it changes.
+ */
+static void limitPower(void)
+{
+  uint16_t scale = powerLimiterUpdate(backPixels, ledStrip.pixelCount);
+
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+  if(scale != powerScale)
+  {
+    ws2812EncSetScale(scale);
+    for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+      dirties[i] = true;
+  }
+#endif
+
+  powerScale = scale;
+}
+#endif
+
+#ifdef LED_MNGR_OUTPUT_PIXELS
+/**
+ * @brief   Apply the output stages to the back buffer into the output pixels.
+ *
+ * @return  The pixels to send to the LED strip.
+ */
+static ZephyrRgbPixel_t *applyOutputStages(void)
+{
+  ZephyrRgbPixel_t *pixels = backPixels;
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+  colorMngrApplyGamma(pixels, outputPixels, ledStrip.pixelCount);
+  pixels = outputPixels;
+#endif
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+  if(powerScale != POWER_LIMITER_SCALE_ONE)
+  {
+    powerLimiterApply(powerScale, pixels, outputPixels, ledStrip.pixelCount);
+    pixels = outputPixels;
+  }
+#endif
+
+  return pixels;
+}
+#endif
+
+/**
+ * @brief   Refresh the LED strip if any section is dirty. The output gamma
+ *          correction and the power limiter scale are applied on the way to
+ *          the strip, the back buffer stays linear at full level.
+ */
+static void refreshStrip(void)
+{
+#ifndef CONFIG_LED_MNGR_DOUBLE_BUFFER
+  int rc;
+#endif
+  bool isDirty = false;
+
+  for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+    isDirty |= dirties[i];
+
+  if(!isDirty)
+    return;
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+  limitPower();
+#endif
+
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+  swapBuffers();
+#elif defined(CONFIG_LED_MNGR_SPI_ENCODER)
+  encodeDirtySections();
+  memset(dirties, 0x00, sizeof(dirties));
+
+  rc = ws2812EncSend(spiSymbols, ledStrip.pixelCount);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to update the LED strip");
+    return;
+  }
+#elif defined(LED_MNGR_OUTPUT_PIXELS)
+  rc = led_strip_update_rgb(ledStrip.dev, applyOutputStages(),
+    ledStrip.pixelCount);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to update the LED strip");
+    return;
+  }
+#else
+  rc = led_strip_update_rgb(ledStrip.dev, backPixels, ledStrip.pixelCount);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to update the LED strip");
+    return;
+  }
+#endif
+
+  memset(dirties, 0x00, sizeof(dirties));
+}
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+/**
+ * @brief   Start the transition of a section to its new sequence. The new
+ *          sequence starts over the current frame, like without transition.
+ *
+ * @param sectionId   The section ID.
+ */
+static void startTransition(uint8_t sectionId)
+{
+  size_t firstLed = sections[sectionId].firstLed;
+  size_t pixelCnt = sections[sectionId].lastLed - firstLed + 1;
+
+  fadeFrames[sectionId] = DIV_ROUND_UP((uint32_t)transitionMs *
+    frameSchedGetFps(), MSEC_PER_SEC);
+  if(fadeFrames[sectionId] != 0)
+    memcpy(fadePixels + firstLed, backPixels + firstLed,
+      pixelCnt * sizeof(*fadePixels));
+}
+
+/**
+ * @brief   Run a frame of a section transition. On each frame deadline, the
+ *          back buffer span moves toward the transition pixels by one over
+ *          the remaining frame count, so the old frame share drops linearly
+ *          and the last frame is the new sequence frame. The section is
+ *          then rendered into the back buffer again.
+ *
+ * @param sectionId   The section ID.
+ * @param isFrameDue  The frame deadline reached flag.
+ *
+ * @return  True if the section is still in transition, false otherwise.
+ */
+static bool runTransition(uint8_t sectionId, bool isFrameDue)
+{
+  size_t firstLed = sections[sectionId].firstLed;
+  size_t pixelCnt = sections[sectionId].lastLed - firstLed + 1;
+
+  if(fadeFrames[sectionId] == 0)
+    return false;
+
+  if(isFrameDue)
+  {
+    colorMngrApplyLerp(COLOR_LERP_ONE / fadeFrames[sectionId],
+      fadePixels + firstLed, backPixels + firstLed, pixelCnt);
+    --fadeFrames[sectionId];
+    dirties[sectionId] = true;
+  }
+
+  return fadeFrames[sectionId] != 0;
+}
+#endif
+
+/**
+ * @brief   Apply the pending LED sequences.
+ */
+static void applyPendingSequences(void)
+{
+  LedSequence_t seq;
+
+  while(appMsgPopLedSequence(&seq) == 0)
+  {
+    if(seq.sectionId < LED_MNGR_SECTION_COUNT)
+    {
+      sequences[seq.sectionId] = seq;
+      resets[seq.sectionId] = true;
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+      startTransition(seq.sectionId);
+#endif
+    }
     else
-      reset = false;
+      LOG_ERR("invalid section ID: %d", seq.sectionId);
+  }
+}
 
-    switch(seq.seqType)
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+/**
+ * @brief   Apply the pending overlay layers. A section gaining its first
+ *          overlay or losing its last one is reset, so its sequence is
+ *          rendered again into the right pixels.
+ */
+static void applyPendingLayers(void)
+{
+  CompositorLayer_t config;
+  LedLayer_t *layer;
+  uint8_t sectionId;
+  bool hadOverlay;
+
+  while(compositorPopLayer(&config) == 0)
+  {
+    sectionId = config.seq.sectionId;
+    if(sectionId >= LED_MNGR_SECTION_COUNT)
     {
-      case SEQ_SOLID:
-        seqMngrUpdateSolidFrame(&seq.startColor, ledStrip.rgbPixels,
-          ledStrip.pixelCount);
-      break;
-      case SEQ_SOLID_BREATHER:
-        /* TODO calculate the steps base on the sequence time base and the starting color */
-        seqMngrUpdateSingleBreatherFrame(&seq.startColor, 10, reset,
-          ledStrip.rgbPixels, ledStrip.pixelCount);
-      break;
-      case SEQ_FADE_CHASER:
-        seqMngrUpdateFadeChaserFrame(&seq.startColor, false, reset,
-          ledStrip.rgbPixels, ledStrip.pixelCount);
-      break;
-      case SEQ_INVERT_FADE_CHASER:
-        seqMngrUpdateFadeChaserFrame(&seq.startColor, true, reset,
-          ledStrip.rgbPixels, ledStrip.pixelCount);
-      break;
-      case SEQ_COLOR_RANGE:
-        seqMngrUpdateColorRangeFrame(&seq.startColor, &seq.endColor, reset,
-          ledStrip.rgbPixels, ledStrip.pixelCount);
-      break;
-      case SEQ_RANGE_CHASER:
-        seqMngrUpdateColorRangeChaserFrame(&seq.startColor, &seq.endColor, false,
-          reset, ledStrip.rgbPixels, ledStrip.pixelCount);
-      break;
-      case SEQ_INVERT_RANGE_CHASER:
-        seqMngrUpdateColorRangeChaserFrame(&seq.startColor, &seq.endColor, true,
-          reset, ledStrip.rgbPixels, ledStrip.pixelCount);
-      break;;
-      default:
-        LOG_ERR("unsupported sequence type");
-        return;
-      break;
+      LOG_ERR("invalid section ID: %d", sectionId);
+      continue;
     }
 
-    /* TODO calculate the sleep from the sequence time base */
-    if(seq.timeBase != ZEPHYR_TIME_FOREVER)
+    hadOverlay = hasOverlay(sectionId);
+    layer = layers[sectionId] + config.layerId;
+    layer->config = config;
+    layer->reset = true;
+    resets[sectionId] |= hasOverlay(sectionId) != hadOverlay;
+  }
+}
+
+/**
+ * @brief   Check if a section has an animated overlay layer.
+ *
+ * @param sectionId   The section ID.
+ *
+ * @return  True if an overlay layer is animated, false otherwise.
+ */
+static bool hasAnimatedLayer(uint8_t sectionId)
+{
+  LedLayer_t *layer;
+
+  for(uint8_t i = 0; i < CONFIG_LED_MNGR_COMPOSITOR_LAYERS; ++i)
+  {
+    layer = layers[sectionId] + i;
+    if(layer->config.alpha != 0 && seqMngrIsAnimated(&layer->seqCtx))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief   Render the overlay layers of a section and compose them over its
+ *          sequence into the section output pixels. The section is only composed when
+ *          one of its layers was updated.
+ *
+ * @param sectionId   The section ID.
+ * @param isFrameDue  The frame deadline reached flag.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int composeSection(uint8_t sectionId, bool isFrameDue)
+{
+  size_t firstLed = sections[sectionId].firstLed;
+  size_t pixelCnt = sections[sectionId].lastLed - firstLed + 1;
+  bool isUpdated = dirties[sectionId];
+  ZephyrRgbPixel_t *pixels;
+  LedLayer_t *layer;
+  bool dirty;
+  int rc;
+
+  if(!hasOverlay(sectionId))
+    return 0;
+
+  for(uint8_t i = 0; i < CONFIG_LED_MNGR_COMPOSITOR_LAYERS; ++i)
+  {
+    layer = layers[sectionId] + i;
+    if(layer->config.alpha == 0)
+    {
+      isUpdated |= layer->reset;
+      layer->reset = false;
+      continue;
+    }
+
+    if(layer->reset || (isFrameDue && seqMngrIsAnimated(&layer->seqCtx)))
     {
-      rc = zephyrThreadSleep(seq.timeBase, seq.timeUnit);
+      rc = renderSequence(sectionId, &layer->config.seq, &layer->seqCtx,
+        &layer->startColor, &layer->endColor, layer->reset,
+        layerPixels[i + 1] + firstLed, &dirty);
       if(rc < 0)
-        LOG_ERR("unable to sleep sequence time base");
+        return rc;
+      isUpdated |= dirty || layer->reset;
+      layer->reset = false;
     }
-    else
+  }
+
+  if(!isUpdated)
+    return 0;
+
+  pixels = getOutputPixels(sectionId) + firstLed;
+  memcpy(pixels, layerPixels[0] + firstLed, pixelCnt * sizeof(*pixels));
+  for(uint8_t i = 0; i < CONFIG_LED_MNGR_COMPOSITOR_LAYERS; ++i)
+  {
+    layer = layers[sectionId] + i;
+    compositorBlend(layer->config.blendMode, layer->config.alpha,
+      layerPixels[i + 1] + firstLed, pixels, pixelCnt);
+  }
+  dirties[sectionId] = true;
+
+  return 0;
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_STREAM
+/**
+ * @brief   Run the streaming mode of a cycle. While the stream is started,
+ *          the oldest streamed frame is latched on each frame deadline and
+ *          the sequences are not rendered. When the stream stops, the
+ *          pending frames are dropped and every section is reset.
+ *
+ * @param isFrameDue  The frame deadline reached flag.
+ *
+ * @return  True if the stream is started, false otherwise.
+ */
+static bool runStream(bool isFrameDue)
+{
+  if(!frameStreamIsActive())
+  {
+    if(isStreaming)
+    {
+      isStreaming = false;
+      frameStreamFlush();
+      for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+        resets[i] = true;
+    }
+    return false;
+  }
+
+  isStreaming = true;
+  if(isFrameDue && frameStreamLatch(backPixels) == 0)
+  {
+    for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+      dirties[i] = true;
+  }
+
+  return true;
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_TIMELINE
+/**
+ * @brief   Run the timeline show of a cycle. While the show plays, it is
+ *          rewound on its start and advanced on each frame deadline, and its
+ *          tracks are rendered in place of the sequences of their sections.
+ *          When the show stops, it is released and its sections are reset.
+ *
+ * @param isFrameDue  The frame deadline reached flag.
+ *
+ * @return  True if the show plays, false otherwise.
+ */
+static bool runTimeline(bool isFrameDue)
+{
+  ZephyrRgbPixel_t *pixels;
+  size_t pixelCnt;
+
+  if(isShowPlaying && isFrameDue && timelineIsActive())
+    timelineAdvance();
+
+  if(!timelineIsActive())
+  {
+    if(isShowPlaying)
+    {
+      isShowPlaying = false;
+      for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+        resets[i] |= timelineHasTrack(i);
+      timelineRelease();
+    }
+    return false;
+  }
+
+  if(!isShowPlaying)
+  {
+    isShowPlaying = true;
+    timelineRewind(frameSchedGetFps());
+    isFrameDue = true;
+  }
+
+  if(isFrameDue)
+  {
+    for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+    {
+      pixels = backPixels + sections[i].firstLed;
+      pixelCnt = sections[i].lastLed - sections[i].firstLed + 1;
+      dirties[i] |= timelineRender(i, pixels, pixelCnt);
+    }
+  }
+
+  return true;
+}
+#endif
+
+/**
+ * @brief   Check if a section is animated, i.e. it needs to be rendered on
+ *          every frame deadline.
+ *
+ * @param sectionId   The section ID.
+ *
+ * @return  True if the section is animated, false otherwise.
+ */
+static bool isAnimated(uint8_t sectionId)
+{
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+  if(sequences[sectionId].seqType == SEQ_PROGRAM)
+    return effectVmIsRunning(vmCtxs + sectionId);
+#endif
+
+  return seqMngrIsAnimated(seqCtxs + sectionId);
+}
+
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+/**
+ * @brief   Swap in a newly loaded effect program and reset the sections
+ *          running it.
+ */
+static void syncEffectProgram(void)
+{
+  if(!effectVmSync())
+    return;
+
+  for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+    resets[i] |= sequences[i].seqType == SEQ_PROGRAM;
+}
+#endif
+
+/**
+ * @brief   Run one LED manager cycle. The thread waits for the next frame
+ *          deadline and for a new sequence at once. A new sequence is
+ *          rendered as soon as it is pushed, the animated sections are
+ *          rendered on the frame deadlines. Static sections are only
+ *          rendered on reset and the strip is only refreshed when a section
+ *          is dirty. When every section is static, there is no frame
+ *          deadline to wait for. While the frame stream is started, the
+ *          streamed frames replace the sequences. While the timeline show
+ *          plays, its tracks replace the sequences of their sections. A
+ *          newly loaded effect program resets the sections running it. The
+ *          overlay layers of a section are composed over its sequence. A
+ *          new sequence crossfades from the last frame over the transition
+ *          time. A section failing to render is logged and skipped, so it
+ *          does not stop the other sections.
+ *
+ * @return  Always 0.
+ */
+static int runCycle(void)
+{
+  int rc;
+  bool isFrameDue;
+
+  rc = appMsgWaitLedSequence(isIdle ? K_FOREVER :
+    frameSchedGetNextDeadline());
+  isFrameDue = rc == -EAGAIN;
+  if(isFrameDue)
+    frameSchedStartFrame();
+  else if(isIdle)
+    frameSchedRestart();
+
+  applyPendingSequences();
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+  applyPendingLayers();
+#endif
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+  syncEffectProgram();
+#endif
+
+#ifdef CONFIG_LED_MNGR_STREAM
+  if(runStream(isFrameDue))
+  {
+    isIdle = false;
+    refreshStrip();
+    return 0;
+  }
+#endif
+
+  isIdle = true;
+#ifdef CONFIG_LED_MNGR_TIMELINE
+  if(runTimeline(isFrameDue))
+    isIdle = false;
+#endif
+
+  for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+  {
+#ifdef CONFIG_LED_MNGR_TIMELINE
+    if(isShowPlaying && timelineHasTrack(i))
+      continue;
+#endif
+
+    if(resets[i] || (isFrameDue && isAnimated(i)))
     {
-      rc = zephyrThreadSleep(LED_MNGR_DEFAULT_SLEEP, MILLI_SEC);
+      rc = renderSection(i, resets[i]);
       if(rc < 0)
-        LOG_ERR("unable to sleep default time");
+        LOG_ERR("section %d render failed: %d", i, rc);
+      resets[i] = false;
     }
 
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+    rc = composeSection(i, isFrameDue);
     if(rc < 0)
-      return;
+      LOG_ERR("section %d compose failed: %d", i, rc);
+
+    if(hasAnimatedLayer(i))
+      isIdle = false;
+#endif
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+    if(runTransition(i, isFrameDue))
+      isIdle = false;
+#endif
+
+    if(isAnimated(i))
+      isIdle = false;
   }
+
+  refreshStrip();
+
+  return 0;
 }
 
+/**
+ * @brief   The LED manager thread.
+ *
+ * @param p1          First user parameter.
+ * @param p2          Second user parameter.
+ * @param p3          Third user parameter.
+ */
+static void ledMngrThread(void *p1, void *p2, void *p3)
+{
+  int rc;
+
+  for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+  {
+    sequences[i].version = APP_MSG_LED_SEQ_VERSION;
+    sequences[i].seqType = SEQ_SOLID;
+    sequences[i].timeBase = APP_MSG_TIME_FOREVER;
+    sequences[i].timeUnit = SECONDS;
+    sequences[i].startColor = (PackedColor_t){.r = 0xff, .g = 0xff, .b = 0xff};
+    sequences[i].sectionId = i;
+    resets[i] = true;
+  }
+
+  do
+  {
+    rc = runCycle();
+  } while(rc == 0);
+}
+
+size_t ledMngrGetSectionCount(void)
+{
+  return LED_MNGR_SECTION_COUNT;
+}
+
+int ledMngrGetSectionId(const char *name)
+{
+  for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+  {
+    if(strcmp(name, sections[i].name) == 0)
+      return i;
+  }
+
+  return -ENOENT;
+}
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+void ledMngrSetTransitionTime(uint16_t timeMs)
+{
+  transitionMs = timeMs;
+}
+
+uint16_t ledMngrGetTransitionTime(void)
+{
+  return transitionMs;
+}
+#endif
+
 int ledMngrInit(void)
 {
   int rc;
@@ -163,6 +1104,28 @@ int ledMngrInit(void)
   if(rc < 0)
     return rc;
 
+  backPixels = ledStrip.rgbPixels;
+
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+  rc = ws2812EncInit();
+  if(rc < 0)
+    return rc;
+#endif
+
+  rc = frameSchedInit(CONFIG_LED_MNGR_TARGET_FPS);
+  if(rc < 0)
+    return rc;
+
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+  frontPixels = framePixels;
+  txThread.entry = ledMngrTxThread;
+  zephyrThreadCreate(&txThread, LED_MNGR_TX_THREAD_NAME, ZEPHYR_TIME_NO_WAIT,
+    MILLI_SEC);
+  LOG_INF("double buffer RAM: %u bytes (frame: %u, stack: %u)",
+    (uint32_t)sizeof(framePixels) + CONFIG_LED_MNGR_TX_STACK_SIZE,
+    (uint32_t)sizeof(framePixels), CONFIG_LED_MNGR_TX_STACK_SIZE);
+#endif
+
   thread.entry = ledMngrThread;
   zephyrThreadCreate(&thread, LED_MNGR_THREAD_NAME, ZEPHYR_TIME_NO_WAIT,
     MILLI_SEC);
@@ -16,6 +16,9 @@
 #ifndef LED_MANAGER
 #define LED_MANAGER
 
+#include <stddef.h>
+#include <stdint.h>
+
 /**
  * @brief   Intialize the LED manager.
  *
@@ -23,6 +26,37 @@
  */
 int ledMngrInit(void);
 
+/**
+ * @brief   Get the LED strip section count.
+ *
+ * @return  The section count.
+ */
+size_t ledMngrGetSectionCount(void);
+
+/**
+ * @brief   Get the ID of a LED strip section from its name.
+ *
+ * @param name      The section name.
+ *
+ * @return  The section ID if successful, -ENOENT otherwise.
+ */
+int ledMngrGetSectionId(const char *name);
+
+/**
+ * @brief   Set the crossfade transition time between 2 consecutive sequences
+ *          of a section. It applies from the next sequence.
+ *
+ * @param timeMs    The transition time in milliseconds, 0 for a hard cut.
+ */
+void ledMngrSetTransitionTime(uint16_t timeMs);
+
+/**
+ * @brief   Get the crossfade transition time.
+ *
+ * @return  The transition time in milliseconds.
+ */
+uint16_t ledMngrGetTransitionTime(void);
+
 #endif    /* LED_MANAGER */
 
 /** @} */
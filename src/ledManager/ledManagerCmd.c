@@ -0,0 +1,68 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      ledManagerCmd.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Led Manager Command Module
+ *
+ *            This file is the implementation of the LED manager commands.
+ *
+ * @ingroup  ledManager
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+#include <zephyr/shell/shell.h>
+
+#include "ledManager.h"
+
+/**
+ * @brief The led command usage.
+*/
+#define LED_USAGE               "LED manager related commands."
+
+/**
+ * @brief The led transition command usage.
+*/
+#define LED_TRANSITION_USAGE    "Display or set the crossfade transition time: led transition [time (ms)]"
+
+/**
+ * @brief   Execute the led transition command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execTransition(const struct shell *shell, size_t argc, char **argv)
+{
+  int rc = 0;
+  unsigned long timeMs;
+
+  if(argc > 1)
+  {
+    timeMs = shell_strtoul(argv[1], 10, &rc);
+    if(rc < 0 || timeMs > UINT16_MAX)
+    {
+      shell_print(shell, "FAILED: Invalid transition time.");
+      return -EINVAL;
+    }
+
+    ledMngrSetTransitionTime(timeMs);
+  }
+
+  shell_print(shell, "transition time: %u ms", ledMngrGetTransitionTime());
+
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(led_sub,
+  SHELL_CMD_ARG(transition, NULL, LED_TRANSITION_USAGE, execTransition, 1, 1),
+  SHELL_SUBCMD_SET_END);
+SHELL_CMD_REGISTER(led, &led_sub, LED_USAGE, NULL);
+#endif
+
+/** @} */
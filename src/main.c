@@ -14,6 +14,7 @@
 #include <zephyr/sys/printk.h>
 
 #include "appMsg.h"
+#include "hostLink.h"
 #include "ledManager.h"
 #include "zephyrLedStrip.h"
 
@@ -42,5 +43,14 @@ int main(void)
     return rc;
   }
 
+#ifdef CONFIG_HOST_LINK
+  rc = hostLinkInit();
+  if(rc < 0)
+  {
+    LOG_ERR("unable to initialize the host link.");
+    return rc;
+  }
+#endif
+
   return 0;
 }
@@ -0,0 +1,150 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      powerLimiter.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Power Limiter Module
+ *
+ *            This file is the implementation of the power limiter module.
+ *            A channel at full level draws its configured current and the
+ *            current is linear with the output level, so the strip current
+ *            is the weighted sum of the channel sums.
+ *
+ * @ingroup  powerLimiter
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <string.h>
+
+#include "colorManager.h"
+#include "powerLimiter.h"
+
+#define POWER_LIMITER_MODULE_NAME power_limiter_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(POWER_LIMITER_MODULE_NAME);
+
+/**
+ * @brief The strip current budget (mA), set from the shell.
+*/
+static volatile uint16_t budget = CONFIG_LED_MNGR_POWER_BUDGET_MA;
+
+/**
+ * @brief The power limiter statistics.
+*/
+static PowerLimiterStats_t stats;
+
+/**
+ * @brief   Get the output level of a channel.
+ *
+ * @param gammaLut    The gamma table, unused without the gamma correction.
+ * @param value       The linear channel value.
+ *
+ * @return  The output level.
+ */
+static inline uint8_t getLevel(const uint8_t *gammaLut, uint8_t value)
+{
+#ifdef CONFIG_LED_MNGR_GAMMA
+  return gammaLut[value];
+#else
+  return value;
+#endif
+}
+
+uint16_t powerLimiterUpdate(const ZephyrRgbPixel_t *pixels, size_t pixelCnt)
+{
+  const uint8_t *gammaLut = NULL;
+  uint32_t redSum = 0;
+  uint32_t greenSum = 0;
+  uint32_t blueSum = 0;
+  uint32_t current;
+  uint32_t limit = budget;
+  uint16_t scale = POWER_LIMITER_SCALE_ONE;
+  unsigned int key;
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+  gammaLut = colorMngrGetGammaLut();
+#endif
+
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    redSum += getLevel(gammaLut, pixels[i].r);
+    greenSum += getLevel(gammaLut, pixels[i].g);
+    blueSum += getLevel(gammaLut, pixels[i].b);
+  }
+
+  current = (redSum * CONFIG_LED_MNGR_POWER_RED_MA +
+    greenSum * CONFIG_LED_MNGR_POWER_GREEN_MA +
+    blueSum * CONFIG_LED_MNGR_POWER_BLUE_MA + UINT8_MAX / 2) / UINT8_MAX;
+
+  if(current > limit)
+    scale = limit * POWER_LIMITER_SCALE_ONE / current;
+
+  key = irq_lock();
+
+  ++stats.frameCount;
+  if(scale != POWER_LIMITER_SCALE_ONE)
+    ++stats.limitedCount;
+  stats.lastCurrent = current;
+  if(current > stats.maxCurrent)
+    stats.maxCurrent = current;
+
+  irq_unlock(key);
+
+  return scale;
+}
+
+void powerLimiterApply(uint16_t scale, const ZephyrRgbPixel_t *src,
+                       ZephyrRgbPixel_t *dst, size_t pixelCnt)
+{
+  const uint8_t *in = (const uint8_t *)src;
+  uint8_t *out = (uint8_t *)dst;
+
+  for(size_t i = 0; i < pixelCnt * sizeof(*dst); ++i)
+    out[i] = (in[i] * scale) >> POWER_LIMITER_SCALE_SHIFT;
+}
+
+int powerLimiterSetBudget(uint16_t budgetMa)
+{
+  if(budgetMa == 0)
+  {
+    LOG_ERR("invalid current budget: %d", budgetMa);
+    return -EINVAL;
+  }
+
+  budget = budgetMa;
+
+  return 0;
+}
+
+uint16_t powerLimiterGetBudget(void)
+{
+  return budget;
+}
+
+void powerLimiterGetStats(PowerLimiterStats_t *out)
+{
+  unsigned int key = irq_lock();
+
+  *out = stats;
+
+  irq_unlock(key);
+}
+
+void powerLimiterResetStats(void)
+{
+  unsigned int key = irq_lock();
+
+  memset(&stats, 0x00, sizeof(stats));
+
+  irq_unlock(key);
+}
+#endif
+
+/** @} */
@@ -0,0 +1,102 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      powerLimiter.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Power Limiter Module
+ *
+ *            This file is the declaration of the power limiter module. The
+ *            strip current of each frame is estimated from its channel sums
+ *            and, when it exceeds the current budget, the whole frame is
+ *            scaled down so it fits the budget.
+ *
+ * @defgroup  powerLimiter powerLimiter
+ *
+ * @{
+ */
+
+#ifndef POWER_LIMITER
+#define POWER_LIMITER
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief The scale fraction bit count.
+*/
+#define POWER_LIMITER_SCALE_SHIFT             8
+
+/**
+ * @brief The scale leaving the frame as is.
+*/
+#define POWER_LIMITER_SCALE_ONE               (1 << POWER_LIMITER_SCALE_SHIFT)
+
+/**
+ * @brief The power limiter statistics.
+*/
+typedef struct
+{
+  uint32_t frameCount;                  /**< The estimated frame count. */
+  uint32_t limitedCount;                /**< The frame count scaled down to the budget. */
+  uint32_t lastCurrent;                 /**< The last frame estimated current (mA), before limiting. */
+  uint32_t maxCurrent;                  /**< The maximum estimated current (mA), before limiting. */
+} PowerLimiterStats_t;
+
+/**
+ * @brief   Estimate the strip current of a frame and get the scale fitting
+ *          it in the current budget. With the output gamma correction, the
+ *          current is estimated on the corrected levels.
+ *
+ * @param pixels      The linear frame pixels.
+ * @param pixelCnt    The pixel count.
+ *
+ * @return  The frame scale, POWER_LIMITER_SCALE_ONE if the frame fits the
+ *          budget.
+ */
+uint16_t powerLimiterUpdate(const ZephyrRgbPixel_t *pixels, size_t pixelCnt);
+
+/**
+ * @brief   Scale pixels, one fixed-point multiply per channel.
+ *
+ * @param scale       The scale, POWER_LIMITER_SCALE_ONE for full level.
+ * @param src         The pixels to scale.
+ * @param dst         The scaled pixels, it can be the pixels to scale.
+ * @param pixelCnt    The pixel count.
+ */
+void powerLimiterApply(uint16_t scale, const ZephyrRgbPixel_t *src,
+                       ZephyrRgbPixel_t *dst, size_t pixelCnt);
+
+/**
+ * @brief   Set the strip current budget.
+ *
+ * @param budgetMa    The current budget (mA).
+ *
+ * @return  0 if successful, -EINVAL if the budget is 0.
+ */
+int powerLimiterSetBudget(uint16_t budgetMa);
+
+/**
+ * @brief   Get the strip current budget.
+ *
+ * @return  The current budget (mA).
+ */
+uint16_t powerLimiterGetBudget(void);
+
+/**
+ * @brief   Get the power limiter statistics.
+ *
+ * @param stats       The output statistics.
+ */
+void powerLimiterGetStats(PowerLimiterStats_t *stats);
+
+/**
+ * @brief   Reset the power limiter statistics.
+ */
+void powerLimiterResetStats(void);
+
+#endif    /* POWER_LIMITER */
+
+/** @} */
@@ -0,0 +1,126 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      powerLimiterCmd.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Power Limiter Command Module
+ *
+ *            This file is the implementation of the power limiter commands.
+ *
+ * @ingroup  powerLimiter
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+#include <zephyr/shell/shell.h>
+
+#include "powerLimiter.h"
+
+/**
+ * @brief The power command usage.
+*/
+#define POWER_USAGE           "Power limiter related commands."
+
+/**
+ * @brief The power budget command usage.
+*/
+#define POWER_BUDGET_USAGE    "Display or set the strip current budget: power budget [budget (mA)]"
+
+/**
+ * @brief The power stats command usage.
+*/
+#define POWER_STATS_USAGE     "Display the power limiter statistics: power stats"
+
+/**
+ * @brief The power reset command usage.
+*/
+#define POWER_RESET_USAGE     "Reset the power limiter statistics: power reset"
+
+/**
+ * @brief   Execute the power budget command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execBudget(const struct shell *shell, size_t argc, char **argv)
+{
+  int rc = 0;
+  unsigned long budgetMa;
+
+  if(argc > 1)
+  {
+    budgetMa = shell_strtoul(argv[1], 10, &rc);
+    if(rc < 0 || budgetMa > UINT16_MAX || powerLimiterSetBudget(budgetMa) < 0)
+    {
+      shell_print(shell, "FAILED: Invalid current budget.");
+      return -EINVAL;
+    }
+  }
+
+  shell_print(shell, "current budget: %u mA", powerLimiterGetBudget());
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the power stats command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStats(const struct shell *shell, size_t argc, char **argv)
+{
+  PowerLimiterStats_t stats;
+
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  powerLimiterGetStats(&stats);
+
+  shell_print(shell, "current budget: %u mA", powerLimiterGetBudget());
+  shell_print(shell, "frames: %u", stats.frameCount);
+  shell_print(shell, "limited frames: %u", stats.limitedCount);
+  shell_print(shell, "last current: %u mA", stats.lastCurrent);
+  shell_print(shell, "max current: %u mA", stats.maxCurrent);
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the power reset command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execReset(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  powerLimiterResetStats();
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(power_sub,
+  SHELL_CMD_ARG(budget, NULL, POWER_BUDGET_USAGE, execBudget, 1, 1),
+  SHELL_CMD(stats, NULL, POWER_STATS_USAGE, execStats),
+  SHELL_CMD(reset, NULL, POWER_RESET_USAGE, execReset),
+  SHELL_SUBCMD_SET_END);
+SHELL_CMD_REGISTER(power, &power_sub, POWER_USAGE, NULL);
+#endif
+
+/** @} */
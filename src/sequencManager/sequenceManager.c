@@ -13,7 +13,9 @@
  * @{
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
 
 #include "sequenceManager.h"
 #include "colorManager.h"
@@ -24,110 +26,247 @@
 /* Setting module logging */
 LOG_MODULE_REGISTER(SEQ_MNGR_MODULE_NAME);
 
-void seqMngrUpdateSolidFrame(Color_t *color, ZephyrRgbPixel_t *pixels,
+void seqMngrSetCycle(SequenceContext_t *ctx, uint32_t length,
+                     ZephyrTimeUnit_t timeUnit, uint32_t fps)
+{
+  if(length != ZEPHYR_TIME_FOREVER)
+  {
+    if(timeUnit == SECONDS)
+      length = length > UINT32_MAX / MSEC_PER_SEC ?
+        ZEPHYR_TIME_FOREVER : length * MSEC_PER_SEC;
+    else if(timeUnit == MICRO_SEC)
+      length = length / USEC_PER_MSEC + (length % USEC_PER_MSEC != 0);
+
+    /* a cycle cannot be shorter than the frame showing it */
+    if(length != 0 && fps != 0)
+      length = MAX(length, DIV_ROUND_UP(MSEC_PER_SEC, fps));
+  }
+
+  ctx->cycleMs = length;
+  ctx->fps = fps;
+}
+
+/**
+ * @brief   Compute the per-frame phase increment to cover a span in the
+ *          sequence cycle time. An unset cycle moves by one unit per frame.
+ *
+ * @param ctx         The section sequence context.
+ * @param span        The count of unit in a full cycle.
+ *
+ * @return  The per-frame phase increment (16.16).
+ */
+static uint32_t computePhaseStep(SequenceContext_t *ctx, uint32_t span)
+{
+  uint64_t framesMs;
+  uint64_t phaseStep;
+
+  if(ctx->cycleMs == 0 || ctx->fps == 0)
+    return SEQ_MNGR_PHASE_ONE;
+
+  framesMs = (uint64_t)ctx->cycleMs * ctx->fps;
+  phaseStep = (((uint64_t)span << SEQ_MNGR_PHASE_SHIFT) * MSEC_PER_SEC +
+    framesMs / 2) / framesMs;
+
+  return MIN(phaseStep, UINT32_MAX);
+}
+
+/**
+ * @brief   Advance the sequence phase by one frame.
+ *
+ * @param ctx         The section sequence context.
+ *
+ * @return  The count of whole unit to move by this frame.
+ */
+static inline uint32_t advancePhase(SequenceContext_t *ctx)
+{
+  uint32_t units;
+
+  ctx->phase += ctx->phaseStep;
+  units = ctx->phase >> SEQ_MNGR_PHASE_SHIFT;
+  ctx->phase &= SEQ_MNGR_PHASE_ONE - 1;
+
+  return units;
+}
+
+bool seqMngrIsAnimated(SequenceContext_t *ctx)
+{
+  return ctx->phaseStep != 0;
+}
+
+bool seqMngrUpdateSolidFrame(SequenceContext_t *ctx, Color_t *color,
+                             bool reset, ZephyrRgbPixel_t *pixels,
                              size_t pixelCnt)
 {
+  if(!reset)
+    return false;
+
+  ctx->phaseStep = 0;
   colorMngrSetSingle(color, pixels, pixelCnt);
+
+  return true;
 }
 
-void seqMngrUpdateSingleBreatherFrame(Color_t *color, uint8_t step, bool reset,
-                                      ZephyrRgbPixel_t *pixels, size_t pixelCnt)
+bool seqMngrUpdateSingleBreatherFrame(SequenceContext_t *ctx, Color_t *color,
+                                      bool reset, ZephyrRgbPixel_t *pixels,
+                                      size_t pixelCnt)
 {
-  static uint16_t frameCntr = 0;
-  static bool exhale = true;
+  uint32_t levels;
 
   if(reset)
   {
-    frameCntr = 0;
+    ctx->phaseStep = computePhaseStep(ctx, SEQ_MNGR_BREATHER_SPAN);
+    ctx->phase = 0;
+    ctx->frameCntr = 0;
+    ctx->inhale = false;
     colorMngrSetSingle(color, pixels, pixelCnt);
-    frameCntr += step;
   }
   else
   {
-    if(exhale)
-      colorMngrApplyFade(step, pixels, pixelCnt);
+    levels = advancePhase(ctx);
+    levels = MIN(levels, UINT8_MAX);
+    if(levels == 0)
+      return false;
+
+    if(ctx->inhale)
+      colorMngrApplyUnfade(levels, pixels, pixelCnt);
     else
-      colorMngrApplyUnfade(step, pixels, pixelCnt);
-    frameCntr += step;
-    if(frameCntr > 255)
+      colorMngrApplyFade(levels, pixels, pixelCnt);
+    ctx->frameCntr += levels;
+    if(ctx->frameCntr > 255)
     {
-      frameCntr = 0;
-      exhale = !exhale;
+      ctx->frameCntr -= 256;
+      ctx->inhale = !ctx->inhale;
     }
   }
+
+  return true;
+}
+
+/**
+ * @brief   Move the chaser position by the frame phase advance, wrapping
+ *          around the section.
+ *
+ * @param ctx         The section sequence context.
+ * @param isInverted  The inverted flag.
+ * @param pixelCnt    The pixel count.
+ *
+ * @return  True if the chaser moved, false otherwise.
+ */
+static bool moveChaser(SequenceContext_t *ctx, bool isInverted, size_t pixelCnt)
+{
+  uint32_t moves = advancePhase(ctx);
+
+  if(moves == 0)
+    return false;
+
+  while(moves >= pixelCnt)
+    moves -= pixelCnt;
+
+  if(isInverted)
+    moves = pixelCnt - moves;
+
+  ctx->chaserPos += moves;
+  if(ctx->chaserPos >= pixelCnt)
+    ctx->chaserPos -= pixelCnt;
+
+  return true;
 }
 
-void seqMngrUpdateFadeChaserFrame(Color_t *color, bool isInverted, bool reset,
+/**
+ * @brief   Reset the chaser position and phase.
+ *
+ * @param ctx         The section sequence context.
+ * @param isInverted  The inverted flag.
+ * @param pixelCnt    The pixel count.
+ */
+static void resetChaser(SequenceContext_t *ctx, bool isInverted,
+                        size_t pixelCnt)
+{
+  ctx->chaserPos = isInverted ? pixelCnt - 1 : 0;
+  ctx->phaseStep = computePhaseStep(ctx, pixelCnt);
+  ctx->phase = 0;
+}
+
+bool seqMngrUpdateFadeChaserFrame(SequenceContext_t *ctx, Color_t *color,
+                                  bool isInverted, bool reset,
                                   ZephyrRgbPixel_t *pixels, size_t pixelCnt)
 {
-  static ZephyrRgbPixel_t *chaserPoint = NULL;
-  uint8_t step;
+  uint32_t level;
+  uint32_t step;
+
+  if(reset)
+    resetChaser(ctx, isInverted, pixelCnt);
+  else if(!moveChaser(ctx, isInverted, pixelCnt))
+    return false;
 
   if(color->r < color->g && color->r < color->b)
-    step = color->r / pixelCnt;
+    level = color->r;
   else if(color->g < color->r && color->g < color->b)
-    step = color->g / pixelCnt;
+    level = color->g;
   else
-    step = color->b / pixelCnt;
+    level = color->b;
 
-  if(reset)
-    chaserPoint = isInverted ? pixels + pixelCnt - 1 : pixels;
+  step = (level << COLOR_STEP_SHIFT) / pixelCnt;
 
   colorMngrSetSingle(color, pixels, pixelCnt);
-  colorMngrApplyFadeTrail(step, chaserPoint - pixels, !isInverted, pixels,
-    pixelCnt);
+  colorMngrApplyFadeTrail(step, ctx->chaserPos, !isInverted, pixels, pixelCnt);
 
-  if(isInverted)
+  return true;
+}
+
+bool seqMngrUpdateColorRangeFrame(SequenceContext_t *ctx, Color_t *startClr,
+                                  Color_t *endClr, bool reset,
+                                  ZephyrRgbPixel_t *pixels, size_t pixelCnt)
+{
+  uint8_t startColor;
+  uint8_t endColor;
+  uint32_t step = 0;
+
+  if(!reset)
   {
-    --chaserPoint;
-    if(chaserPoint < pixels)
-      chaserPoint = pixels + pixelCnt - 1;
+    step = advancePhase(ctx);
+    if(step == 0)
+      return false;
+    step = MIN(step, UINT8_MAX);
   }
-  else
+
+  startColor = colorMngrConvertColor(startClr);
+  endColor = colorMngrConvertColor(endClr);
+
+  if(reset)
   {
-    ++chaserPoint;
-    if(chaserPoint == pixels + pixelCnt)
-      chaserPoint = pixels;
+    ctx->phaseStep = computePhaseStep(ctx,
+      (uint8_t)(endColor - startColor) + 1);
+    ctx->phase = 0;
   }
 
-}
+  colorMngrUpdateRange(&ctx->wheelPos, startColor, endColor, step, reset,
+    pixels, pixelCnt);
 
-void seqMngrUpdateColorRangeFrame(Color_t *startClr, Color_t *endClr, bool reset,
-                                  ZephyrRgbPixel_t *pixels, size_t pixelCnt)
-{
-  uint8_t startColor = colorMngrConvertColor(startClr);
-  uint8_t endColor = colorMngrConvertColor(endClr);
-
-  colorMngrUpdateRange(startColor, endColor, reset, pixels, pixelCnt);
+  return true;
 }
 
-void seqMngrUpdateColorRangeChaserFrame(Color_t *stratClr, Color_t *endClr,
+bool seqMngrUpdateColorRangeChaserFrame(SequenceContext_t *ctx,
+                                        Color_t *stratClr, Color_t *endClr,
                                         bool isInverted, bool reset,
                                         ZephyrRgbPixel_t *pixels,
                                         size_t pixelCnt)
 {
-  static ZephyrRgbPixel_t *chaserPoint = NULL;
-  uint8_t startColor = colorMngrConvertColor(stratClr);
-  uint8_t endColor = colorMngrConvertColor(endClr);
+  uint8_t startColor;
+  uint8_t endColor;
 
   if(reset)
-    chaserPoint = isInverted ? pixels + pixelCnt - 1 : pixels;
+    resetChaser(ctx, isInverted, pixelCnt);
+  else if(!moveChaser(ctx, isInverted, pixelCnt))
+    return false;
 
-  colorMngrApplyRangeTrail(chaserPoint - pixels, startColor, endColor,
-    !isInverted, pixels, pixelCnt);
+  startColor = colorMngrConvertColor(stratClr);
+  endColor = colorMngrConvertColor(endClr);
 
-  if(isInverted)
-  {
-    --chaserPoint;
-    if(chaserPoint < pixels)
-      chaserPoint = pixels + pixelCnt - 1;
-  }
-  else
-  {
-    ++chaserPoint;
-    if(chaserPoint == pixels + pixelCnt)
-      chaserPoint = pixels;
-  }
+  colorMngrApplyRangeTrail(ctx->chaserPos, startColor, endColor, !isInverted,
+    pixels, pixelCnt);
+
+  return true;
 }
 
 /** @} */
@@ -19,63 +19,137 @@
 #include "appMsg.h"
 #include "zephyrLedStrip.h"
 
+/**
+ * @brief The fixed-point fractional bit count of the sequence phase.
+*/
+#define SEQ_MNGR_PHASE_SHIFT                    16
+
+/**
+ * @brief The fixed-point phase increment of one whole unit per frame.
+*/
+#define SEQ_MNGR_PHASE_ONE                      (1UL << SEQ_MNGR_PHASE_SHIFT)
+
+/**
+ * @brief The breather span in fade level per cycle (exhale and inhale).
+*/
+#define SEQ_MNGR_BREATHER_SPAN                  512
+
+/**
+ * @brief The sequence context of a LED strip section.
+*/
+typedef struct
+{
+  uint32_t cycleMs;                     /**< The full cycle time (msec). */
+  uint32_t fps;                         /**< The frame rate of the cycle. */
+  uint32_t phaseStep;                   /**< The phase increment (16.16). */
+  uint32_t phase;                       /**< The phase fraction (16.16). */
+  uint16_t frameCntr;                   /**< The breather frame counter. */
+  bool inhale;                          /**< The breather inhale flag. */
+  uint32_t chaserPos;                   /**< The section chaser position. */
+  uint8_t wheelPos;                     /**< The color range wheel position. */
+} SequenceContext_t;
+
+/**
+ * @brief   Set the full cycle time of a section sequence. The sequence frame
+ *          functions turn it into a per-frame phase increment on reset. The
+ *          cycle is kept in milliseconds, rounded up to at least one frame.
+ *
+ * @param ctx         The section sequence context.
+ * @param length      The sequence length, ZEPHYR_TIME_FOREVER for a static
+ *                    sequence.
+ * @param timeUnit    The sequence length time unit.
+ * @param fps         The frame rate.
+ */
+void seqMngrSetCycle(SequenceContext_t *ctx, uint32_t length,
+                     ZephyrTimeUnit_t timeUnit, uint32_t fps);
+
+/**
+ * @brief   Check if a section sequence is animated, i.e. it needs to be
+ *          rendered on every frame.
+ *
+ * @param ctx         The section sequence context.
+ *
+ * @return  True if the sequence is animated, false if it is static.
+ */
+bool seqMngrIsAnimated(SequenceContext_t *ctx);
+
 /**
  * @brief   Update the pixels for the next solid color frame.
  *
+ * @param ctx         The section sequence context.
  * @param color       The next solid color.
+ * @param reset       The reset flag of the sequence.
  * @param pixels      The pixel buffer.
  * @param pixelCnt    The pixel count.
+ *
+ * @return  True if the pixels were updated, false otherwise.
  */
-void seqMngrUpdateSolidFrame(Color_t *color, ZephyrRgbPixel_t *pixels,
+bool seqMngrUpdateSolidFrame(SequenceContext_t *ctx, Color_t *color,
+                             bool reset, ZephyrRgbPixel_t *pixels,
                              size_t pixelCnt);
 
 /**
  * @brief   Update the pixels for the next single color breather frame.
  *
+ * @param ctx         The section sequence context.
  * @param color       The color of the sequence.
- * @param step        The breather sequence step.
  * @param reset       The reset flag of the sequence.
  * @param pixels      The pixel buffer.
  * @param pixelCnt    The pixel count.
+ *
+ * @return  True if the pixels were updated, false otherwise.
  */
-void seqMngrUpdateSingleBreatherFrame(Color_t *color, uint8_t step, bool reset,
-                                      ZephyrRgbPixel_t *pixels, size_t pixelCnt);
+bool seqMngrUpdateSingleBreatherFrame(SequenceContext_t *ctx, Color_t *color,
+                                      bool reset, ZephyrRgbPixel_t *pixels,
+                                      size_t pixelCnt);
 
 /**
  * @brief   Update the pixels for the next fade chaser frame.
  *
+ * @param ctx         The section sequence context.
  * @param color       The color of the sequence.
  * @param isInverted  The inverted flag..
  * @param reset       The reset flag of the sequence.
  * @param pixels      The pixel buffer.
  * @param pixelCnt    The pixel count.
+ *
+ * @return  True if the pixels were updated, false otherwise.
  */
-void seqMngrUpdateFadeChaserFrame(Color_t *color, bool isInverted, bool reset,
+bool seqMngrUpdateFadeChaserFrame(SequenceContext_t *ctx, Color_t *color,
+                                  bool isInverted, bool reset,
                                   ZephyrRgbPixel_t *pixels, size_t pixelCnt);
 
 /**
  * @brief   Update the pixels for the next color range frame.
  *
+ * @param ctx         The section sequence context.
  * @param startClr    The range starting color.
  * @param endClr      The range ending color.
  * @param reset       The reset flag.
  * @param pixels      The pixel buffer.
  * @param pixelCnt    The pixel count.
+ *
+ * @return  True if the pixels were updated, false otherwise.
  */
-void seqMngrUpdateColorRangeFrame(Color_t *startClr, Color_t *endClr, bool reset,
+bool seqMngrUpdateColorRangeFrame(SequenceContext_t *ctx, Color_t *startClr,
+                                  Color_t *endClr, bool reset,
                                   ZephyrRgbPixel_t *pixels, size_t pixelCnt);
 
 /**
  * @brief   Update the pixels for the next color range chaser frame.
  *
+ * @param ctx         The section sequence context.
  * @param stratClr    The range starting color.
  * @param endClr      The range ending color.
  * @param isInverted  The inverted flag.
  * @param reset       The reset flag.
  * @param pixels      The pixel buffer.
  * @param pixelCnt    The pixel count.
+ *
+ * @return  True if the pixels were updated, false otherwise.
  */
-void seqMngrUpdateColorRangeChaserFrame(Color_t *stratClr, Color_t *endClr,
+bool seqMngrUpdateColorRangeChaserFrame(SequenceContext_t *ctx,
+                                        Color_t *stratClr, Color_t *endClr,
                                         bool isInverted, bool reset,
                                         ZephyrRgbPixel_t *pixels,
                                         size_t pixelCnt);
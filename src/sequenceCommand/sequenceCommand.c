@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include "appMsg.h"
+#include "ledManager.h"
 
 #define SEQUENCEL_COMMAND_MODULE_NAME sequence_command_module
 
@@ -56,6 +57,26 @@ LOG_MODULE_REGISTER(SEQUENCEL_COMMAND_MODULE_NAME);
 */
 #define SEQ_RANGE_CHASER_USAGE  "Set a color range sequence: sequence range <section> <HEX start color> <HEX end color> <sequence length (sec)> <direction>."
 
+/**
+ * @brief The sequence stats command usage.
+*/
+#define SEQ_STATS_USAGE     "Display the sequence mailbox statistics: sequence stats."
+
+/**
+ * @brief The sequence begin command usage.
+*/
+#define SEQ_BEGIN_USAGE     "Begin a transaction, the next sequences are staged until committed: sequence begin."
+
+/**
+ * @brief The sequence commit command usage.
+*/
+#define SEQ_COMMIT_USAGE    "Commit the staged sequences, they are applied on the same frame: sequence commit."
+
+/**
+ * @brief The sequence abort command usage.
+*/
+#define SEQ_ABORT_USAGE     "Abort the transaction and drop the staged sequences: sequence abort."
+
 /**
  * @brief The solid color sequence argment count
 */
@@ -92,7 +113,18 @@ LOG_MODULE_REGISTER(SEQUENCEL_COMMAND_MODULE_NAME);
 #define INVERTED_DIRECTION                  "inverted"
 
 /**
- * @brief   Convert and check validity of the section.
+ * @brief The sequence transaction.
+*/
+static LedTransaction_t transaction;
+
+/**
+ * @brief The transaction open flag.
+*/
+static bool isTransactionOpen;
+
+/**
+ * @brief   Convert and check validity of the section. The section can be
+ *          given by its ID or by its name.
  *
  * @param arg         The section string argument value.
  * @param section     The converted section.
@@ -102,13 +134,20 @@ LOG_MODULE_REGISTER(SEQUENCEL_COMMAND_MODULE_NAME);
 static bool isSectionValid(char *arg, uint32_t *section)
 {
   int rc = 0;
+  int sectionId;
+
+  sectionId = ledMngrGetSectionId(arg);
+  if(sectionId >= 0)
+  {
+    *section = sectionId;
+    return true;
+  }
 
   *section = shell_strtoul(arg, 10, &rc);
   if(rc < 0)
     return false;
 
-  // TODO: validate with settings.
-  return true;
+  return *section < ledMngrGetSectionCount();
 }
 
 /**
@@ -149,7 +188,7 @@ static bool isLengthValid(char *arg, uint32_t *length)
   int rc = 0;
 
   *length = shell_strtoul(arg, 10, &rc);
-  if(rc < 0)
+  if(rc < 0 || *length >= APP_MSG_TIME_FOREVER)
     return false;
 
   return true;
@@ -181,7 +220,23 @@ static bool isDirectionValid(char *arg, bool *isInverted)
 }
 
 /**
- * @brief   Push a solid color sequence in the sequence queue.
+ * @brief   Submit a sequence. It is staged in the transaction when one is
+ *          open, it is pushed in the sequence mailbox otherwise.
+ *
+ * @param sequence    The sequence.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int submitSequence(LedSequence_t *sequence)
+{
+  if(isTransactionOpen)
+    return appMsgStageLedSequence(&transaction, sequence);
+
+  return appMsgPushLedSequence(sequence);
+}
+
+/**
+ * @brief   Push a solid color sequence in the sequence mailbox.
  *
  * @param section     The LED strip section.
  * @param color       The solid color.
@@ -190,18 +245,19 @@ static bool isDirectionValid(char *arg, bool *isInverted)
  */
 static int pushSolidColorSequence(uint32_t section, Color_t *color)
 {
-  LedSequence_t sequence = {.sectionId = section,
+  LedSequence_t sequence = {.version = APP_MSG_LED_SEQ_VERSION,
+                            .sectionId = section,
                             .seqType = SEQ_SOLID,
-                            .timeBase = ZEPHYR_TIME_FOREVER,
+                            .timeBase = APP_MSG_TIME_FOREVER,
                             .timeUnit = SECONDS};
 
-  sequence.startColor.hexColor = color->hexColor;
+  appMsgPackColor(color, &sequence.startColor);
 
-  return appMsgPushLedSequence(&sequence);
+  return submitSequence(&sequence);
 }
 
 /**
- * @brief   Push a breather sequence in the sequence queue.
+ * @brief   Push a breather sequence in the sequence mailbox.
  *
  * @param section     The LED strip section.
  * @param color       The breather color.
@@ -212,18 +268,19 @@ static int pushSolidColorSequence(uint32_t section, Color_t *color)
 static int pushBreatherSequence(uint32_t section, Color_t *color,
                                 uint32_t length)
 {
-  LedSequence_t sequence = {.sectionId = section,
+  LedSequence_t sequence = {.version = APP_MSG_LED_SEQ_VERSION,
+                            .sectionId = section,
                             .seqType = SEQ_SOLID_BREATHER,
                             .timeBase = length,
                             .timeUnit = SECONDS};
 
-  sequence.startColor.hexColor = color->hexColor;
+  appMsgPackColor(color, &sequence.startColor);
 
-  return appMsgPushLedSequence(&sequence);
+  return submitSequence(&sequence);
 }
 
 /**
- * @brief   Push a fade chaser sequence in the sequence queue.
+ * @brief   Push a fade chaser sequence in the sequence mailbox.
  *
  * @param section       The LED strip section.
  * @param color         The chaser color.
@@ -235,19 +292,20 @@ static int pushBreatherSequence(uint32_t section, Color_t *color,
 static int pushFadeChaserSequence(uint32_t section, Color_t *color,
                                   uint32_t length, bool isinverted)
 {
-  LedSequence_t sequence = {.sectionId = section,
+  LedSequence_t sequence = {.version = APP_MSG_LED_SEQ_VERSION,
+                            .sectionId = section,
                             .timeBase = length,
                             .timeUnit = SECONDS};
 
   sequence.seqType = isinverted ? SEQ_INVERT_FADE_CHASER : SEQ_FADE_CHASER;
 
-  sequence.startColor.hexColor = color->hexColor;
+  appMsgPackColor(color, &sequence.startColor);
 
-  return appMsgPushLedSequence(&sequence);
+  return submitSequence(&sequence);
 }
 
 /**
- * @brief   Push a color range sequence in the sequence queue.
+ * @brief   Push a color range sequence in the sequence mailbox.
  *
  * @param section       The LED strip section.
  * @param startClr      The range start color.
@@ -259,19 +317,20 @@ static int pushFadeChaserSequence(uint32_t section, Color_t *color,
 static int pushColorRangeSequence(uint32_t section, Color_t *startClr,
                                   Color_t *endClr, uint32_t length)
 {
-  LedSequence_t sequence = {.sectionId = section,
+  LedSequence_t sequence = {.version = APP_MSG_LED_SEQ_VERSION,
+                            .sectionId = section,
                             .seqType = SEQ_COLOR_RANGE,
                             .timeBase = length,
                             .timeUnit = SECONDS};
 
-  sequence.startColor.hexColor = startClr->hexColor;
-  sequence.endColor.hexColor = endClr->hexColor;
+  appMsgPackColor(startClr, &sequence.startColor);
+  appMsgPackColor(endClr, &sequence.endColor);
 
-  return appMsgPushLedSequence(&sequence);
+  return submitSequence(&sequence);
 }
 
 /**
- * @brief   Push a color range chaser sequence in the sequence queue.
+ * @brief   Push a color range chaser sequence in the sequence mailbox.
  *
  * @param section       The LED strip section.
  * @param startClr      The start color of the range.
@@ -285,16 +344,17 @@ static int pushRangeChaserSequence(uint32_t section, Color_t *startClr,
                                    Color_t *endClr, uint32_t length,
                                    bool isinverted)
 {
-  LedSequence_t sequence = {.sectionId = section,
+  LedSequence_t sequence = {.version = APP_MSG_LED_SEQ_VERSION,
+                            .sectionId = section,
                             .timeBase = length,
                             .timeUnit = SECONDS};
 
   sequence.seqType = isinverted ? SEQ_INVERT_RANGE_CHASER : SEQ_RANGE_CHASER;
 
-  sequence.startColor.hexColor = startClr->hexColor;
-  sequence.endColor.hexColor = endClr->hexColor;
+  appMsgPackColor(startClr, &sequence.startColor);
+  appMsgPackColor(endClr, &sequence.endColor);
 
-  return appMsgPushLedSequence(&sequence);
+  return submitSequence(&sequence);
 }
 
 /**
@@ -476,6 +536,105 @@ static int execRangeChaserSeq(const struct shell *shell, size_t argc, char **arg
   return -EINVAL;
 }
 
+/**
+ * @brief   Execute the sequence stats command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStatsSeq(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  shell_print(shell, "coalesced sequences: %u", appMsgGetCoalescedCount());
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the sequence begin command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execBeginSeq(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  appMsgBeginLedTransaction(&transaction);
+  isTransactionOpen = true;
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the sequence commit command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+static int execCommitSeq(const struct shell *shell, size_t argc, char **argv)
+{
+  int rc;
+
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  if(!isTransactionOpen)
+  {
+    shell_print(shell, "FAILED: No transaction to commit.");
+    return -EINVAL;
+  }
+
+  rc = appMsgCommitLedTransaction(&transaction);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to commit the sequence transaction");
+    return rc;
+  }
+
+  isTransactionOpen = false;
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the sequence abort command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execAbortSeq(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  appMsgBeginLedTransaction(&transaction);
+  isTransactionOpen = false;
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(seq_sub,
 	SHELL_CMD_ARG(solid, NULL, SEQ_SOLID_USAGE, execSolidSeq,
                 SOLID_SEQ_ARG_CNT, 0),
@@ -487,6 +646,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(seq_sub,
                 COLOR_RANGE_SEQ_ARG_CNT, 0),
   SHELL_CMD_ARG(range, NULL, SEQ_RANGE_CHASER_USAGE, execRangeChaserSeq,
                 RANGE_CHASER_SEQ_ARG_CNT, 0),
+  SHELL_CMD(stats, NULL, SEQ_STATS_USAGE, execStatsSeq),
+  SHELL_CMD(begin, NULL, SEQ_BEGIN_USAGE, execBeginSeq),
+  SHELL_CMD(commit, NULL, SEQ_COMMIT_USAGE, execCommitSeq),
+  SHELL_CMD(abort, NULL, SEQ_ABORT_USAGE, execAbortSeq),
 	SHELL_SUBCMD_SET_END);
 SHELL_CMD_REGISTER(sequence, &seq_sub, SEQ_USAGE,	NULL);
 
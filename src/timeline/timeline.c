@@ -0,0 +1,349 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      timeline.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Timeline Module
+ *
+ *            This file is the implementation of the timeline module.
+ *
+ * @ingroup  timeline
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_TIMELINE
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/barrier.h>
+
+#include <string.h>
+
+#include "colorManager.h"
+#include "timeline.h"
+
+#define TIMELINE_MODULE_NAME timeline_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(TIMELINE_MODULE_NAME);
+
+BUILD_ASSERT(CONFIG_LED_MNGR_TIMELINE_SIZE % sizeof(uint32_t) == 0 &&
+  CONFIG_LED_MNGR_TIMELINE_SIZE <= UINT16_MAX,
+  "the timeline buffer size must be a multiple of 4, up to 65535 bytes");
+
+/**
+ * @brief The fixed-point fractional bit count of the show clock and of the
+ *        interpolation weight.
+*/
+#define TIMELINE_FIXED_SHIFT                        16
+
+/**
+ * @brief The fixed-point one.
+*/
+#define TIMELINE_FIXED_ONE                          (1UL << TIMELINE_FIXED_SHIFT)
+
+/**
+ * @brief The playback context of a track.
+*/
+typedef struct
+{
+  const TimelineKey_t *keys;            /**< The track keyframes, in the buffer. */
+  uint8_t keyCount;                     /**< The keyframe count, 0 without track. */
+  uint8_t keyIdx;                       /**< The current keyframe. */
+  bool isRendered;                      /**< The color rendered flag. */
+  Color_t color;                        /**< The last rendered color. */
+} TimelineTrackCtx_t;
+
+/**
+ * @brief The show state. The active flag is written by the producer, and by
+ *        the consumer when the show ends. The in use flag is set by the
+ *        producer and cleared by the consumer.
+*/
+typedef struct
+{
+  volatile bool isActive;               /**< The show playing flag. */
+  volatile bool isInUse;                /**< The show not released flag. */
+  uint8_t trackCount;                   /**< The track count. */
+  uint8_t flags;                        /**< The show flags. */
+  uint32_t durationMs;                  /**< The show duration (msec). */
+  uint32_t positionMs;                  /**< The show position (msec). */
+  uint32_t phase;                       /**< The position fraction (16.16). */
+  uint32_t phaseStep;                   /**< The per-frame position increment (16.16). */
+} TimelineShow_t;
+
+/**
+ * @brief The show buffer, aligned so the show structures are read in place.
+*/
+static uint8_t buffer[CONFIG_LED_MNGR_TIMELINE_SIZE] __aligned(4);
+
+/**
+ * @brief The track playback contexts, indexed by section ID.
+*/
+static TimelineTrackCtx_t tracks[APP_MSG_LED_SECTION_COUNT];
+
+/**
+ * @brief The show state.
+*/
+static TimelineShow_t show;
+
+/**
+ * @brief   Check the keyframes of a track.
+ *
+ * @param keys        The keyframes.
+ * @param keyCount    The keyframe count.
+ * @param durationMs  The show duration (msec).
+ *
+ * @return  0 if the keyframes are valid, -EBADMSG otherwise.
+ */
+static int checkKeys(const TimelineKey_t *keys, uint8_t keyCount,
+                     uint32_t durationMs)
+{
+  for(uint8_t i = 0; i < keyCount; ++i)
+  {
+    if(keys[i].timeMs > durationMs || keys[i].curve >= TIMELINE_CURVE_COUNT ||
+      (i > 0 && keys[i].timeMs < keys[i - 1].timeMs))
+      return -EBADMSG;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief   Check the show in the buffer and index its tracks.
+ *
+ * @return  0 if the show is valid, -EBADMSG otherwise.
+ */
+static int loadShow(void)
+{
+  const TimelineHeader_t *header = (const TimelineHeader_t *)buffer;
+  const TimelineTrack_t *track;
+  TimelineTrackCtx_t *ctx;
+  size_t offset = sizeof(*header);
+
+  memset(tracks, 0x00, sizeof(tracks));
+
+  if(header->version != TIMELINE_VERSION || header->trackCount == 0 ||
+    header->trackCount > APP_MSG_LED_SECTION_COUNT || header->durationMs == 0)
+    return -EBADMSG;
+
+  for(uint8_t i = 0; i < header->trackCount; ++i)
+  {
+    if(offset + sizeof(*track) > sizeof(buffer))
+      return -EBADMSG;
+
+    track = (const TimelineTrack_t *)(buffer + offset);
+    offset += sizeof(*track);
+
+    if(track->sectionId >= APP_MSG_LED_SECTION_COUNT ||
+      tracks[track->sectionId].keyCount != 0 || track->keyCount == 0 ||
+      offset + track->keyCount * sizeof(TimelineKey_t) > sizeof(buffer))
+      return -EBADMSG;
+
+    ctx = tracks + track->sectionId;
+    ctx->keys = (const TimelineKey_t *)(buffer + offset);
+    if(checkKeys(ctx->keys, track->keyCount, header->durationMs) < 0)
+      return -EBADMSG;
+
+    ctx->keyCount = track->keyCount;
+    offset += track->keyCount * sizeof(TimelineKey_t);
+  }
+
+  show.trackCount = header->trackCount;
+  show.flags = header->flags;
+  show.durationMs = header->durationMs;
+
+  return 0;
+}
+
+int timelineWrite(uint16_t offset, const uint8_t *data, size_t len)
+{
+  if(show.isInUse)
+    return -EBUSY;
+
+  if(offset + len > sizeof(buffer))
+    return -EINVAL;
+
+  memcpy(buffer + offset, data, len);
+
+  return 0;
+}
+
+int timelinePlay(void)
+{
+  int rc;
+
+  if(show.isInUse)
+    return -EBUSY;
+
+  rc = loadShow();
+  if(rc < 0)
+  {
+    LOG_ERR("invalid show");
+    return rc;
+  }
+
+  show.isInUse = true;
+  barrier_dmem_fence_full();
+  show.isActive = true;
+
+  appMsgNotifyLedManager();
+
+  return 0;
+}
+
+void timelineStop(void)
+{
+  show.isActive = false;
+
+  appMsgNotifyLedManager();
+}
+
+bool timelineIsActive(void)
+{
+  return show.isActive;
+}
+
+void timelineRewind(uint32_t fps)
+{
+  show.positionMs = 0;
+  show.phase = 0;
+  show.phaseStep = fps == 0 ? 0 :
+    (MSEC_PER_SEC << TIMELINE_FIXED_SHIFT) / fps;
+
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+  {
+    tracks[i].keyIdx = 0;
+    tracks[i].isRendered = false;
+  }
+}
+
+bool timelineAdvance(void)
+{
+  show.phase += show.phaseStep;
+  show.positionMs += show.phase >> TIMELINE_FIXED_SHIFT;
+  show.phase &= TIMELINE_FIXED_ONE - 1;
+
+  if(show.positionMs < show.durationMs)
+    return true;
+
+  if(!(show.flags & TIMELINE_FLAG_LOOP))
+  {
+    show.positionMs = show.durationMs;
+    show.isActive = false;
+    return false;
+  }
+
+  show.positionMs %= show.durationMs;
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+    tracks[i].keyIdx = 0;
+
+  return true;
+}
+
+bool timelineHasTrack(uint8_t sectionId)
+{
+  return sectionId < APP_MSG_LED_SECTION_COUNT &&
+    tracks[sectionId].keyCount != 0;
+}
+
+/**
+ * @brief   Shape a linear interpolation weight with a keyframe curve.
+ *
+ * @param curve       The keyframe curve.
+ * @param weight      The linear weight (0.16), below one.
+ *
+ * @return  The shaped weight (0.16).
+ */
+static uint32_t applyCurve(uint8_t curve, uint32_t weight)
+{
+  uint32_t inverse;
+
+  switch(curve)
+  {
+    case TIMELINE_CURVE_LINEAR:
+      return weight;
+    case TIMELINE_CURVE_EASE_IN:
+      return weight * weight >> TIMELINE_FIXED_SHIFT;
+    case TIMELINE_CURVE_EASE_OUT:
+      inverse = TIMELINE_FIXED_ONE - weight;
+      return TIMELINE_FIXED_ONE -
+        (uint32_t)((uint64_t)inverse * inverse >> TIMELINE_FIXED_SHIFT);
+    case TIMELINE_CURVE_EASE_IN_OUT:
+      return (uint32_t)((uint64_t)weight * weight *
+        (3 * TIMELINE_FIXED_ONE - 2 * weight) >> (2 * TIMELINE_FIXED_SHIFT));
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @brief   Interpolate a color channel.
+ *
+ * @param from        The channel value at weight 0.
+ * @param to          The channel value at weight one.
+ * @param weight      The weight (0.16).
+ *
+ * @return  The interpolated channel value.
+ */
+static inline uint8_t mixChannel(uint8_t from, uint8_t to, uint32_t weight)
+{
+  return (from * (TIMELINE_FIXED_ONE - weight) + to * weight +
+    TIMELINE_FIXED_ONE / 2) >> TIMELINE_FIXED_SHIFT;
+}
+
+bool timelineRender(uint8_t sectionId, ZephyrRgbPixel_t *pixels,
+                    size_t pixelCnt)
+{
+  TimelineTrackCtx_t *ctx = tracks + sectionId;
+  const TimelineKey_t *key;
+  const TimelineKey_t *next;
+  uint32_t weight = 0;
+  Color_t color;
+
+  if(!timelineHasTrack(sectionId))
+    return false;
+
+  while(ctx->keyIdx + 1 < ctx->keyCount &&
+    ctx->keys[ctx->keyIdx + 1].timeMs <= show.positionMs)
+    ++ctx->keyIdx;
+
+  key = ctx->keys + ctx->keyIdx;
+  next = key;
+  if(show.positionMs >= key->timeMs && ctx->keyIdx + 1 < ctx->keyCount)
+  {
+    next = key + 1;
+    weight = applyCurve(key->curve, ((uint64_t)(show.positionMs -
+      key->timeMs) << TIMELINE_FIXED_SHIFT) / (next->timeMs - key->timeMs));
+  }
+
+  color.hexColor = 0;
+  color.r = mixChannel(key->color.r, next->color.r, weight);
+  color.g = mixChannel(key->color.g, next->color.g, weight);
+  color.b = mixChannel(key->color.b, next->color.b, weight);
+
+  if(ctx->isRendered && color.hexColor == ctx->color.hexColor)
+    return false;
+
+  ctx->isRendered = true;
+  ctx->color = color;
+  colorMngrSetSingle(&color, pixels, pixelCnt);
+
+  return true;
+}
+
+void timelineRelease(void)
+{
+  show.isInUse = false;
+}
+
+void timelineGetStatus(TimelineStatus_t *status)
+{
+  status->isActive = show.isActive;
+  status->trackCount = show.trackCount;
+  status->positionMs = show.positionMs;
+  status->durationMs = show.durationMs;
+}
+#endif
+
+/** @} */
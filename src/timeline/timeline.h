@@ -0,0 +1,202 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      timeline.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Timeline Module
+ *
+ *            This file is the declaration of the timeline module, the
+ *            keyframe shows uploaded by the main controller and played
+ *            without host traffic.
+ *
+ *            A show is a binary blob (little-endian), written in the
+ *            timeline buffer in chunks and checked when played:
+ *            - a TimelineHeader_t.
+ *            - for each track, a TimelineTrack_t followed by its keyframes,
+ *              TimelineKey_t ordered by time.
+ *            A track drives the color of one section. Before its first
+ *            keyframe, the section holds the first keyframe color, after
+ *            its last keyframe, it holds the last keyframe color. Between
+ *            2 keyframes, the color is interpolated with the curve of the
+ *            first one. A looping show restarts at its end, otherwise the
+ *            show stops and its sections render their sequences again.
+ *
+ *            The producer (the host link) writes, plays and stops the show,
+ *            the consumer (the LED manager) advances and renders it on each
+ *            frame deadline. The buffer can only be written once the
+ *            consumer released the show.
+ *
+ * @defgroup  timeline timeline
+ *
+ * @{
+ */
+
+#ifndef TIMELINE
+#define TIMELINE
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "appMsg.h"
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief The show layout version.
+*/
+#define TIMELINE_VERSION                            1
+
+/**
+ * @brief The show loop flag.
+*/
+#define TIMELINE_FLAG_LOOP                          0x01
+
+/**
+ * @brief The keyframe interpolation curve.
+*/
+typedef enum
+{
+  TIMELINE_CURVE_STEP,                  /**< Hold the color up to the next keyframe. */
+  TIMELINE_CURVE_LINEAR,                /**< The linear curve. */
+  TIMELINE_CURVE_EASE_IN,               /**< The quadratic ease-in curve. */
+  TIMELINE_CURVE_EASE_OUT,              /**< The quadratic ease-out curve. */
+  TIMELINE_CURVE_EASE_IN_OUT,           /**< The smoothstep ease-in-out curve. */
+  TIMELINE_CURVE_COUNT,                 /**< The curve count. */
+} TimelineCurve_t;
+
+/**
+ * @brief The show header.
+*/
+typedef struct
+{
+  uint8_t version;                      /**< The layout version (TIMELINE_VERSION). */
+  uint8_t trackCount;                   /**< The track count. */
+  uint8_t flags;                        /**< The show flags (TIMELINE_FLAG_LOOP). */
+  uint8_t reserved;                     /**< Reserved, 0. */
+  uint32_t durationMs;                  /**< The show duration (msec). */
+} TimelineHeader_t;
+
+/**
+ * @brief The track header.
+*/
+typedef struct
+{
+  uint8_t sectionId;                    /**< The section driven by the track. */
+  uint8_t keyCount;                     /**< The track keyframe count. */
+  uint16_t reserved;                    /**< Reserved, 0. */
+} TimelineTrack_t;
+
+/**
+ * @brief The keyframe.
+*/
+typedef struct
+{
+  uint32_t timeMs;                      /**< The keyframe time from the show start (msec). */
+  PackedColor_t color;                  /**< The keyframe color. */
+  uint8_t curve;                        /**< The curve to the next keyframe (TimelineCurve_t). */
+} TimelineKey_t;
+
+BUILD_ASSERT(sizeof(TimelineHeader_t) == 8, "the show header must be 8 bytes");
+BUILD_ASSERT(sizeof(TimelineTrack_t) == 4, "the track header must be 4 bytes");
+BUILD_ASSERT(sizeof(TimelineKey_t) == 8, "the keyframe must be 8 bytes");
+
+/**
+ * @brief The timeline status.
+*/
+typedef struct
+{
+  bool isActive;                        /**< The show playing flag. */
+  uint8_t trackCount;                   /**< The show track count. */
+  uint32_t positionMs;                  /**< The show position (msec). */
+  uint32_t durationMs;                  /**< The show duration (msec). */
+} TimelineStatus_t;
+
+/**
+ * @brief   Write a chunk of the show in the timeline buffer. Producer side.
+ *
+ * @param offset      The chunk offset in the show.
+ * @param data        The chunk data.
+ * @param len         The chunk length.
+ *
+ * @return  0 if successful, -EBUSY if the show is not released, -EINVAL if
+ *          the chunk is out of the buffer.
+ */
+int timelineWrite(uint16_t offset, const uint8_t *data, size_t len);
+
+/**
+ * @brief   Check and play the show in the timeline buffer from its start.
+ *          The LED manager renders its tracks in place of the sequences of
+ *          their sections. Producer side.
+ *
+ * @return  0 if successful, -EBUSY if the show is not released, -EBADMSG if
+ *          the show is invalid.
+ */
+int timelinePlay(void);
+
+/**
+ * @brief   Stop the show. The LED manager releases it and renders the
+ *          sequences again. Producer side.
+ */
+void timelineStop(void);
+
+/**
+ * @brief   Check if the show is playing.
+ *
+ * @return  True if the show is playing, false otherwise.
+ */
+bool timelineIsActive(void);
+
+/**
+ * @brief   Rewind the show to its start. Consumer side.
+ *
+ * @param fps         The frame rate the show is advanced at.
+ */
+void timelineRewind(uint32_t fps);
+
+/**
+ * @brief   Advance the show by one frame. Consumer side.
+ *
+ * @return  True if the show goes on, false if it reached its end and
+ *          stopped.
+ */
+bool timelineAdvance(void);
+
+/**
+ * @brief   Check if the show has a track for a section. Consumer side.
+ *
+ * @param sectionId   The section ID.
+ *
+ * @return  True if the section has a track, false otherwise.
+ */
+bool timelineHasTrack(uint8_t sectionId);
+
+/**
+ * @brief   Update the pixels of a section for the current show position.
+ *          Consumer side.
+ *
+ * @param sectionId   The section ID.
+ * @param pixels      The section pixel buffer.
+ * @param pixelCnt    The section pixel count.
+ *
+ * @return  True if the pixels were updated, false otherwise.
+ */
+bool timelineRender(uint8_t sectionId, ZephyrRgbPixel_t *pixels,
+                    size_t pixelCnt);
+
+/**
+ * @brief   Release the stopped show, so the buffer can be written again.
+ *          Consumer side.
+ */
+void timelineRelease(void);
+
+/**
+ * @brief   Get the timeline status.
+ *
+ * @param status      The output status.
+ */
+void timelineGetStatus(TimelineStatus_t *status);
+
+#endif    /* TIMELINE */
+
+/** @} */
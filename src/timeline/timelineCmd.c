@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      timelineCmd.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Timeline Command Module
+ *
+ *            This file is the implementation of the timeline commands.
+ *
+ * @ingroup  timeline
+ *
+ * @{
+ */
+
+#ifdef CONFIG_LED_MNGR_TIMELINE
+#include <zephyr/shell/shell.h>
+
+#include "timeline.h"
+
+/**
+ * @brief The timeline command usage.
+*/
+#define TIMELINE_USAGE          "Keyframe show related commands."
+
+/**
+ * @brief The timeline status command usage.
+*/
+#define TIMELINE_STATUS_USAGE   "Display the show status: timeline status"
+
+/**
+ * @brief The timeline stop command usage.
+*/
+#define TIMELINE_STOP_USAGE     "Stop the show: timeline stop"
+
+/**
+ * @brief   Execute the timeline status command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStatus(const struct shell *shell, size_t argc, char **argv)
+{
+  TimelineStatus_t status;
+
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  timelineGetStatus(&status);
+
+  shell_print(shell, "active: %s", status.isActive ? "yes" : "no");
+  shell_print(shell, "tracks: %u", status.trackCount);
+  shell_print(shell, "position: %u/%u ms", status.positionMs,
+    status.durationMs);
+
+  return 0;
+}
+
+/**
+ * @brief   Execute the timeline stop command.
+ *
+ * @param shell     The shell instance.
+ * @param argc      The command argument count.
+ * @param argv      The command argument vector.
+ *
+ * @return  Always 0.
+ */
+static int execStop(const struct shell *shell, size_t argc, char **argv)
+{
+  ARG_UNUSED(argc);
+  ARG_UNUSED(argv);
+
+  timelineStop();
+
+  shell_print(shell, "OK");
+
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(timeline_sub,
+  SHELL_CMD(status, NULL, TIMELINE_STATUS_USAGE, execStatus),
+  SHELL_CMD(stop, NULL, TIMELINE_STOP_USAGE, execStop),
+  SHELL_SUBCMD_SET_END);
+SHELL_CMD_REGISTER(timeline, &timeline_sub, TIMELINE_USAGE, NULL);
+#endif
+
+/** @} */
@@ -0,0 +1,224 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      ws2812Encoder.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     WS2812 Encoder Module
+ *
+ *            This file is the implementation of the WS2812 SPI encoder
+ *            module.
+ *
+ * @ingroup  ws2812Encoder
+ *
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/dt-bindings/led/led.h>
+
+#include "colorManager.h"
+#include "powerLimiter.h"
+#include "ws2812Encoder.h"
+
+#define WS2812_ENC_MODULE_NAME ws2812_enc_module
+
+/* Setting module logging */
+LOG_MODULE_REGISTER(WS2812_ENC_MODULE_NAME);
+
+#ifndef CONFIG_ZTEST
+/**
+ * @brief The LED strip node.
+*/
+#define WS2812_ENC_NODE                             DT_ALIAS(led_strip)
+
+BUILD_ASSERT(DT_PROP_LEN(WS2812_ENC_NODE, color_mapping) == 3,
+  "the WS2812 encoder only supports RGB strips");
+
+/**
+ * @brief The SPI symbol of a 1 bit.
+*/
+#define WS2812_ENC_ONE_FRAME                  DT_PROP(WS2812_ENC_NODE, spi_one_frame)
+
+/**
+ * @brief The SPI symbol of a 0 bit.
+*/
+#define WS2812_ENC_ZERO_FRAME                 DT_PROP(WS2812_ENC_NODE, spi_zero_frame)
+
+/**
+ * @brief The strip reset delay (usec).
+*/
+#define WS2812_ENC_RESET_DELAY                DT_PROP(WS2812_ENC_NODE, reset_delay)
+
+/**
+ * @brief   Get the pixel byte offset of a strip color channel.
+ *
+ * @param idx     The channel index in the strip color order.
+*/
+#define WS2812_ENC_CHANNEL_OFFSET(idx)                                        \
+  (DT_PROP_BY_IDX(WS2812_ENC_NODE, color_mapping, idx) == LED_COLOR_ID_RED ?  \
+    offsetof(ZephyrRgbPixel_t, r) :                                           \
+    DT_PROP_BY_IDX(WS2812_ENC_NODE, color_mapping, idx) == LED_COLOR_ID_GREEN ? \
+    offsetof(ZephyrRgbPixel_t, g) : offsetof(ZephyrRgbPixel_t, b))
+
+/**
+ * @brief The SPI bus of the LED strip.
+*/
+static const struct spi_dt_spec spiBus = SPI_DT_SPEC_GET(WS2812_ENC_NODE,
+  SPI_OP_MODE_MASTER | SPI_TRANSFER_MSB | SPI_WORD_SET(8), 0);
+#else
+#define WS2812_ENC_ONE_FRAME                        0x7c
+#define WS2812_ENC_ZERO_FRAME                       0x60
+#define WS2812_ENC_RESET_DELAY                      250
+#define WS2812_ENC_CHANNEL_OFFSET(idx)                                        \
+  ((idx) == 0 ? offsetof(ZephyrRgbPixel_t, g) :                               \
+    (idx) == 1 ? offsetof(ZephyrRgbPixel_t, r) : offsetof(ZephyrRgbPixel_t, b))
+
+static const struct spi_dt_spec spiBus;
+#endif
+
+/**
+ * @brief   Get the SPI symbol of a nibble bit.
+ *
+ * @param nibble  The nibble.
+ * @param bit     The bit index.
+*/
+#define WS2812_ENC_SYMBOL(nibble, bit)                                        \
+  ((uint32_t)((nibble) & BIT(bit) ? WS2812_ENC_ONE_FRAME :                    \
+    WS2812_ENC_ZERO_FRAME))
+
+#ifdef CONFIG_BIG_ENDIAN
+#define WS2812_ENC_NIBBLE(nibble)                                             \
+  (WS2812_ENC_SYMBOL(nibble, 3) << 24 | WS2812_ENC_SYMBOL(nibble, 2) << 16 |  \
+    WS2812_ENC_SYMBOL(nibble, 1) << 8 | WS2812_ENC_SYMBOL(nibble, 0))
+#else
+/**
+ * @brief   Get the symbol word of a nibble. The most significant bit symbol
+ *          is the first byte in memory, so it is the first sent on the bus.
+ *
+ * @param nibble  The nibble.
+*/
+#define WS2812_ENC_NIBBLE(nibble)                                             \
+  (WS2812_ENC_SYMBOL(nibble, 3) | WS2812_ENC_SYMBOL(nibble, 2) << 8 |         \
+    WS2812_ENC_SYMBOL(nibble, 1) << 16 | WS2812_ENC_SYMBOL(nibble, 0) << 24)
+#endif
+
+/**
+ * @brief The nibble to symbol word table, stored in flash.
+*/
+static const uint32_t nibbleSymbols[16] = {
+  WS2812_ENC_NIBBLE(0x0), WS2812_ENC_NIBBLE(0x1), WS2812_ENC_NIBBLE(0x2),
+  WS2812_ENC_NIBBLE(0x3), WS2812_ENC_NIBBLE(0x4), WS2812_ENC_NIBBLE(0x5),
+  WS2812_ENC_NIBBLE(0x6), WS2812_ENC_NIBBLE(0x7), WS2812_ENC_NIBBLE(0x8),
+  WS2812_ENC_NIBBLE(0x9), WS2812_ENC_NIBBLE(0xa), WS2812_ENC_NIBBLE(0xb),
+  WS2812_ENC_NIBBLE(0xc), WS2812_ENC_NIBBLE(0xd), WS2812_ENC_NIBBLE(0xe),
+  WS2812_ENC_NIBBLE(0xf),
+};
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+/**
+ * @brief The power limiter scale applied while encoding.
+*/
+static uint16_t outputScale = POWER_LIMITER_SCALE_ONE;
+#endif
+
+/**
+ * @brief   Get the output level of a channel, gamma corrected and scaled to
+ *          the current budget while encoding.
+ *
+ * @param gammaLut    The gamma table, unused without the gamma correction.
+ * @param value       The linear channel value.
+ *
+ * @return  The output level.
+ */
+static inline uint8_t getLevel(const uint8_t *gammaLut, uint8_t value)
+{
+#ifdef CONFIG_LED_MNGR_GAMMA
+  value = gammaLut[value];
+#endif
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+  value = (value * outputScale) >> POWER_LIMITER_SCALE_SHIFT;
+#endif
+  return value;
+}
+
+/**
+ * @brief   Encode a color channel into its 2 symbol words.
+ *
+ * @param value       The channel value.
+ * @param symbols     The output symbols.
+ */
+static inline void encodeChannel(uint8_t value, uint32_t *symbols)
+{
+  symbols[0] = nibbleSymbols[value >> 4];
+  symbols[1] = nibbleSymbols[value & 0x0f];
+}
+
+int ws2812EncInit(void)
+{
+  if(!spi_is_ready_dt(&spiBus))
+  {
+    LOG_ERR("the LED strip SPI bus is not ready");
+    return -ENODEV;
+  }
+
+  return 0;
+}
+
+void ws2812EncEncode(const ZephyrRgbPixel_t *pixels, size_t pixelCnt,
+  uint32_t *symbols)
+{
+  const uint8_t *channels;
+  const uint8_t *gammaLut = NULL;
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+  gammaLut = colorMngrGetGammaLut();
+#endif
+
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    channels = (const uint8_t *)(pixels + i);
+    encodeChannel(getLevel(gammaLut,
+      channels[WS2812_ENC_CHANNEL_OFFSET(0)]), symbols);
+    encodeChannel(getLevel(gammaLut,
+      channels[WS2812_ENC_CHANNEL_OFFSET(1)]), symbols + 2);
+    encodeChannel(getLevel(gammaLut,
+      channels[WS2812_ENC_CHANNEL_OFFSET(2)]), symbols + 4);
+    symbols += WS2812_ENC_WORDS_PER_LED;
+  }
+}
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+void ws2812EncSetScale(uint16_t scale)
+{
+  outputScale = scale;
+}
+#endif
+
+int ws2812EncSend(const uint32_t *symbols, size_t pixelCnt)
+{
+  int rc;
+  const struct spi_buf buf = {
+    .buf = (void *)symbols,
+    .len = pixelCnt * WS2812_ENC_SYMBOLS_PER_LED,
+  };
+  const struct spi_buf_set tx = {
+    .buffers = &buf,
+    .count = 1,
+  };
+
+  rc = spi_write_dt(&spiBus, &tx);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to send the LED strip symbols");
+    return rc;
+  }
+
+  k_usleep(WS2812_ENC_RESET_DELAY);
+
+  return 0;
+}
+
+/** @} */
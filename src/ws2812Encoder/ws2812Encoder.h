@@ -0,0 +1,75 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      ws2812Encoder.h
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     WS2812 Encoder Module
+ *
+ *            This file is the declaration of the WS2812 SPI encoder module.
+ *
+ * @defgroup  ws2812Encoder ws2812Encoder
+ *
+ * @{
+ */
+
+#ifndef WS2812_ENCODER
+#define WS2812_ENCODER
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief The SPI symbol count of a LED, one symbol byte per color bit.
+*/
+#define WS2812_ENC_SYMBOLS_PER_LED                  24
+
+/**
+ * @brief The symbol word count of a LED, one 32 bits word per color nibble.
+*/
+#define WS2812_ENC_WORDS_PER_LED                    (WS2812_ENC_SYMBOLS_PER_LED / 4)
+
+/**
+ * @brief   Initialize the WS2812 encoder.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+int ws2812EncInit(void);
+
+/**
+ * @brief   Encode pixels into WS2812 SPI symbols. Each color bit becomes an
+ *          SPI symbol byte, in the strip color order. With the output gamma
+ *          correction and the power limiter, each channel is corrected and
+ *          scaled while encoded.
+ *
+ * @param pixels      The pixels to encode.
+ * @param pixelCnt    The pixel count.
+ * @param symbols     The output symbols, WS2812_ENC_WORDS_PER_LED words per
+ *                    pixel.
+ */
+void ws2812EncEncode(const ZephyrRgbPixel_t *pixels, size_t pixelCnt,
+  uint32_t *symbols);
+
+/**
+ * @brief   Set the power limiter scale applied while encoding.
+ *
+ * @param scale       The scale, POWER_LIMITER_SCALE_ONE for full level.
+ */
+void ws2812EncSetScale(uint16_t scale);
+
+/**
+ * @brief   Send encoded symbols to the LED strip and wait for the strip
+ *          reset delay.
+ *
+ * @param symbols     The symbols to send.
+ * @param pixelCnt    The pixel count of the symbols.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+int ws2812EncSend(const uint32_t *symbols, size_t pixelCnt);
+
+#endif    /* WS2812_ENCODER */
+
+/** @} */
@@ -14,194 +14,494 @@
  */
 
 #include <zephyr/ztest.h>
-#include <zephyr/fff.h>
 
 #include "appMsg.h"
 #include "appMsg.c"
 
 #include "zephyrCommon.h"
-#include "zephyrMsgQueue.h"
-
-DEFINE_FFF_GLOBALS;
-
-FAKE_VALUE_FUNC(int, zephyrMsgQueueInit, ZephyrMsgQueue_t*, size_t, size_t);
-FAKE_VALUE_FUNC(int, zephyrMsgQueuePush, ZephyrMsgQueue_t*, const void*,
-  uint32_t, ZephyrTimeUnit_t);
-FAKE_VALUE_FUNC(int, zephyrMsgQueuePop, ZephyrMsgQueue_t*, void*, uint32_t,
-  ZephyrTimeUnit_t);
 
 static void messagesCaseSetup(void *f)
 {
-  RESET_FAKE(zephyrMsgQueueInit);
-  RESET_FAKE(zephyrMsgQueuePush);
-  RESET_FAKE(zephyrMsgQueuePop);
+  appMsgInit();
+  k_poll_signal_reset(&ledSeqSignal);
 }
 
 ZTEST_SUITE(messages_suite, NULL, NULL, messagesCaseSetup, NULL, NULL);
 
 /**
- * @test  appMsgInit must return the error code as soon as the initialization
- *        of a message queue fails.
+ * @test  appMsgInit must empty the mailbox and clear the coalesced count.
+*/
+ZTEST(messages_suite, test_appMsgInit_Success)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 0};
+
+  appMsgPushLedSequence(&msg);
+  appMsgPushLedSequence(&msg);
+
+  zassert_equal(0, appMsgInit(), "appMsgInit failed to return the success code");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgInit failed to empty the mailbox.");
+  zassert_equal(0, appMsgGetCoalescedCount(),
+    "appMsgInit failed to clear the coalesced count.");
+}
+
+/**
+ * @test  appMsgPackColor and appMsgUnpackColor must keep the color
+ *        components.
+*/
+ZTEST(messages_suite, test_appMsgPackColor_RoundTrip)
+{
+  Color_t color = {.hexColor = 0x123456};
+  Color_t unpacked = {.hexColor = 0xff000000};
+  PackedColor_t packed;
+
+  appMsgPackColor(&color, &packed);
+
+  zassert_equal(0x12, packed.r, "appMsgPackColor failed to pack the red.");
+  zassert_equal(0x34, packed.g, "appMsgPackColor failed to pack the green.");
+  zassert_equal(0x56, packed.b, "appMsgPackColor failed to pack the blue.");
+
+  appMsgUnpackColor(&packed, &unpacked);
+
+  zassert_equal(color.hexColor, unpacked.hexColor,
+    "appMsgUnpackColor failed to unpack the color.");
+}
+
+/**
+ * @test  appMsgGetTimeBase must convert the message time base to the Zephyr
+ *        wrapper convention.
+*/
+ZTEST(messages_suite, test_appMsgGetTimeBase_Convert)
+{
+  LedSequence_t msg = {.timeBase = 1234};
+
+  zassert_equal(1234, appMsgGetTimeBase(&msg),
+    "appMsgGetTimeBase failed to return the time base.");
+
+  msg.timeBase = APP_MSG_TIME_FOREVER;
+  zassert_equal(ZEPHYR_TIME_FOREVER, appMsgGetTimeBase(&msg),
+    "appMsgGetTimeBase failed to convert the forever time base.");
+}
+
+/**
+ * @test  appMsgPushLedSequence must reject a message of another layout
+ *        version.
+*/
+ZTEST(messages_suite, test_appMsgPushLedSequence_InvalidVersion)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION + 1,
+                       .sectionId = 0};
+
+  zassert_equal(-EPROTONOSUPPORT, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the error code.");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgPushLedSequence failed to leave the mailbox empty.");
+}
+
+/**
+ * @test  appMsgPushLedSequence must reject a message of an invalid section.
+*/
+ZTEST(messages_suite, test_appMsgPushLedSequence_InvalidSection)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = APP_MSG_LED_SECTION_COUNT};
+
+  zassert_equal(-EINVAL, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the error code.");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgPushLedSequence failed to leave the mailbox empty.");
+  zassert_equal(-EAGAIN, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgPushLedSequence failed to leave the sequence signal clear.");
+}
+
+/**
+ * @test  appMsgPushLedSequence must reject a message of an unknown sequence
+ *        type, and a program sequence without the effect program VM.
+*/
+ZTEST(messages_suite, test_appMsgPushLedSequence_InvalidType)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 0,
+                       .seqType = SEQ_COUNT};
+
+  zassert_equal(-EINVAL, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the error code.");
+
+  msg.seqType = SEQ_PROGRAM;
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+  zassert_equal(0, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the success code.");
+  zassert_equal(0, appMsgPopLedSequence(&msg),
+    "appMsgPushLedSequence failed to push the program sequence.");
+#else
+  zassert_equal(-EINVAL, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the error code.");
+#endif
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgPushLedSequence failed to leave the mailbox empty.");
+}
+
+/**
+ * @test  appMsgPushLedSequence must reject a message of an unknown time unit.
+*/
+ZTEST(messages_suite, test_appMsgPushLedSequence_InvalidTimeUnit)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 0,
+                       .timeUnit = UINT8_MAX};
+
+  zassert_equal(-EINVAL, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the error code.");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgPushLedSequence failed to leave the mailbox empty.");
+}
+
+/**
+ * @test  appMsgStageLedSequence must reject a message of another layout
+ *        version or of an invalid section and leave the transaction.
 */
-ZTEST(messages_suite, test_appMsgInit_QueueInitFail)
+ZTEST(messages_suite, test_appMsgStageLedSequence_Invalid)
 {
-  int failRet = -ENOSPC;
-  int successRet = 0;
-  size_t expectedMsgSizes[MSG_QUEUE_COUNT] = {sizeof(LedSequence_t)};
-  size_t expectedDepths[MSG_QUEUE_COUNT] = {5};
-  int retVals[MSG_QUEUE_COUNT] = {successRet};
+  LedTransaction_t trans;
+  LedSequence_t msgs[] = {{.version = APP_MSG_LED_SEQ_VERSION + 1,
+                           .sectionId = 0},
+                          {.version = APP_MSG_LED_SEQ_VERSION,
+                           .sectionId = APP_MSG_LED_SECTION_COUNT}};
+  int expectedRcs[] = {-EPROTONOSUPPORT, -EINVAL};
 
-  for(uint8_t i = 0; i < MSG_QUEUE_COUNT; ++i)
+  appMsgBeginLedTransaction(&trans);
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(msgs); ++i)
+    zassert_equal(expectedRcs[i], appMsgStageLedSequence(&trans, msgs + i),
+      "appMsgStageLedSequence failed to return the error code.");
+
+  zassert_equal(0, trans.count,
+    "appMsgStageLedSequence failed to leave the transaction empty.");
+}
+
+/**
+ * @test  appMsgStageLedSequence must replace the staged message of the same
+ *        section.
+*/
+ZTEST(messages_suite, test_appMsgStageLedSequence_Replace)
+{
+  LedTransaction_t trans;
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 1};
+
+  appMsgBeginLedTransaction(&trans);
+
+  for(uint8_t i = 0; i < 3; ++i)
   {
-    if(i > 0)
-      retVals[i - 1] = successRet;
-    retVals[i] = failRet;
-
-    SET_RETURN_SEQ(zephyrMsgQueueInit, retVals, MSG_QUEUE_COUNT);
-
-    zassert_equal(failRet, appMsgInit(), "appMsgInit failed to return the error code");
-    zassert_equal(i + 1, zephyrMsgQueueInit_fake.call_count,
-      "appMsgInit failed to initalize all the message queues.");
-
-    for(uint8_t j = 0; j < MSG_QUEUE_COUNT; ++j)
-    {
-      zassert_equal(queues + j, zephyrMsgQueueInit_fake.arg0_history[j],
-        "appMsgInit failed to initalize all the message queues.");
-      zassert_equal(expectedMsgSizes[j], zephyrMsgQueueInit_fake.arg1_history[j],
-        "appMsgInit failed to initalize all the message queues.");
-      zassert_equal(expectedDepths[j], zephyrMsgQueueInit_fake.arg2_history[j],
-        "appMsgInit failed to initalize all the message queues.");
-    }
+    msg.startColor.b = i;
+    zassert_equal(0, appMsgStageLedSequence(&trans, &msg),
+      "appMsgStageLedSequence failed to return the success code.");
   }
+
+  zassert_equal(1, trans.count,
+    "appMsgStageLedSequence failed to replace the staged message.");
+  zassert_equal(2, trans.sequences[0].startColor.b,
+    "appMsgStageLedSequence failed to keep the latest message.");
 }
 
 /**
- * @test  appMsgInit must return the success code when all the queue intialization
- *        succeed.
+ * @test  appMsgCommitLedTransaction must push every staged message, raise
+ *        the sequence signal once and empty the transaction.
 */
-ZTEST(messages_suite, test_appMsgInit_Success)
+ZTEST(messages_suite, test_appMsgCommitLedTransaction_Success)
 {
-  int successRet = 0;
-  size_t expectedMsgSizes[MSG_QUEUE_COUNT] = {sizeof(LedSequence_t)};
-  size_t expectedDepths[MSG_QUEUE_COUNT] = {5};
-  int retVals[MSG_QUEUE_COUNT] = {successRet};
+  LedTransaction_t trans;
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION};
+  uint32_t popped = 0;
+
+  appMsgBeginLedTransaction(&trans);
+
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+  {
+    msg.sectionId = i;
+    msg.startColor.b = i + 1;
+    appMsgStageLedSequence(&trans, &msg);
+  }
 
-  SET_RETURN_SEQ(zephyrMsgQueueInit, retVals, MSG_QUEUE_COUNT);
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgStageLedSequence failed to keep the messages staged.");
 
-  zassert_equal(successRet, appMsgInit(),
-    "appMsgInit failed to return the success code");
-  zassert_equal(MSG_QUEUE_COUNT, zephyrMsgQueueInit_fake.call_count,
-    "appMsgInit failed to initalize all the message queues.");
+  zassert_equal(0, appMsgCommitLedTransaction(&trans),
+    "appMsgCommitLedTransaction failed to return the success code.");
+  zassert_equal(0, trans.count,
+    "appMsgCommitLedTransaction failed to empty the transaction.");
+  zassert_equal(0, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgCommitLedTransaction failed to raise the sequence signal.");
+  zassert_equal(-EAGAIN, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgCommitLedTransaction failed to raise the sequence signal once.");
 
-  for(uint8_t i = 0; i < MSG_QUEUE_COUNT; ++i)
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
   {
-    zassert_equal(queues + i, zephyrMsgQueueInit_fake.arg0_history[i],
-      "appMsgInit failed to initalize all the message queues.");
-    zassert_equal(expectedMsgSizes[i], zephyrMsgQueueInit_fake.arg1_history[i],
-      "appMsgInit failed to initalize all the message queues.");
-    zassert_equal(expectedDepths[i], zephyrMsgQueueInit_fake.arg2_history[i],
-      "appMsgInit failed to initalize all the message queues.");
+    zassert_equal(0, appMsgPopLedSequence(&msg),
+      "appMsgCommitLedTransaction failed to push the message %u.", i);
+    zassert_equal(msg.sectionId + 1, msg.startColor.b,
+      "appMsgCommitLedTransaction failed to push the section message.");
+    popped |= BIT(msg.sectionId);
   }
+
+  zassert_equal(BIT_MASK(APP_MSG_LED_SECTION_COUNT), popped,
+    "appMsgCommitLedTransaction failed to push every section message.");
 }
 
 /**
- * @test  appMsgPushLedSequence must return any error code raised by pushing
- *        the message to the LED management queue.
+ * @test  appMsgCommitLedTransaction must succeed without pushing or raising
+ *        the sequence signal when the transaction is empty.
 */
-ZTEST(messages_suite, test_appMsgPushLedSequence_PushFail)
+ZTEST(messages_suite, test_appMsgCommitLedTransaction_Empty)
 {
-  int failRet = -ENOSPC;
+  LedTransaction_t trans;
   LedSequence_t msg;
 
-  zephyrMsgQueuePush_fake.return_val = failRet;
+  appMsgBeginLedTransaction(&trans);
 
-  zassert_equal(failRet, appMsgPushLedSequence(&msg),
-    "appMsgPushLedSequence failed to return the error code.");
-  zassert_equal(1, zephyrMsgQueuePush_fake.call_count,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal(queues + LED_MNGMT_QUEUE, zephyrMsgQueuePush_fake.arg0_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal((void*)(&msg), zephyrMsgQueuePush_fake.arg1_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal(ZEPHYR_TIME_FOREVER, zephyrMsgQueuePush_fake.arg2_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal(MILLI_SEC, zephyrMsgQueuePush_fake.arg3_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
+  zassert_equal(0, appMsgCommitLedTransaction(&trans),
+    "appMsgCommitLedTransaction failed to return the success code.");
+  zassert_equal(-EAGAIN, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgCommitLedTransaction failed to leave the sequence signal clear.");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgCommitLedTransaction failed to leave the mailbox empty.");
 }
 
+#ifndef CONFIG_APP_MSG_LED_SEQ_RING
 /**
- * @test  appMsgPushLedSequence must return the success code when the push
- *        push operation succeeds.
+ * @test  appMsgPushLedSequence must store the message in its section slot
+ *        and return the success code.
 */
 ZTEST(messages_suite, test_appMsgPushLedSequence_Success)
 {
-  int successRet = 0;
-  LedSequence_t msg;
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION,
+                       .seqType = SEQ_SOLID_BREATHER, .timeBase = 3,
+                       .timeUnit = SECONDS, .sectionId = 1};
 
-  zephyrMsgQueuePush_fake.return_val = successRet;
+  zassert_equal(0, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the success code.");
+  zassert_equal(BIT(1), ledSeqMailbox.pending,
+    "appMsgPushLedSequence failed to flag the section slot.");
+  zassert_mem_equal(&msg, ledSeqMailbox.slots + 1, sizeof(msg),
+    "appMsgPushLedSequence failed to store the message.");
+  zassert_equal(0, appMsgGetCoalescedCount(),
+    "appMsgPushLedSequence failed to leave the coalesced count.");
+}
+
+/**
+ * @test  appMsgPushLedSequence must replace the pending message of the same
+ *        section and count it as coalesced.
+*/
+ZTEST(messages_suite, test_appMsgPushLedSequence_Coalesce)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION,
+                       .seqType = SEQ_SOLID, .sectionId = 0};
+  LedSequence_t popped;
+
+  for(uint8_t i = 0; i < 5; ++i)
+  {
+    msg.startColor.b = i;
+    zassert_equal(0, appMsgPushLedSequence(&msg),
+      "appMsgPushLedSequence failed to return the success code.");
+  }
+
+  zassert_equal(4, appMsgGetCoalescedCount(),
+    "appMsgPushLedSequence failed to count the coalesced messages.");
+  zassert_equal(0, appMsgPopLedSequence(&popped),
+    "appMsgPopLedSequence failed to pop the latest message.");
+  zassert_equal(4, popped.startColor.b,
+    "appMsgPushLedSequence failed to keep the latest message.");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&popped),
+    "appMsgPushLedSequence failed to replace the pending message.");
+}
+/**
+ * @test  appMsgCommitLedTransaction must replace the pending messages of the
+ *        staged sections and count them as coalesced.
+*/
+ZTEST(messages_suite, test_appMsgCommitLedTransaction_Coalesce)
+{
+  LedTransaction_t trans;
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 0};
+
+  appMsgPushLedSequence(&msg);
+
+  appMsgBeginLedTransaction(&trans);
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+  {
+    msg.sectionId = i;
+    msg.startColor.b = i + 1;
+    appMsgStageLedSequence(&trans, &msg);
+  }
+
+  zassert_equal(0, appMsgCommitLedTransaction(&trans),
+    "appMsgCommitLedTransaction failed to return the success code.");
+  zassert_equal(1, appMsgGetCoalescedCount(),
+    "appMsgCommitLedTransaction failed to count the coalesced message.");
+  zassert_equal(1, ledSeqMailbox.slots[0].startColor.b,
+    "appMsgCommitLedTransaction failed to replace the pending message.");
+}
+#else
+/**
+ * @test  appMsgPushLedSequence must keep every message of a section in push
+ *        order.
+*/
+ZTEST(messages_suite, test_appMsgPushLedSequence_KeepOrder)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION,
+                       .seqType = SEQ_SOLID, .sectionId = 0};
+
+  for(uint8_t i = 0; i < CONFIG_APP_MSG_LED_SEQ_RING_DEPTH; ++i)
+  {
+    msg.startColor.b = i;
+    zassert_equal(0, appMsgPushLedSequence(&msg),
+      "appMsgPushLedSequence failed to return the success code.");
+  }
 
-  zassert_equal(successRet, appMsgPushLedSequence(&msg),
+  for(uint8_t i = 0; i < CONFIG_APP_MSG_LED_SEQ_RING_DEPTH; ++i)
+  {
+    zassert_equal(0, appMsgPopLedSequence(&msg),
+      "appMsgPopLedSequence failed to pop the message.");
+    zassert_equal(i, msg.startColor.b,
+      "appMsgPushLedSequence failed to keep the push order.");
+  }
+
+  zassert_equal(0, appMsgGetCoalescedCount(),
+    "appMsgPushLedSequence failed to keep every message.");
+}
+
+/**
+ * @test  appMsgPushLedSequence must return the error code without blocking
+ *        when the ring is full.
+*/
+ZTEST(messages_suite, test_appMsgPushLedSequence_Full)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 0};
+
+  for(uint8_t i = 0; i < CONFIG_APP_MSG_LED_SEQ_RING_DEPTH; ++i)
+    appMsgPushLedSequence(&msg);
+
+  k_poll_signal_reset(&ledSeqSignal);
+
+  zassert_equal(-ENOSPC, appMsgPushLedSequence(&msg),
+    "appMsgPushLedSequence failed to return the error code.");
+  zassert_equal(-EAGAIN, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgPushLedSequence failed to leave the sequence signal clear.");
+}
+/**
+ * @test  appMsgCommitLedTransaction must return the error code, push
+ *        nothing and keep the transaction when the ring cannot hold every
+ *        staged message.
+*/
+ZTEST(messages_suite, test_appMsgCommitLedTransaction_NoSpace)
+{
+  LedTransaction_t trans;
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 0};
+
+  for(uint8_t i = 0; i < CONFIG_APP_MSG_LED_SEQ_RING_DEPTH - 1; ++i)
+    appMsgPushLedSequence(&msg);
+
+  appMsgBeginLedTransaction(&trans);
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+  {
+    msg.sectionId = i;
+    msg.startColor.b = 0xaa;
+    appMsgStageLedSequence(&trans, &msg);
+  }
+
+  zassert_equal(-ENOSPC, appMsgCommitLedTransaction(&trans),
+    "appMsgCommitLedTransaction failed to return the error code.");
+  zassert_equal(APP_MSG_LED_SECTION_COUNT, trans.count,
+    "appMsgCommitLedTransaction failed to keep the transaction.");
+
+  for(uint8_t i = 0; i < CONFIG_APP_MSG_LED_SEQ_RING_DEPTH - 1; ++i)
+  {
+    zassert_equal(0, appMsgPopLedSequence(&msg),
+      "appMsgPopLedSequence failed to pop the message %u.", i);
+    zassert_equal(0, msg.startColor.b,
+      "appMsgCommitLedTransaction failed to push nothing.");
+  }
+
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgCommitLedTransaction failed to push nothing.");
+}
+#endif
+
+/**
+ * @test  appMsgWaitLedSequence must time out when no message was pushed.
+*/
+ZTEST(messages_suite, test_appMsgWaitLedSequence_Timeout)
+{
+  zassert_equal(-EAGAIN, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgWaitLedSequence failed to time out.");
+}
+
+/**
+ * @test  appMsgWaitLedSequence must wake up when a message was pushed and
+ *        consume the wake-up.
+*/
+ZTEST(messages_suite, test_appMsgWaitLedSequence_Pushed)
+{
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION, .sectionId = 0};
+
+  zassert_equal(0, appMsgPushLedSequence(&msg),
     "appMsgPushLedSequence failed to return the success code.");
-  zassert_equal(1, zephyrMsgQueuePush_fake.call_count,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal(queues + LED_MNGMT_QUEUE, zephyrMsgQueuePush_fake.arg0_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal((void*)(&msg), zephyrMsgQueuePush_fake.arg1_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal(ZEPHYR_TIME_FOREVER, zephyrMsgQueuePush_fake.arg2_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
-  zassert_equal(MILLI_SEC, zephyrMsgQueuePush_fake.arg3_val,
-    "appMsgPushLedSequence failed to push the LED management message.");
+  zassert_equal(0, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgWaitLedSequence failed to wake up on the pushed message.");
+  zassert_equal(-EAGAIN, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgWaitLedSequence failed to consume the wake-up.");
 }
 
 /**
- * @test  appMsgPopLedSequence must return any error code raise by the message pop
- *        operation.
+ * @test  appMsgNotifyLedManager must wake the waiting LED manager up without
+ *        message.
 */
-ZTEST(messages_suite, test_appMsgPopLedSequence_PopFail)
+ZTEST(messages_suite, test_appMsgNotifyLedManager_WakeUp)
 {
-  int failRet = -ENOMSG;
   LedSequence_t msg;
 
-  zephyrMsgQueuePop_fake.return_val = failRet;
+  appMsgNotifyLedManager();
+
+  zassert_equal(0, appMsgWaitLedSequence(K_NO_WAIT),
+    "appMsgNotifyLedManager failed to wake the LED manager up.");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgNotifyLedManager failed to leave the mailbox empty.");
+}
+
+/**
+ * @test  appMsgPopLedSequence must return -ENOMSG when no message is pending.
+*/
+ZTEST(messages_suite, test_appMsgPopLedSequence_Empty)
+{
+  LedSequence_t msg;
 
-  zassert_equal(failRet, appMsgPopLedSequence(&msg),
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
     "appMsgPopLedSequence failed to return the error code.");
-  zassert_equal(1, zephyrMsgQueuePop_fake.call_count,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal(queues + LED_MNGMT_QUEUE, zephyrMsgQueuePop_fake.arg0_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal((void*)(&msg), zephyrMsgQueuePop_fake.arg1_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal(ZEPHYR_TIME_NO_WAIT, zephyrMsgQueuePop_fake.arg2_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal(MILLI_SEC, zephyrMsgQueuePop_fake.arg3_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
 }
 
 /**
- * @test  appMsgPopLedSequence must return the success code when the pop operation
- *        succeeds.
+ * @test  appMsgPopLedSequence must pop each pending section message once.
 */
 ZTEST(messages_suite, test_appMsgPopLedSequence_Success)
 {
-  int successRet = 0;
-  LedSequence_t msg;
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION};
+  uint32_t popped = 0;
 
-  zephyrMsgQueuePop_fake.return_val = successRet;
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+  {
+    msg.sectionId = i;
+    msg.startColor.b = i + 1;
+    appMsgPushLedSequence(&msg);
+  }
 
-  zassert_equal(successRet, appMsgPopLedSequence(&msg),
-    "appMsgPopLedSequence failed to return the error code.");
-  zassert_equal(1, zephyrMsgQueuePop_fake.call_count,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal(queues + LED_MNGMT_QUEUE, zephyrMsgQueuePop_fake.arg0_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal((void*)(&msg), zephyrMsgQueuePop_fake.arg1_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal(ZEPHYR_TIME_NO_WAIT, zephyrMsgQueuePop_fake.arg2_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
-  zassert_equal(MILLI_SEC, zephyrMsgQueuePop_fake.arg3_val,
-    "appMsgPopLedSequence failed to pop the LED management message.");
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+  {
+    zassert_equal(0, appMsgPopLedSequence(&msg),
+      "appMsgPopLedSequence failed to return the success code.");
+    zassert_equal(msg.sectionId + 1, msg.startColor.b,
+      "appMsgPopLedSequence failed to pop the section message.");
+    popped |= BIT(msg.sectionId);
+  }
+
+  zassert_equal(BIT_MASK(APP_MSG_LED_SECTION_COUNT), popped,
+    "appMsgPopLedSequence failed to pop every section message.");
+  zassert_equal(-ENOMSG, appMsgPopLedSequence(&msg),
+    "appMsgPopLedSequence failed to empty the mailbox.");
 }
 
 /** @} */
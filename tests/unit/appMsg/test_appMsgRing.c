@@ -0,0 +1,158 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_appMsgRing.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Application Messages Ring Module Test Cases
+ *
+ *            This file is the test cases of the application messages ring.
+ *
+ * @ingroup  appMsg
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#include "appMsgRing.h"
+#include "appMsgRing.c"
+
+/**
+ * @brief The test ring depth.
+*/
+#define TEST_RING_DEPTH                 4
+
+/**
+ * @brief The test ring.
+*/
+static AppMsgRing_t testRing;
+
+/**
+ * @brief The test ring buffer.
+*/
+static uint32_t testBuffer[TEST_RING_DEPTH];
+
+static void msgRingCaseSetup(void *f)
+{
+  appMsgRingInit(&testRing, testBuffer, sizeof(*testBuffer), TEST_RING_DEPTH);
+}
+
+ZTEST_SUITE(msgRing_suite, NULL, NULL, msgRingCaseSetup, NULL, NULL);
+
+/**
+ * @test  appMsgRingInit must reject a depth that is not a power of 2.
+*/
+ZTEST(msgRing_suite, test_appMsgRingInit_InvalidDepth)
+{
+  uint32_t depths[] = {0, 3, 6};
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(depths); ++i)
+    zassert_equal(-EINVAL, appMsgRingInit(&testRing, testBuffer,
+      sizeof(*testBuffer), depths[i]),
+      "appMsgRingInit failed to reject the depth %u.", depths[i]);
+}
+
+/**
+ * @test  appMsgRingPop must return -ENOMSG when the ring is empty.
+*/
+ZTEST(msgRing_suite, test_appMsgRingPop_Empty)
+{
+  uint32_t msg;
+
+  zassert_equal(-ENOMSG, appMsgRingPop(&testRing, &msg),
+    "appMsgRingPop failed to return the error code.");
+}
+
+/**
+ * @test  appMsgRingPush must return -ENOSPC when the ring is full and keep
+ *        the pushed messages.
+*/
+ZTEST(msgRing_suite, test_appMsgRingPush_Full)
+{
+  uint32_t msg;
+
+  for(msg = 0; msg < TEST_RING_DEPTH; ++msg)
+    zassert_equal(0, appMsgRingPush(&testRing, &msg),
+      "appMsgRingPush failed to push the message %u.", msg);
+
+  zassert_equal(-ENOSPC, appMsgRingPush(&testRing, &msg),
+    "appMsgRingPush failed to return the error code.");
+
+  for(uint32_t i = 0; i < TEST_RING_DEPTH; ++i)
+  {
+    zassert_equal(0, appMsgRingPop(&testRing, &msg),
+      "appMsgRingPop failed to pop the message %u.", i);
+    zassert_equal(i, msg, "appMsgRingPop failed to keep the push order.");
+  }
+}
+
+/**
+ * @test  appMsgRingPushBatch must publish all the messages in order.
+*/
+ZTEST(msgRing_suite, test_appMsgRingPushBatch_Success)
+{
+  uint32_t msgs[] = {10, 11, 12};
+  uint32_t msg;
+
+  zassert_equal(0, appMsgRingPushBatch(&testRing, msgs, ARRAY_SIZE(msgs)),
+    "appMsgRingPushBatch failed to push the messages.");
+
+  for(uint32_t i = 0; i < ARRAY_SIZE(msgs); ++i)
+  {
+    zassert_equal(0, appMsgRingPop(&testRing, &msg),
+      "appMsgRingPop failed to pop the message %u.", i);
+    zassert_equal(msgs[i], msg, "appMsgRingPop failed to keep the push order.");
+  }
+}
+
+/**
+ * @test  appMsgRingPushBatch must return -ENOSPC and push nothing when the
+ *        ring cannot hold the whole batch.
+*/
+ZTEST(msgRing_suite, test_appMsgRingPushBatch_NoSpace)
+{
+  uint32_t msgs[] = {10, 11, 12};
+  uint32_t msg = 0;
+
+  zassert_equal(0, appMsgRingPush(&testRing, &msg),
+    "appMsgRingPush failed to push the message.");
+  zassert_equal(0, appMsgRingPush(&testRing, &msg),
+    "appMsgRingPush failed to push the message.");
+
+  zassert_equal(-ENOSPC, appMsgRingPushBatch(&testRing, msgs, ARRAY_SIZE(msgs)),
+    "appMsgRingPushBatch failed to return the error code.");
+
+  for(uint32_t i = 0; i < 2; ++i)
+    zassert_equal(0, appMsgRingPop(&testRing, &msg),
+      "appMsgRingPop failed to pop the message %u.", i);
+
+  zassert_equal(-ENOMSG, appMsgRingPop(&testRing, &msg),
+    "appMsgRingPushBatch failed to leave the ring untouched.");
+}
+
+/**
+ * @test  The ring must keep the push order when its free-running counters
+ *        wrap around.
+*/
+ZTEST(msgRing_suite, test_appMsgRing_CounterWrap)
+{
+  uint32_t msg;
+
+  testRing.head = UINT32_MAX - 1;
+  testRing.tail = UINT32_MAX - 1;
+
+  for(uint32_t i = 0; i < 3 * TEST_RING_DEPTH; ++i)
+  {
+    zassert_equal(0, appMsgRingPush(&testRing, &i),
+      "appMsgRingPush failed to push the message %u.", i);
+    zassert_equal(0, appMsgRingPop(&testRing, &msg),
+      "appMsgRingPop failed to pop the message %u.", i);
+    zassert_equal(i, msg, "appMsgRingPop failed to keep the push order.");
+  }
+
+  zassert_equal(-ENOMSG, appMsgRingPop(&testRing, &msg),
+    "appMsgRingPop failed to empty the ring.");
+}
+
+/** @} */
@@ -0,0 +1,198 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      bench_appMsgRing.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Application Messages Ring Module Benchmarks
+ *
+ *            This file is the stress and throughput cases of the
+ *            application messages ring, against the message queue.
+ *
+ * @ingroup  appMsg
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#include "appMsgRing.h"
+#include "appMsgRing.c"
+
+#include "appMsg.h"
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+/**
+ * @brief The stress message count.
+*/
+#define BENCH_MSG_COUNT                       10000
+
+/**
+ * @brief The transport depth.
+*/
+#define BENCH_DEPTH                           8
+
+/**
+ * @brief The producer thread stack size.
+*/
+#define BENCH_STACK_SIZE                      512
+
+K_THREAD_STACK_DEFINE(benchProducer_stack, BENCH_STACK_SIZE);
+
+/**
+ * @brief The message transport.
+*/
+typedef struct
+{
+  int (*push)(const LedSequence_t *msg);  /**< The non-blocking push. */
+  int (*pop)(LedSequence_t *msg);         /**< The non-blocking pop. */
+} BenchTransport_t;
+
+/**
+ * @brief The producer thread.
+*/
+static struct k_thread benchProducer;
+
+/**
+ * @brief The ring under test.
+*/
+static AppMsgRing_t benchRing;
+
+/**
+ * @brief The ring buffer.
+*/
+static LedSequence_t benchBuffer[BENCH_DEPTH];
+
+/**
+ * @brief The queue the ring is compared to.
+*/
+static ZephyrMsgQueue_t benchQueue;
+
+static int ringPush(const LedSequence_t *msg)
+{
+  return appMsgRingPush(&benchRing, msg);
+}
+
+static int ringPop(LedSequence_t *msg)
+{
+  return appMsgRingPop(&benchRing, msg);
+}
+
+static int queuePush(const LedSequence_t *msg)
+{
+  return zephyrMsgQueuePush(&benchQueue, msg, ZEPHYR_TIME_NO_WAIT, MILLI_SEC);
+}
+
+static int queuePop(LedSequence_t *msg)
+{
+  return zephyrMsgQueuePop(&benchQueue, msg, ZEPHYR_TIME_NO_WAIT, MILLI_SEC);
+}
+
+/**
+ * @brief   The producer thread, pushing the numbered messages and yielding
+ *          when the transport is full.
+ *
+ * @param p1          The transport.
+ * @param p2          Second user parameter.
+ * @param p3          Third user parameter.
+ */
+static void benchProducerThread(void *p1, void *p2, void *p3)
+{
+  const BenchTransport_t *transport = p1;
+  LedSequence_t msg = {.version = APP_MSG_LED_SEQ_VERSION,
+                       .seqType = SEQ_SOLID};
+
+  for(uint32_t i = 0; i < BENCH_MSG_COUNT; ++i)
+  {
+    msg.timeBase = i;
+    msg.startColor.b = ~i;
+    while(transport->push(&msg) < 0)
+      k_yield();
+  }
+}
+
+/**
+ * @brief   Stream the numbered messages from the producer thread and check
+ *          that none is lost, duplicated or reordered.
+ *
+ * @param transport   The transport.
+ *
+ * @return  The average cycle count per message.
+ */
+static uint64_t benchStream(const BenchTransport_t *transport)
+{
+  LedSequence_t msg;
+  timing_t start;
+  timing_t end;
+
+  start = timing_counter_get();
+
+  k_thread_create(&benchProducer, benchProducer_stack,
+    K_THREAD_STACK_SIZEOF(benchProducer_stack), benchProducerThread,
+    (void *)transport, NULL, NULL, k_thread_priority_get(k_current_get()), 0,
+    K_NO_WAIT);
+
+  for(uint32_t i = 0; i < BENCH_MSG_COUNT; ++i)
+  {
+    while(transport->pop(&msg) < 0)
+      k_yield();
+    zassert_equal(i, msg.timeBase, "the message %u was lost or reordered.", i);
+    zassert_equal((uint8_t)~i, msg.startColor.b,
+      "the message %u was corrupted.", i);
+  }
+
+  end = timing_counter_get();
+
+  k_thread_join(&benchProducer, K_FOREVER);
+
+  zassert_equal(-ENOMSG, transport->pop(&msg),
+    "the transport delivered an extra message.");
+
+  return timing_cycles_get(&start, &end) / BENCH_MSG_COUNT;
+}
+
+static void *msgRingBenchSetup(void)
+{
+  timing_init();
+  timing_start();
+
+  return NULL;
+}
+
+static void msgRingBenchTeardown(void *f)
+{
+  timing_stop();
+}
+
+ZTEST_SUITE(msgRingBench_suite, NULL, msgRingBenchSetup, NULL, NULL,
+  msgRingBenchTeardown);
+
+/**
+ * @test  Stream messages through the ring and the message queue, and report
+ *        their cycle count per message.
+*/
+ZTEST(msgRingBench_suite, test_appMsgRing_Throughput)
+{
+  const BenchTransport_t ring = {.push = ringPush, .pop = ringPop};
+  const BenchTransport_t queue = {.push = queuePush, .pop = queuePop};
+  uint64_t ringCycles;
+  uint64_t queueCycles;
+
+  zassert_equal(0, appMsgRingInit(&benchRing, benchBuffer,
+    sizeof(*benchBuffer), BENCH_DEPTH), "unable to initialize the ring.");
+  zassert_equal(0, zephyrMsgQueueInit(&benchQueue, sizeof(LedSequence_t),
+    BENCH_DEPTH), "unable to initialize the message queue.");
+
+  ringCycles = benchStream(&ring);
+  queueCycles = benchStream(&queue);
+
+  TC_PRINT("LED sequence transport: queue %llu cycles/msg, ring %llu cycles/msg\n",
+    queueCycles, ringCycles);
+
+  zassert_true(ringCycles <= queueCycles,
+    "the ring is slower than the message queue.");
+}
+
+/** @} */
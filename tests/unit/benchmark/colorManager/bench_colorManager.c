@@ -0,0 +1,293 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      bench_colorManager.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Color Manager Module Benchmarks
+ *
+ *            This file is the benchmark cases of the color manager module.
+ *
+ * @ingroup  colorManager
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#include "colorManager.h"
+#include "colorManager.c"
+
+#include "appMsg.h"
+
+/**
+ * @brief The benchmark iteration count.
+*/
+#define BENCH_ITERATION_COUNT                 1000
+
+/**
+ * @brief The benchmark color count.
+*/
+#define BENCH_COLOR_COUNT                     6
+
+/**
+ * @brief The fade benchmark pixel count, the whole strip.
+*/
+#define BENCH_PIXEL_COUNT                     18
+
+/**
+ * @brief The fade benchmark level.
+*/
+#define BENCH_FADE_LEVEL                      24
+
+/**
+ * @brief The fade benchmark pixels.
+*/
+static ZephyrRgbPixel_t benchPixels[BENCH_PIXEL_COUNT];
+
+/**
+ * @brief The benchmark colors.
+*/
+static Color_t benchColors[BENCH_COLOR_COUNT] = {{.hexColor = 0xff0000},
+                                                 {.hexColor = 0x5400ab},
+                                                 {.hexColor = 0x0000ff},
+                                                 {.hexColor = 0x0051ae},
+                                                 {.hexColor = 0x00ff00},
+                                                 {.hexColor = 0x44bb00}};
+
+/**
+ * @brief   The original floating point color conversion used as reference.
+ *
+ * @param color       The color to convert.
+ *
+ * @return  The color wheel position corresponding to the color.
+ */
+static uint8_t floatConvertColor(Color_t *color)
+{
+  uint8_t wheelPos;
+
+  if(color->hexColor == 0xff0000)
+    wheelPos = 0;
+  else if(color->r && color->b)
+    wheelPos = ((float)color->b / 255) * 84;
+  else if(color->hexColor == 0x0000ff)
+    wheelPos = 85;
+  else if(color->b && color->g)
+    wheelPos = ((float)color->g / 255) * 84 + 85;
+  else if(color->hexColor == 0x00ff00)
+    wheelPos = 170;
+  else
+    wheelPos = ((float)color->r / 255) * 84 + 170;
+
+  return wheelPos;
+}
+
+/**
+ * @brief   Measure the average cycle count of a color conversion function.
+ *
+ * @param convert     The conversion function.
+ *
+ * @return  The average cycle count per conversion.
+ */
+static uint64_t benchConvertColor(uint8_t (*convert)(Color_t *color))
+{
+  volatile uint8_t wheelPos;
+  timing_t start;
+  timing_t end;
+
+  start = timing_counter_get();
+  for(uint16_t i = 0; i < BENCH_ITERATION_COUNT; ++i)
+  {
+    for(uint8_t j = 0; j < BENCH_COLOR_COUNT; ++j)
+      wheelPos = convert(benchColors + j);
+  }
+  end = timing_counter_get();
+
+  ARG_UNUSED(wheelPos);
+
+  return timing_cycles_get(&start, &end) /
+    (BENCH_ITERATION_COUNT * BENCH_COLOR_COUNT);
+}
+
+/**
+ * @brief   The original channel by channel fade used as reference.
+ *
+ * @param fadeLvl     The amount of fade to use.
+ * @param pixels      The pixel buffer.
+ * @param pixelCnt    The count of pixel to manage.
+ */
+static void byteApplyFade(uint8_t fadeLvl, ZephyrRgbPixel_t *pixels,
+                          size_t pixelCnt)
+{
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    pixels[i].r = (int32_t)(pixels[i].r - fadeLvl) <= 0 ? 0 :
+      pixels[i].r - fadeLvl;
+    pixels[i].g = (int32_t)(pixels[i].g - fadeLvl) <= 0 ? 0 :
+      pixels[i].g - fadeLvl;
+    pixels[i].b = (int32_t)(pixels[i].b - fadeLvl) <= 0 ? 0 :
+      pixels[i].b - fadeLvl;
+  }
+}
+
+/**
+ * @brief   The original channel by channel unfade used as reference.
+ *
+ * @param unfadeLvl   The amount of unfade to use.
+ * @param pixels      The pixel buffer.
+ * @param pixelCnt    The count of pixel to manage.
+ */
+static void byteApplyUnfade(uint8_t unfadeLvl, ZephyrRgbPixel_t *pixels,
+                            size_t pixelCnt)
+{
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    pixels[i].r = (uint32_t)(pixels[i].r + unfadeLvl) >= 255 ? 255 :
+      pixels[i].r + unfadeLvl;
+    pixels[i].g = (uint32_t)(pixels[i].g + unfadeLvl) >= 255 ? 255 :
+      pixels[i].g + unfadeLvl;
+    pixels[i].b = (uint32_t)(pixels[i].b + unfadeLvl) >= 255 ? 255 :
+      pixels[i].b + unfadeLvl;
+  }
+}
+
+/**
+ * @brief   Measure the average cycle count of a fade function on the strip.
+ *
+ * @param fade        The fade function.
+ *
+ * @return  The average cycle count per strip.
+ */
+static uint64_t benchFade(void (*fade)(uint8_t, ZephyrRgbPixel_t*, size_t))
+{
+  timing_t start;
+  timing_t end;
+
+  for(uint8_t i = 0; i < BENCH_PIXEL_COUNT; ++i)
+    benchPixels[i] = (ZephyrRgbPixel_t){.r = i * 14, .g = 255 - i * 9,
+                                        .b = i * 37};
+
+  start = timing_counter_get();
+  for(uint16_t i = 0; i < BENCH_ITERATION_COUNT; ++i)
+    fade(BENCH_FADE_LEVEL, benchPixels, BENCH_PIXEL_COUNT);
+  end = timing_counter_get();
+
+  return timing_cycles_get(&start, &end) / BENCH_ITERATION_COUNT;
+}
+
+static void *colorMngrBenchSetup(void)
+{
+  timing_init();
+  timing_start();
+
+  return NULL;
+}
+
+static void colorMngrBenchTeardown(void *f)
+{
+  timing_stop();
+}
+
+ZTEST_SUITE(colorMngrBench_suite, NULL, colorMngrBenchSetup, NULL, NULL,
+  colorMngrBenchTeardown);
+
+/**
+ * @test  colorMngrConvertColor must give the same wheel position as the
+ *        floating point reference for every component value.
+*/
+ZTEST(colorMngrBench_suite, test_colorMngrConvertColor_MatchFloatReference)
+{
+  Color_t color;
+
+  for(uint16_t i = 1; i < 256; ++i)
+  {
+    color.hexColor = 0xff0000 | i;
+    zassert_equal(floatConvertColor(&color), colorMngrConvertColor(&color),
+      "colorMngrConvertColor failed to match the reference for 0x%06x.",
+      color.hexColor);
+    color.hexColor = 0x0000ff | (i << 8);
+    zassert_equal(floatConvertColor(&color), colorMngrConvertColor(&color),
+      "colorMngrConvertColor failed to match the reference for 0x%06x.",
+      color.hexColor);
+    color.hexColor = 0x00ff00 | (i << 16);
+    zassert_equal(floatConvertColor(&color), colorMngrConvertColor(&color),
+      "colorMngrConvertColor failed to match the reference for 0x%06x.",
+      color.hexColor);
+  }
+}
+
+/**
+ * @test  Report the cycle count of the floating point reference and of the
+ *        fixed-point color conversion.
+*/
+ZTEST(colorMngrBench_suite, test_colorMngrConvertColor_CycleCount)
+{
+  uint64_t floatCycles;
+  uint64_t fixedCycles;
+
+  floatCycles = benchConvertColor(floatConvertColor);
+  fixedCycles = benchConvertColor(colorMngrConvertColor);
+
+  TC_PRINT("colorMngrConvertColor: float %llu cycles, fixed-point %llu cycles\n",
+    floatCycles, fixedCycles);
+
+  zassert_true(fixedCycles <= floatCycles,
+    "colorMngrConvertColor is slower than the floating point reference.");
+}
+
+/**
+ * @test  colorMngrApplyFade and colorMngrApplyUnfade must match the channel
+ *        by channel reference for every channel value and level.
+*/
+ZTEST(colorMngrBench_suite, test_colorMngrApplyFade_MatchByteReference)
+{
+  ZephyrRgbPixel_t pixels[86];
+  ZephyrRgbPixel_t expected[ARRAY_SIZE(pixels)];
+  uint8_t *channels = (uint8_t *)expected;
+
+  for(uint16_t level = 0; level < 256; ++level)
+  {
+    for(uint16_t i = 0; i < sizeof(expected); ++i)
+      channels[i] = i;
+
+    memcpy(pixels, expected, sizeof(pixels));
+    byteApplyFade(level, expected, ARRAY_SIZE(expected));
+    colorMngrApplyFade(level, pixels, ARRAY_SIZE(pixels));
+    zassert_mem_equal(expected, pixels, sizeof(pixels),
+      "colorMngrApplyFade failed to match the reference for level %u.",
+      level);
+
+    for(uint16_t i = 0; i < sizeof(expected); ++i)
+      channels[i] = i;
+
+    memcpy(pixels, expected, sizeof(pixels));
+    byteApplyUnfade(level, expected, ARRAY_SIZE(expected));
+    colorMngrApplyUnfade(level, pixels, ARRAY_SIZE(pixels));
+    zassert_mem_equal(expected, pixels, sizeof(pixels),
+      "colorMngrApplyUnfade failed to match the reference for level %u.",
+      level);
+  }
+}
+
+/**
+ * @test  Report the cycle count per strip of the channel by channel
+ *        reference and of the word fade kernels.
+*/
+ZTEST(colorMngrBench_suite, test_colorMngrApplyFade_CycleCount)
+{
+  uint64_t byteCycles;
+  uint64_t wordCycles;
+
+  byteCycles = benchFade(byteApplyFade);
+  wordCycles = benchFade(colorMngrApplyFade);
+  TC_PRINT("colorMngrApplyFade: channel %llu cycles/strip, word %llu "
+    "cycles/strip\n", byteCycles, wordCycles);
+
+  byteCycles = benchFade(byteApplyUnfade);
+  wordCycles = benchFade(colorMngrApplyUnfade);
+  TC_PRINT("colorMngrApplyUnfade: channel %llu cycles/strip, word %llu "
+    "cycles/strip\n", byteCycles, wordCycles);
+}
+
+/** @} */
@@ -0,0 +1,173 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      bench_compositor.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Compositor Module Benchmarks
+ *
+ *            This file is the benchmark cases of the compositor blend
+ *            kernels, against a channel by channel reference.
+ *
+ * @ingroup  compositor
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <zephyr/timing/timing.h>
+
+#include "compositor.h"
+#include "compositor.c"
+
+#include "appMsg.h"
+#include "zephyrLedStrip.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(appMsgNotifyLedManager);
+
+/**
+ * @brief The benchmark iteration count.
+*/
+#define BENCH_ITERATION_COUNT                 100
+
+/**
+ * @brief The benchmark pixel count, the whole strip.
+*/
+#define BENCH_PIXEL_COUNT                     18
+
+/**
+ * @brief The benchmark alpha.
+*/
+#define BENCH_ALPHA                           160
+
+/**
+ * @brief The blend mode names.
+*/
+static const char *modeNames[COMPOSITOR_BLEND_COUNT] = {
+  "normal",
+  "add",
+  "multiply",
+  "max",
+};
+
+/**
+ * @brief The benchmark layer pixels.
+*/
+static ZephyrRgbPixel_t layerPixels[BENCH_PIXEL_COUNT];
+
+/**
+ * @brief The benchmark pixels below.
+*/
+static ZephyrRgbPixel_t belowPixels[BENCH_PIXEL_COUNT];
+
+/**
+ * @brief   The channel by channel blend reference.
+ *
+ * @param blendMode   The blend mode.
+ * @param alpha       The layer alpha.
+ * @param src         The layer pixels.
+ * @param dst         The pixels below, updated with the blended pixels.
+ * @param pixelCnt    The pixel count.
+ */
+static void blendRef(uint8_t blendMode, uint8_t alpha,
+                     const ZephyrRgbPixel_t *src, ZephyrRgbPixel_t *dst,
+                     size_t pixelCnt)
+{
+  const uint8_t *layer = (const uint8_t *)src;
+  uint8_t *below = (uint8_t *)dst;
+  uint32_t weight = alpha + (alpha >> 7);
+  uint32_t target;
+
+  for(size_t i = 0; i < pixelCnt * sizeof(*dst); ++i)
+  {
+    switch(blendMode)
+    {
+      case COMPOSITOR_BLEND_ADD:
+        target = below[i] + ((layer[i] * weight + 128) >> 8);
+        below[i] = MIN(target, UINT8_MAX);
+        continue;
+      case COMPOSITOR_BLEND_MULTIPLY:
+        target = (below[i] * layer[i] + 127) / 255;
+      break;
+      case COMPOSITOR_BLEND_MAX:
+        target = MAX(below[i], layer[i]);
+      break;
+      default:
+        target = layer[i];
+      break;
+    }
+
+    below[i] = (below[i] * (256 - weight) + target * weight + 128) >> 8;
+  }
+}
+
+/**
+ * @brief   Measure the average cycle count of a blend function on the strip.
+ *
+ * @param blend       The blend function.
+ * @param blendMode   The blend mode.
+ *
+ * @return  The average cycle count per strip.
+ */
+static uint64_t benchBlend(void (*blend)(uint8_t, uint8_t,
+                           const ZephyrRgbPixel_t*, ZephyrRgbPixel_t*, size_t),
+                           uint8_t blendMode)
+{
+  timing_t start;
+  timing_t end;
+
+  for(uint8_t i = 0; i < BENCH_PIXEL_COUNT; ++i)
+  {
+    layerPixels[i] = (ZephyrRgbPixel_t){.r = i * 14, .g = 255 - i * 9,
+                                        .b = i * 37};
+    belowPixels[i] = (ZephyrRgbPixel_t){.r = 200, .g = i * 11, .b = 90};
+  }
+
+  start = timing_counter_get();
+  for(uint16_t i = 0; i < BENCH_ITERATION_COUNT; ++i)
+    blend(blendMode, BENCH_ALPHA, layerPixels, belowPixels,
+      BENCH_PIXEL_COUNT);
+  end = timing_counter_get();
+
+  return timing_cycles_get(&start, &end) / BENCH_ITERATION_COUNT;
+}
+
+static void *compositorBenchSetup(void)
+{
+  timing_init();
+  timing_start();
+
+  return NULL;
+}
+
+static void compositorBenchTeardown(void *f)
+{
+  timing_stop();
+}
+
+ZTEST_SUITE(compositorBench_suite, NULL, compositorBenchSetup, NULL, NULL,
+  compositorBenchTeardown);
+
+/**
+ * @test  Report the cycle count per strip of the channel by channel
+ *        reference and of the word kernels, for each blend mode.
+*/
+ZTEST(compositorBench_suite, test_compositorBlend_CycleCount)
+{
+  uint64_t refCycles;
+  uint64_t wordCycles;
+
+  for(uint8_t i = 0; i < COMPOSITOR_BLEND_COUNT; ++i)
+  {
+    refCycles = benchBlend(blendRef, i);
+    wordCycles = benchBlend(compositorBlend, i);
+
+    TC_PRINT("%s: channel %llu cycles/strip, word %llu cycles/strip\n",
+      modeNames[i], refCycles, wordCycles);
+  }
+}
+
+/** @} */
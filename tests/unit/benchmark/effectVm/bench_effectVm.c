@@ -0,0 +1,194 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      bench_effectVm.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Effect VM Module Benchmarks
+ *
+ *            This file is the benchmark cases of the effect VM module. The
+ *            sample programs are run against their native sequence manager
+ *            counterpart on a whole strip.
+ *
+ * @ingroup  effectVm
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <zephyr/timing/timing.h>
+
+#include "effectVm.h"
+#include "effectVm.c"
+#include "sequenceManager.c"
+#include "colorManager.c"
+
+#include "appMsg.h"
+#include "zephyrCommon.h"
+#include "zephyrLedStrip.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(appMsgNotifyLedManager);
+
+/**
+ * @brief The benchmark frame rate.
+*/
+#define BENCH_FPS                             60
+
+/**
+ * @brief The benchmark frame count, one 3 seconds cycle.
+*/
+#define BENCH_FRAME_COUNT                     (3 * BENCH_FPS)
+
+/**
+ * @brief The benchmark pixel count, the whole strip.
+*/
+#define BENCH_PIXEL_COUNT                     18
+
+/**
+ * @brief The fade chaser program: a head of the start color running along
+ *        the strip and leaving a fading trail.
+*/
+static const uint8_t fadeChaserProgram[] = {
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 2, 0),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 3, 32),
+  EFFECT_VM_INSTR(EFFECT_VM_OP_FADE, 3, 0, 0),
+  EFFECT_VM_INSTR(EFFECT_VM_OP_SET, 2, 0, 0),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_ADDI, 2, 1),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_WAIT, 0, 0),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JMP, 0, 2),
+};
+
+/**
+ * @brief The rainbow program: a color wheel spread over the strip and
+ *        rotating by one position per frame.
+*/
+static const uint8_t rainbowProgram[] = {
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 2, 0),
+  EFFECT_VM_INSTR(EFFECT_VM_OP_CNT, 3, 0, 0),
+  EFFECT_VM_INSTR(EFFECT_VM_OP_MOV, 4, 2, 0),
+  EFFECT_VM_INSTR(EFFECT_VM_OP_WHEEL, 5, 4, 0),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_ADDI, 3, -1 & 0xffff),
+  EFFECT_VM_INSTR(EFFECT_VM_OP_SET, 3, 5, 0),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_ADDI, 4, 8),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JNZ, 3, 3),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_ADDI, 2, 1),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_WAIT, 0, 0),
+  EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JMP, 0, 1),
+};
+
+/**
+ * @brief The benchmark start color.
+*/
+static Color_t startColor = {.hexColor = 0x00ff40};
+
+/**
+ * @brief The benchmark end color.
+*/
+static Color_t endColor = {.hexColor = 0x4000ff};
+
+/**
+ * @brief The benchmark pixels.
+*/
+static ZephyrRgbPixel_t benchPixels[BENCH_PIXEL_COUNT];
+
+/**
+ * @brief   Load a program and measure its average cycle count per frame.
+ *
+ * @param code        The program.
+ * @param len         The program length.
+ *
+ * @return  The average cycle count per frame.
+ */
+static uint64_t benchProgram(const uint8_t *code, uint16_t len)
+{
+  EffectVmCtx_t ctx;
+  timing_t start;
+  timing_t end;
+
+  zassert_equal(0, effectVmWrite(0, code, len),
+    "effectVmWrite failed to write the program.");
+  zassert_equal(0, effectVmLoad(len), "effectVmLoad failed to load the program.");
+  zassert_true(effectVmSync(), "effectVmSync failed to swap the program in.");
+
+  start = timing_counter_get();
+  for(uint16_t i = 0; i < BENCH_FRAME_COUNT; ++i)
+    effectVmRunFrame(&ctx, &startColor, &endColor, i == 0, benchPixels,
+      BENCH_PIXEL_COUNT);
+  end = timing_counter_get();
+
+  zassert_true(effectVmIsRunning(&ctx),
+    "the program went over its frame budget.");
+
+  return timing_cycles_get(&start, &end) / BENCH_FRAME_COUNT;
+}
+
+/**
+ * @brief   Measure the average cycle count per frame of a native sequence.
+ *
+ * @param isRangeChaser The range chaser flag, the fade chaser otherwise.
+ *
+ * @return  The average cycle count per frame.
+ */
+static uint64_t benchNative(bool isRangeChaser)
+{
+  SequenceContext_t ctx = {0};
+  timing_t start;
+  timing_t end;
+
+  seqMngrSetCycle(&ctx, 3, SECONDS, BENCH_FPS);
+
+  start = timing_counter_get();
+  for(uint16_t i = 0; i < BENCH_FRAME_COUNT; ++i)
+  {
+    if(isRangeChaser)
+      seqMngrUpdateColorRangeChaserFrame(&ctx, &startColor, &endColor, false,
+        i == 0, benchPixels, BENCH_PIXEL_COUNT);
+    else
+      seqMngrUpdateFadeChaserFrame(&ctx, &startColor, false, i == 0,
+        benchPixels, BENCH_PIXEL_COUNT);
+  }
+  end = timing_counter_get();
+
+  return timing_cycles_get(&start, &end) / BENCH_FRAME_COUNT;
+}
+
+static void *effectVmBenchSetup(void)
+{
+  timing_init();
+  timing_start();
+
+  return NULL;
+}
+
+static void effectVmBenchTeardown(void *f)
+{
+  timing_stop();
+}
+
+ZTEST_SUITE(effectVmBench_suite, NULL, effectVmBenchSetup, NULL, NULL,
+  effectVmBenchTeardown);
+
+/**
+ * @test  Report the cycle count per frame of the sample programs and of
+ *        their native sequence counterpart.
+*/
+ZTEST(effectVmBench_suite, test_effectVmRunFrame_CycleCount)
+{
+  uint64_t vmCycles;
+  uint64_t nativeCycles;
+
+  vmCycles = benchProgram(fadeChaserProgram, sizeof(fadeChaserProgram));
+  nativeCycles = benchNative(false);
+  TC_PRINT("fade chaser: program %llu cycles/frame, native %llu cycles/frame\n",
+    vmCycles, nativeCycles);
+
+  vmCycles = benchProgram(rainbowProgram, sizeof(rainbowProgram));
+  nativeCycles = benchNative(true);
+  TC_PRINT("rainbow: program %llu cycles/frame, native range chaser "
+    "%llu cycles/frame\n", vmCycles, nativeCycles);
+}
+
+/** @} */
@@ -0,0 +1,306 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      bench_frameStream.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Stream Module Benchmarks
+ *
+ *            This file is the benchmark cases of the frame stream delta
+ *            frames. The animation traces are recorded from the sequence
+ *            manager, encoded as the main controller would and decoded by
+ *            the frame stream.
+ *
+ * @ingroup  frameStream
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <zephyr/timing/timing.h>
+
+#include "frameStream.h"
+#include "frameStream.c"
+#include "sequenceManager.c"
+#include "colorManager.c"
+
+#include "appMsg.h"
+#include "zephyrCommon.h"
+#include "zephyrLedStrip.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(appMsgNotifyLedManager);
+
+/**
+ * @brief The trace frame rate.
+*/
+#define BENCH_FPS                             60
+
+/**
+ * @brief The trace frame count, one 3 seconds cycle.
+*/
+#define BENCH_FRAME_COUNT                     (3 * BENCH_FPS)
+
+/**
+ * @brief The raw frame chunk header size (first LED).
+*/
+#define BENCH_RAW_HEADER_SIZE                 2
+
+/**
+ * @brief The delta frame chunk header size (flags and first LED).
+*/
+#define BENCH_DELTA_HEADER_SIZE               3
+
+/**
+ * @brief The maximum delta frame size, every LED as a literal.
+*/
+#define BENCH_MAX_DELTA_SIZE                                                  \
+  (FRAME_STREAM_PIXEL_COUNT * FRAME_STREAM_PIXEL_SIZE +                       \
+  DIV_ROUND_UP(FRAME_STREAM_PIXEL_COUNT, FRAME_STREAM_OP_MAX_COUNT))
+
+/**
+ * @brief The animation trace identifiers.
+*/
+typedef enum
+{
+  BENCH_TRACE_BREATHER = 0,
+  BENCH_TRACE_FADE_CHASER,
+  BENCH_TRACE_COLOR_RANGE,
+  BENCH_TRACE_RANGE_CHASER,
+  BENCH_TRACE_COUNT,
+} BenchTrace_t;
+
+/**
+ * @brief The animation trace names.
+*/
+static const char *traceNames[BENCH_TRACE_COUNT] = {
+  "breather",
+  "fade chaser",
+  "color range",
+  "range chaser",
+};
+
+/**
+ * @brief The trace start color.
+*/
+static Color_t startColor = {.hexColor = 0x00ff40};
+
+/**
+ * @brief The trace end color.
+*/
+static Color_t endColor = {.hexColor = 0x4000ff};
+
+/**
+ * @brief   Record the next frame of an animation trace.
+ *
+ * @param trace       The trace.
+ * @param ctx         The trace sequence context.
+ * @param reset       The trace reset flag.
+ * @param pixels      The output frame.
+ */
+static void recordFrame(BenchTrace_t trace, SequenceContext_t *ctx, bool reset,
+  ZephyrRgbPixel_t *pixels)
+{
+  switch(trace)
+  {
+    case BENCH_TRACE_BREATHER:
+      seqMngrUpdateSingleBreatherFrame(ctx, &startColor, reset, pixels,
+        FRAME_STREAM_PIXEL_COUNT);
+    break;
+    case BENCH_TRACE_FADE_CHASER:
+      seqMngrUpdateFadeChaserFrame(ctx, &startColor, false, reset, pixels,
+        FRAME_STREAM_PIXEL_COUNT);
+    break;
+    case BENCH_TRACE_COLOR_RANGE:
+      seqMngrUpdateColorRangeFrame(ctx, &startColor, &endColor, reset, pixels,
+        FRAME_STREAM_PIXEL_COUNT);
+    break;
+    default:
+      seqMngrUpdateColorRangeChaserFrame(ctx, &startColor, &endColor, false,
+        reset, pixels, FRAME_STREAM_PIXEL_COUNT);
+    break;
+  }
+}
+
+/**
+ * @brief   Check if 2 pixels are equal.
+ *
+ * @param a           The first pixel.
+ * @param b           The second pixel.
+ *
+ * @return  True if the pixels are equal, false otherwise.
+ */
+static bool isSamePixel(const ZephyrRgbPixel_t *a, const ZephyrRgbPixel_t *b)
+{
+  return a->r == b->r && a->g == b->g && a->b == b->b;
+}
+
+/**
+ * @brief   Append a pixel to the delta operations.
+ *
+ * @param pixel       The pixel.
+ * @param ops         The delta operations.
+ *
+ * @return  The appended length.
+ */
+static size_t appendPixel(const ZephyrRgbPixel_t *pixel, uint8_t *ops)
+{
+  ops[0] = pixel->r;
+  ops[1] = pixel->g;
+  ops[2] = pixel->b;
+
+  return FRAME_STREAM_PIXEL_SIZE;
+}
+
+/**
+ * @brief   Encode a frame as the delta of the previous one, the way the main
+ *          controller does: unchanged spans are skipped, runs of 2 pixels or
+ *          more are run-length encoded and the rest is sent as literals.
+ *
+ * @param prev        The previous frame.
+ * @param cur         The frame to encode.
+ * @param ops         The output delta operations, BENCH_MAX_DELTA_SIZE bytes.
+ *
+ * @return  The delta operations length.
+ */
+static size_t encodeDelta(const ZephyrRgbPixel_t *prev,
+  const ZephyrRgbPixel_t *cur, uint8_t *ops)
+{
+  size_t len = 0;
+  size_t led = 0;
+  size_t count;
+
+  while(led < FRAME_STREAM_PIXEL_COUNT)
+  {
+    count = 0;
+    while(led + count < FRAME_STREAM_PIXEL_COUNT &&
+      count < FRAME_STREAM_OP_MAX_COUNT &&
+      isSamePixel(prev + led + count, cur + led + count))
+      ++count;
+
+    if(count > 0)
+    {
+      if(led + count == FRAME_STREAM_PIXEL_COUNT)
+        break;
+      ops[len++] = FRAME_STREAM_OP_SKIP | (count - 1);
+      led += count;
+      continue;
+    }
+
+    count = 1;
+    while(led + count < FRAME_STREAM_PIXEL_COUNT &&
+      count < FRAME_STREAM_OP_MAX_COUNT &&
+      isSamePixel(cur + led, cur + led + count))
+      ++count;
+
+    if(count > 1)
+    {
+      ops[len++] = FRAME_STREAM_OP_RUN | (count - 1);
+      len += appendPixel(cur + led, ops + len);
+      led += count;
+      continue;
+    }
+
+    while(led + count < FRAME_STREAM_PIXEL_COUNT &&
+      count < FRAME_STREAM_OP_MAX_COUNT &&
+      !isSamePixel(prev + led + count, cur + led + count) &&
+      (led + count + 1 == FRAME_STREAM_PIXEL_COUNT ||
+      !isSamePixel(cur + led + count, cur + led + count + 1)))
+      ++count;
+
+    ops[len++] = FRAME_STREAM_OP_LITERAL | (count - 1);
+    for(size_t i = 0; i < count; ++i)
+      len += appendPixel(cur + led + i, ops + len);
+    led += count;
+  }
+
+  return len;
+}
+
+/**
+ * @brief   Stream an animation trace as delta frames, check every decoded
+ *          frame and report the compression ratio and the decoding cycles.
+ *
+ * @param trace       The trace.
+ */
+static void benchTrace(BenchTrace_t trace)
+{
+  static ZephyrRgbPixel_t prev[FRAME_STREAM_PIXEL_COUNT];
+  static ZephyrRgbPixel_t cur[FRAME_STREAM_PIXEL_COUNT];
+  static ZephyrRgbPixel_t latched[FRAME_STREAM_PIXEL_COUNT];
+  static uint8_t ops[BENCH_MAX_DELTA_SIZE];
+  SequenceContext_t ctx = {0};
+  uint64_t cycles = 0;
+  uint32_t rawSize = 0;
+  uint32_t deltaSize = 0;
+  timing_t start;
+  timing_t end;
+  size_t len;
+  int rc;
+
+  memset(&ring, 0x00, sizeof(ring));
+  memset(slots, 0x00, sizeof(slots));
+  memset(prev, 0x00, sizeof(prev));
+  memset(cur, 0x00, sizeof(cur));
+  frameStreamStart();
+
+  seqMngrSetCycle(&ctx, 3, SECONDS, BENCH_FPS);
+
+  for(uint16_t i = 0; i < BENCH_FRAME_COUNT; ++i)
+  {
+    recordFrame(trace, &ctx, i == 0, cur);
+    len = encodeDelta(prev, cur, ops);
+
+    start = timing_counter_get();
+    rc = frameStreamWriteDelta(0, ops, len, true);
+    end = timing_counter_get();
+
+    zassert_equal(0, rc, "the %s frame %d failed to decode.",
+      traceNames[trace], i);
+    zassert_equal(0, frameStreamLatch(latched),
+      "the %s frame %d failed to be published.", traceNames[trace], i);
+    zassert_mem_equal(cur, latched, sizeof(cur),
+      "the %s frame %d was not decoded as recorded.", traceNames[trace], i);
+
+    cycles += timing_cycles_get(&start, &end);
+    rawSize += BENCH_RAW_HEADER_SIZE +
+      FRAME_STREAM_PIXEL_COUNT * FRAME_STREAM_PIXEL_SIZE;
+    deltaSize += BENCH_DELTA_HEADER_SIZE + len;
+    memcpy(prev, cur, sizeof(prev));
+  }
+
+  TC_PRINT("%s: %u raw bytes, %u delta bytes, ratio %u.%02u, "
+    "%llu decoding cycles/frame\n", traceNames[trace], rawSize, deltaSize,
+    rawSize / deltaSize, (rawSize % deltaSize) * 100 / deltaSize,
+    cycles / BENCH_FRAME_COUNT);
+}
+
+static void *frameStreamBenchSetup(void)
+{
+  timing_init();
+  timing_start();
+
+  return NULL;
+}
+
+static void frameStreamBenchTeardown(void *f)
+{
+  timing_stop();
+}
+
+ZTEST_SUITE(frameStreamBench_suite, NULL, frameStreamBenchSetup, NULL, NULL,
+  frameStreamBenchTeardown);
+
+/**
+ * @test  Report the compression ratio and the decoding cycles per frame of
+ *        the recorded animation traces.
+*/
+ZTEST(frameStreamBench_suite, test_frameStreamWriteDelta_Traces)
+{
+  for(uint8_t i = 0; i < BENCH_TRACE_COUNT; ++i)
+    benchTrace(i);
+}
+
+/** @} */
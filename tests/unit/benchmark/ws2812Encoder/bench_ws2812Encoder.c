@@ -0,0 +1,149 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      bench_ws2812Encoder.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     WS2812 Encoder Module Benchmarks
+ *
+ *            This file is the benchmark cases of the WS2812 encoder module.
+ *
+ * @ingroup  ws2812Encoder
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#include "ws2812Encoder.h"
+#include "ws2812Encoder.c"
+
+/**
+ * @brief The benchmark iteration count.
+*/
+#define BENCH_ITERATION_COUNT                 100
+
+/**
+ * @brief The benchmark pixel count.
+*/
+#define BENCH_PIXEL_COUNT                     18
+
+/**
+ * @brief The benchmark pixels.
+*/
+static ZephyrRgbPixel_t benchPixels[BENCH_PIXEL_COUNT];
+
+/**
+ * @brief The benchmark symbols.
+*/
+static uint32_t benchSymbols[BENCH_PIXEL_COUNT * WS2812_ENC_WORDS_PER_LED];
+
+/**
+ * @brief   Encode pixels bit by bit, the way the LED strip driver expands
+ *          its buffer, as reference.
+ *
+ * @param pixels      The pixels to encode.
+ * @param pixelCnt    The pixel count.
+ * @param symbols     The output symbols.
+ */
+static void bitEncode(const ZephyrRgbPixel_t *pixels, size_t pixelCnt,
+  uint32_t *symbols)
+{
+  uint8_t *out = (uint8_t *)symbols;
+  uint8_t channels[3];
+
+  for(size_t i = 0; i < pixelCnt; ++i)
+  {
+    channels[0] = pixels[i].g;
+    channels[1] = pixels[i].r;
+    channels[2] = pixels[i].b;
+    for(uint8_t j = 0; j < 3; ++j)
+    {
+      for(uint8_t mask = 0x80; mask > 0; mask >>= 1)
+        *out++ = channels[j] & mask ? WS2812_ENC_ONE_FRAME :
+          WS2812_ENC_ZERO_FRAME;
+    }
+  }
+}
+
+/**
+ * @brief   Measure the average cycle count per LED of an encoding function.
+ *
+ * @param encode      The encoding function.
+ *
+ * @return  The average cycle count per LED.
+ */
+static uint64_t benchEncode(void (*encode)(const ZephyrRgbPixel_t *pixels,
+  size_t pixelCnt, uint32_t *symbols))
+{
+  timing_t start;
+  timing_t end;
+
+  start = timing_counter_get();
+  for(uint16_t i = 0; i < BENCH_ITERATION_COUNT; ++i)
+    encode(benchPixels, BENCH_PIXEL_COUNT, benchSymbols);
+  end = timing_counter_get();
+
+  return timing_cycles_get(&start, &end) /
+    (BENCH_ITERATION_COUNT * BENCH_PIXEL_COUNT);
+}
+
+static void *ws2812EncBenchSetup(void)
+{
+  for(uint8_t i = 0; i < BENCH_PIXEL_COUNT; ++i)
+  {
+    benchPixels[i].r = i * 14;
+    benchPixels[i].g = 0xff - i * 14;
+    benchPixels[i].b = i * 37;
+  }
+
+  timing_init();
+  timing_start();
+
+  return NULL;
+}
+
+static void ws2812EncBenchTeardown(void *f)
+{
+  timing_stop();
+}
+
+ZTEST_SUITE(ws2812EncBench_suite, NULL, ws2812EncBenchSetup, NULL, NULL,
+  ws2812EncBenchTeardown);
+
+/**
+ * @test  ws2812EncEncode must give the same symbols as the bit by bit
+ *        reference.
+*/
+ZTEST(ws2812EncBench_suite, test_ws2812EncEncode_MatchBitReference)
+{
+  uint32_t expected[BENCH_PIXEL_COUNT * WS2812_ENC_WORDS_PER_LED];
+
+  bitEncode(benchPixels, BENCH_PIXEL_COUNT, expected);
+  ws2812EncEncode(benchPixels, BENCH_PIXEL_COUNT, benchSymbols);
+
+  zassert_mem_equal(expected, benchSymbols, sizeof(expected),
+    "ws2812EncEncode failed to match the bit by bit reference.");
+}
+
+/**
+ * @test  Report the encode cycle count per LED of the bit by bit reference
+ *        and of the nibble table encoder.
+*/
+ZTEST(ws2812EncBench_suite, test_ws2812EncEncode_CyclesPerLed)
+{
+  uint64_t bitCycles;
+  uint64_t nibbleCycles;
+
+  bitCycles = benchEncode(bitEncode);
+  nibbleCycles = benchEncode(ws2812EncEncode);
+
+  TC_PRINT("ws2812EncEncode: bit by bit %llu cycles/LED, nibble table %llu cycles/LED\n",
+    bitCycles, nibbleCycles);
+
+  zassert_true(nibbleCycles <= bitCycles,
+    "ws2812EncEncode is slower than the bit by bit reference.");
+}
+
+/** @} */
@@ -29,6 +29,62 @@ macro(getFileListForSuite sourceList includeList)
     listSources(${CMAKE_CURRENT_SOURCE_DIR}/sequenceCommand testSrc)
     listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/sequenceCommand testInc)
     listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "frameSched")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/frameScheduler testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/frameScheduler testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "ws2812Enc")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/ws2812Encoder testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/ws2812Encoder testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "hostLink")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/hostLink testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/hostLink testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "frameStream")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/frameStream testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/frameStream testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "timeline")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/timeline testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/timeline testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "effectVm")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/effectVm testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/effectVm testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "compositor")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/compositor testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/compositor testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "powerLimiter")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/powerLimiter testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/powerLimiter testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "colorMngrBench")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/colorManager testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/colorManager testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "appMsgBench")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/appMsg testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/appMsg testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "ws2812EncBench")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/ws2812Encoder testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/ws2812Encoder testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "frameStreamBench")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/frameStream testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/frameStream testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "effectVmBench")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/effectVm testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/effectVm testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
+  elseif(TEST_SUITE STREQUAL "compositorBench")
+    listSources(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/compositor testSrc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/benchmark/compositor testInc)
+    listIncludesDir(${CMAKE_CURRENT_SOURCE_DIR}/../../src modInc)
   endif()
 
   # message("testSrc: ${testSrc}")
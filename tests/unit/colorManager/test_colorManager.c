@@ -16,6 +16,8 @@
 #include <zephyr/ztest.h>
 #include <zephyr/fff.h>
 
+#include <math.h>
+
 #include "colorManager.h"
 #include "colorManager.c"
 
@@ -29,6 +31,21 @@ DEFINE_FFF_GLOBALS;
 */
 #define TEST_MAX_PIXEL_COUNT            10
 
+/**
+ * @brief The strip lengths of the long strip tests.
+*/
+#define TEST_STRIP_LENGTHS              {18, 300, 1000}
+
+/**
+ * @brief The longest strip length of the long strip tests.
+*/
+#define TEST_MAX_STRIP_LENGTH           1000
+
+/**
+ * @brief The long strip test pixels, with a guard pixel after the strip.
+*/
+static ZephyrRgbPixel_t stripPixels[TEST_MAX_STRIP_LENGTH + 1];
+
 struct colorMngr_suite_fixture
 {
   ZephyrRgbPixel_t pixels[TEST_MAX_PIXEL_COUNT];
@@ -138,6 +155,48 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyFade_SetUnfade)
   }
 }
 
+/**
+ * @test  colorMngrApplyFade and colorMngrApplyUnfade must saturate each
+ *        channel on its own and stay in the given pixels.
+*/
+ZTEST(colorMngr_suite, test_colorMngrApplyFade_Saturation)
+{
+  ZephyrRgbPixel_t pixels[4] = {{.r = 0x00, .g = 0x7f, .b = 0x80},
+                                {.r = 0x81, .g = 0xff, .b = 0x10},
+                                {.r = 0x90, .g = 0x8f, .b = 0x91},
+                                {.r = 0xaa, .g = 0xaa, .b = 0xaa}};
+
+  colorMngrApplyFade(0x90, pixels, 3);
+
+  zassert_equal(0x00, pixels[0].r, "colorMngrApplyFade failed to saturate.");
+  zassert_equal(0x00, pixels[0].g, "colorMngrApplyFade failed to saturate.");
+  zassert_equal(0x00, pixels[0].b, "colorMngrApplyFade failed to saturate.");
+  zassert_equal(0x00, pixels[1].r, "colorMngrApplyFade failed to saturate.");
+  zassert_equal(0x6f, pixels[1].g, "colorMngrApplyFade failed to fade.");
+  zassert_equal(0x00, pixels[1].b, "colorMngrApplyFade failed to saturate.");
+  zassert_equal(0x00, pixels[2].r, "colorMngrApplyFade failed to saturate.");
+  zassert_equal(0x00, pixels[2].g, "colorMngrApplyFade failed to saturate.");
+  zassert_equal(0x01, pixels[2].b, "colorMngrApplyFade failed to fade.");
+  zassert_equal(0xaa, pixels[3].r,
+    "colorMngrApplyFade failed to stay in the given pixels.");
+
+  pixels[0] = (ZephyrRgbPixel_t){.r = 0x00, .g = 0x7f, .b = 0x80};
+  pixels[1] = (ZephyrRgbPixel_t){.r = 0x6f, .g = 0xff, .b = 0x70};
+
+  colorMngrApplyUnfade(0x90, pixels, 2);
+
+  zassert_equal(0x90, pixels[0].r, "colorMngrApplyUnfade failed to unfade.");
+  zassert_equal(0xff, pixels[0].g, "colorMngrApplyUnfade failed to saturate.");
+  zassert_equal(0xff, pixels[0].b, "colorMngrApplyUnfade failed to saturate.");
+  zassert_equal(0xff, pixels[1].r, "colorMngrApplyUnfade failed to unfade.");
+  zassert_equal(0xff, pixels[1].g, "colorMngrApplyUnfade failed to saturate.");
+  zassert_equal(0xff, pixels[1].b, "colorMngrApplyUnfade failed to saturate.");
+  zassert_equal(0x00, pixels[2].r,
+    "colorMngrApplyUnfade failed to stay in the given pixels.");
+  zassert_equal(0xaa, pixels[3].r,
+    "colorMngrApplyUnfade failed to stay in the given pixels.");
+}
+
 /**
  * @test  colorMngrApplyFadeTrail must apply an ascending fading trail to the
  *        given pixels.
@@ -156,7 +215,7 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyFadeTrail_ApplyAscendingTrail)
   color.hexColor = 0x00ee08ff;
   colorMngrSetSingle(&color, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
-  colorMngrApplyFadeTrail(fadeLvl, trailStart, true, fixture->pixels,
+  colorMngrApplyFadeTrail(fadeLvl << COLOR_STEP_SHIFT, trailStart, true, fixture->pixels,
     TEST_MAX_PIXEL_COUNT);
 
   while(pixelCntr < TEST_MAX_PIXEL_COUNT)
@@ -198,7 +257,7 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyFadeTrail_ApplyDescendingTrail)
   color.hexColor = 0x00ee08ff;
   colorMngrSetSingle(&color, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
-  colorMngrApplyFadeTrail(fadeLvl, trailStart, false, fixture->pixels,
+  colorMngrApplyFadeTrail(fadeLvl << COLOR_STEP_SHIFT, trailStart, false, fixture->pixels,
     TEST_MAX_PIXEL_COUNT);
 
   while(pixelCntr < TEST_MAX_PIXEL_COUNT)
@@ -222,6 +281,50 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyFadeTrail_ApplyDescendingTrail)
   }
 }
 
+/**
+ * @test  calculateNewColor must give the color wheel color of every wheel
+ *        position.
+*/
+ZTEST(colorMngr_suite, test_calculateNewColor_WheelColors)
+{
+  ZephyrRgbPixel_t pixel;
+  uint8_t expectedRed;
+  uint8_t expectedGrn;
+  uint8_t expectedBlu;
+
+  for(uint16_t wheelPos = 0; wheelPos < COLOR_WHEEL_SIZE; ++wheelPos)
+  {
+    expectedRed = 0;
+    expectedGrn = 0;
+    expectedBlu = 0;
+
+    if(wheelPos < 85)
+    {
+      expectedRed = 255 - wheelPos * 3;
+      expectedBlu = wheelPos * 3;
+    }
+    else if(wheelPos >= 85 && wheelPos < 170)
+    {
+      expectedBlu = 255 - (wheelPos - 85) * 3;
+      expectedGrn = (wheelPos - 85) * 3;
+    }
+    else
+    {
+      expectedGrn = 255 - (wheelPos - 170) * 3;
+      expectedRed = (wheelPos - 170) * 3;
+    }
+
+    calculateNewColor(wheelPos, &pixel);
+
+    zassert_equal(expectedRed, pixel.r,
+      "calculateNewColor failed to calculate the wheel color.");
+    zassert_equal(expectedGrn, pixel.g,
+      "calculateNewColor failed to calculate the wheel color.");
+    zassert_equal(expectedBlu, pixel.b,
+      "calculateNewColor failed to calculate the wheel color.");
+  }
+}
+
 #define COLOR_RANGE_TEST_COUNT                3
 /**
  * @test  colorMngrUpdateRange must reset the color wheel when the flag is set
@@ -229,6 +332,7 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyFadeTrail_ApplyDescendingTrail)
 */
 ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_ResettingRange)
 {
+  uint8_t wheelState = 0;
   uint8_t wheelPos;
   uint8_t wheelStarts[COLOR_RANGE_TEST_COUNT] = {0, 86, 170};
   uint8_t wheelEnd = 255;
@@ -242,8 +346,8 @@ ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_ResettingRange)
     expectedGrn = 0;
     expectedBlu = 0;
 
-    colorMngrUpdateRange(wheelStarts[i], wheelEnd, true, fixture->pixels,
-      TEST_MAX_PIXEL_COUNT);
+    colorMngrUpdateRange(&wheelState, wheelStarts[i], wheelEnd, 1, true,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
     if(wheelStarts[i] < 85)
     {
@@ -283,6 +387,7 @@ ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_ResettingRange)
 */
 ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_UpdateAndWrappingRange)
 {
+  uint8_t wheelState = 0;
   uint8_t wheelPos;
   uint8_t wheelStarts[COLOR_RANGE_TEST_COUNT] = {0, 2, 200};
   uint8_t wheelEnds[COLOR_RANGE_TEST_COUNT] = {255, 255, 26};
@@ -300,8 +405,8 @@ ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_UpdateAndWrappingRange)
       expectedGrn = 0;
       expectedBlu = 0;
 
-      colorMngrUpdateRange(wheelStarts[i], wheelEnds[i], j == 0,
-        fixture->pixels, TEST_MAX_PIXEL_COUNT);
+      colorMngrUpdateRange(&wheelState, wheelStarts[i], wheelEnds[i], 1,
+        j == 0, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
       if(wheelPos < 85)
       {
@@ -329,9 +434,80 @@ ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_UpdateAndWrappingRange)
           "colorMngrUpdateRange failed to set the pixels to the sequence color.");
       }
 
-      ++wheelPos;
-      if(wheelPos > wheelEnds[i] && wheelPos < wheelStarts[i])
+      if(wheelPos == wheelEnds[i])
         wheelPos = wheelStarts[i];
+      else
+        ++wheelPos;
+    }
+  }
+}
+
+#define TEST_SECTION_COUNT                    2
+#define TEST_SECTION_UPDATE_COUNT             80
+/**
+ * @test  colorMngrUpdateRange must keep the color wheel position of each
+ *        section independent when two sections are updated in the same frame.
+*/
+ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_TwoSections)
+{
+  uint8_t sectionPixelCnt = TEST_MAX_PIXEL_COUNT / TEST_SECTION_COUNT;
+  uint8_t wheelStates[TEST_SECTION_COUNT] = {0, 0};
+  uint8_t wheelStarts[TEST_SECTION_COUNT] = {0, 170};
+  uint8_t wheelEnds[TEST_SECTION_COUNT] = {84, 255};
+  ZephyrRgbPixel_t expected;
+
+  for(uint8_t i = 0; i < TEST_SECTION_UPDATE_COUNT; ++i)
+  {
+    for(uint8_t j = 0; j < TEST_SECTION_COUNT; ++j)
+      colorMngrUpdateRange(wheelStates + j, wheelStarts[j], wheelEnds[j], 1,
+        i == 0, fixture->pixels + j * sectionPixelCnt, sectionPixelCnt);
+
+    for(uint8_t j = 0; j < TEST_SECTION_COUNT; ++j)
+    {
+      calculateNewColor(wheelStarts[j] + i, &expected);
+
+      for(uint8_t k = 0; k < sectionPixelCnt; ++k)
+      {
+        zassert_equal(expected.r, fixture->pixels[j * sectionPixelCnt + k].r,
+          "colorMngrUpdateRange failed to keep the sections independent.");
+        zassert_equal(expected.g, fixture->pixels[j * sectionPixelCnt + k].g,
+          "colorMngrUpdateRange failed to keep the sections independent.");
+        zassert_equal(expected.b, fixture->pixels[j * sectionPixelCnt + k].b,
+          "colorMngrUpdateRange failed to keep the sections independent.");
+      }
+    }
+  }
+}
+
+#define TEST_STEP_COUNT                       3
+#define TEST_STEP_UPDATE_COUNT                40
+/**
+ * @test  colorMngrUpdateRange must move the color wheel position by the given
+ *        step and wrap it inside the range.
+*/
+ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_StepWrapping)
+{
+  uint8_t wheelState = 0;
+  uint8_t wheelOffset;
+  uint8_t steps[TEST_STEP_COUNT] = {3, 10, 100};
+  uint8_t wheelStarts[TEST_STEP_COUNT] = {0, 200, 170};
+  uint8_t wheelEnds[TEST_STEP_COUNT] = {84, 26, 255};
+  uint16_t span;
+
+  for(uint8_t i = 0; i < TEST_STEP_COUNT; ++i)
+  {
+    span = (uint8_t)(wheelEnds[i] - wheelStarts[i]) + 1;
+    wheelOffset = 0;
+
+    for(uint8_t j = 0; j < TEST_STEP_UPDATE_COUNT; ++j)
+    {
+      colorMngrUpdateRange(&wheelState, wheelStarts[i], wheelEnds[i], steps[i],
+        j == 0, fixture->pixels, TEST_MAX_PIXEL_COUNT);
+
+      if(j > 0)
+        wheelOffset = (wheelOffset + steps[i]) % span;
+      zassert_equal((uint8_t)(wheelStarts[i] + wheelOffset), wheelState,
+        "colorMngrUpdateRange failed to move the wheel by the given step.");
     }
   }
 }
@@ -343,7 +519,7 @@ ZTEST_F(colorMngr_suite, test_colorMngrUpdateRange_UpdateAndWrappingRange)
 ZTEST_F(colorMngr_suite, test_colorMngrApplyRangeTrail_ApplyAscendingTrail)
 {
   uint8_t wheelPos;
-  uint8_t step;
+  uint32_t step;
   uint8_t wheelStarts[COLOR_RANGE_TEST_COUNT] = {0, 2, 200};
   uint8_t wheelEnds[COLOR_RANGE_TEST_COUNT] = {255, 255, 26};
   uint32_t trailStarts[COLOR_RANGE_TEST_COUNT] = {0, 5, TEST_MAX_PIXEL_COUNT - 1};
@@ -355,19 +531,21 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyRangeTrail_ApplyAscendingTrail)
 
   for(uint8_t i = 0; i < COLOR_RANGE_TEST_COUNT; ++i)
   {
-    pixelPntr = fixture->pixels + trailStarts[i];
-    expectedRed = 0;
-    expectedGrn = 0;
-    expectedBlu = 0;
+    pixelCntr = 0;
 
     colorMngrApplyRangeTrail(trailStarts[i], wheelStarts[i], wheelEnds[i],
       true, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
-    wheelPos = wheelStarts[i];
-    step = (wheelEnds[i] - wheelStarts[i]) / TEST_MAX_PIXEL_COUNT;
+    step = ((uint32_t)(uint8_t)(wheelEnds[i] - wheelStarts[i]) <<
+      COLOR_STEP_SHIFT) / TEST_MAX_PIXEL_COUNT;
     pixelPntr = fixture->pixels + trailStarts[i];
     while(pixelCntr < TEST_MAX_PIXEL_COUNT)
     {
+      wheelPos = wheelStarts[i] + ((pixelCntr * step) >> COLOR_STEP_SHIFT);
+      expectedRed = 0;
+      expectedGrn = 0;
+      expectedBlu = 0;
+
       if(wheelPos < 85)
       {
         expectedRed = 255 - wheelPos * 3;
@@ -395,10 +573,6 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyRangeTrail_ApplyAscendingTrail)
       ++pixelPntr;
       if(pixelPntr == fixture->pixels + TEST_MAX_PIXEL_COUNT)
         pixelPntr = fixture->pixels;
-
-      wheelPos += step;
-      if(wheelPos > wheelEnds[i] && wheelPos < wheelStarts[i])
-        wheelPos = wheelStarts[i];
     }
   }
 }
@@ -410,7 +584,7 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyRangeTrail_ApplyAscendingTrail)
 ZTEST_F(colorMngr_suite, test_colorMngrApplyRangeTrail_ApplyDescendingTrail)
 {
   uint8_t wheelPos;
-  uint8_t step;
+  uint32_t step;
   uint8_t wheelStarts[COLOR_RANGE_TEST_COUNT] = {0, 2, 200};
   uint8_t wheelEnds[COLOR_RANGE_TEST_COUNT] = {255, 255, 26};
   uint32_t trailStarts[COLOR_RANGE_TEST_COUNT] = {0, 5, TEST_MAX_PIXEL_COUNT - 1};
@@ -422,19 +596,21 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyRangeTrail_ApplyDescendingTrail)
 
   for(uint8_t i = 0; i < COLOR_RANGE_TEST_COUNT; ++i)
   {
-    pixelPntr = fixture->pixels + trailStarts[i];
-    expectedRed = 0;
-    expectedGrn = 0;
-    expectedBlu = 0;
+    pixelCntr = 0;
 
     colorMngrApplyRangeTrail(trailStarts[i], wheelStarts[i], wheelEnds[i],
       false, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
-    wheelPos = wheelStarts[i];
-    step = (wheelEnds[i] - wheelStarts[i]) / TEST_MAX_PIXEL_COUNT;
+    step = ((uint32_t)(uint8_t)(wheelEnds[i] - wheelStarts[i]) <<
+      COLOR_STEP_SHIFT) / TEST_MAX_PIXEL_COUNT;
     pixelPntr = fixture->pixels + trailStarts[i];
     while(pixelCntr < TEST_MAX_PIXEL_COUNT)
     {
+      wheelPos = wheelStarts[i] + ((pixelCntr * step) >> COLOR_STEP_SHIFT);
+      expectedRed = 0;
+      expectedGrn = 0;
+      expectedBlu = 0;
+
       if(wheelPos < 85)
       {
         expectedRed = 255 - wheelPos * 3;
@@ -462,15 +638,91 @@ ZTEST_F(colorMngr_suite, test_colorMngrApplyRangeTrail_ApplyDescendingTrail)
       --pixelPntr;
       if(pixelPntr < fixture->pixels)
         pixelPntr = fixture->pixels + TEST_MAX_PIXEL_COUNT - 1;
-
-      wheelPos += step;
-      if(wheelPos > wheelEnds[i] && wheelPos < wheelStarts[i])
-        wheelPos = wheelStarts[i];
     }
   }
 }
 
 #define COLOR_CONVERTION_TEST_CNT                   6
+/**
+ * @test  colorMngrGetWheelColor must give the color of the wheel position.
+*/
+ZTEST(colorMngr_suite, test_colorMngrGetWheelColor_WheelColors)
+{
+  uint8_t wheelPos[] = {0, 42, 85, 127, 170, 255};
+  uint32_t expectedColors[] = {0xff0000, 0x81007e, 0x0000ff, 0x007e81,
+                               0x00ff00, 0xff0000};
+  Color_t color;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(wheelPos); ++i)
+  {
+    color.hexColor = 0xffffffff;
+    colorMngrGetWheelColor(wheelPos[i], &color);
+    zassert_equal(expectedColors[i], color.hexColor,
+      "colorMngrGetWheelColor failed to give the wheel color %u.", wheelPos[i]);
+  }
+}
+
+/**
+ * @test  colorMngrApplyLerp must move the pixels toward the target pixels by
+ *        the weight, rounded, and reach them at the full weight.
+*/
+ZTEST(colorMngr_suite, test_colorMngrApplyLerp_Weights)
+{
+  ZephyrRgbPixel_t target[2] = {{.r = 0xff, .g = 0x00, .b = 0x80},
+                                {.r = 0x10, .g = 0xf0, .b = 0x00}};
+  ZephyrRgbPixel_t pixels[2];
+  ZephyrRgbPixel_t expected[2] = {{.r = 0x80, .g = 0x80, .b = 0x80},
+                                  {.r = 0x48, .g = 0xb8, .b = 0x40}};
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(pixels); ++i)
+    pixels[i] = (ZephyrRgbPixel_t){.r = 0x00, .g = 0xff, .b = 0x80};
+  pixels[1].r = 0x80;
+  pixels[1].g = 0x80;
+
+  colorMngrApplyLerp(0, target, pixels, ARRAY_SIZE(pixels));
+  zassert_equal(0x00, pixels[0].r, "colorMngrApplyLerp moved at 0 weight.");
+
+  colorMngrApplyLerp(COLOR_LERP_ONE / 2, target, pixels, ARRAY_SIZE(pixels));
+  zassert_mem_equal(expected, pixels, sizeof(pixels),
+    "colorMngrApplyLerp failed to move the pixels half way.");
+
+  colorMngrApplyLerp(COLOR_LERP_ONE, target, pixels, ARRAY_SIZE(pixels));
+  zassert_mem_equal(target, pixels, sizeof(pixels),
+    "colorMngrApplyLerp failed to reach the target pixels.");
+}
+
+/**
+ * @test  colorMngrApplyLerp must move the pixels smoothly toward the target
+ *        pixels over a long transition, one over the remaining frame count
+ *        on each frame.
+*/
+ZTEST(colorMngr_suite, test_colorMngrApplyLerp_LongFade)
+{
+  ZephyrRgbPixel_t target = {.r = 0xff, .g = 0x28, .b = 0x00};
+  ZephyrRgbPixel_t pixel = {.r = 0x00, .g = 0x00, .b = 0xff};
+  ZephyrRgbPixel_t previous;
+  uint32_t frameCnt = 300;
+
+  for(uint32_t i = frameCnt; i > 0; --i)
+  {
+    previous = pixel;
+    colorMngrApplyLerp(COLOR_LERP_ONE / i, &target, &pixel, 1);
+
+    zassert_true(pixel.r - previous.r <= 0xff / frameCnt + 1,
+      "colorMngrApplyLerp failed to move smoothly %u frames out.", i);
+    zassert_true(pixel.g - previous.g <= 0x28 / frameCnt + 1,
+      "colorMngrApplyLerp failed to move smoothly %u frames out.", i);
+    zassert_true(previous.b - pixel.b <= 0xff / frameCnt + 1,
+      "colorMngrApplyLerp failed to move smoothly %u frames out.", i);
+    if(i <= frameCnt / 2)
+      zassert_true(pixel.r >= 0xff / 2,
+        "colorMngrApplyLerp failed to move linearly %u frames out.", i);
+  }
+
+  zassert_mem_equal(&target, &pixel, sizeof(pixel),
+    "colorMngrApplyLerp failed to reach the target pixels.");
+}
+
 /**
  * @test  colorMngrConvertColor must return the wheel position by converting the
  *        RGB HEX color. The following algorithm is used to do the convertion:
@@ -499,4 +751,183 @@ ZTEST(colorMngr_suite, test_colorMngrConvertColor_Convertion)
   }
 }
 
+#ifdef CONFIG_LED_MNGR_GAMMA
+/**
+ * @test  The gamma table must map each linear level to the rounded level
+ *        power of the configured gamma, keeping the black and white levels.
+*/
+ZTEST(colorMngr_suite, test_colorMngrGetGammaLut_PowerCurve)
+{
+  const uint8_t *lut = colorMngrGetGammaLut();
+  uint8_t expected;
+
+  zassert_equal(0, lut[0], "the gamma table failed to keep the black level.");
+  zassert_equal(255, lut[COLOR_GAMMA_SIZE - 1],
+    "the gamma table failed to keep the white level.");
+
+  for(uint16_t i = 0; i < COLOR_GAMMA_SIZE; ++i)
+  {
+    expected = pow(i / 255.0, CONFIG_LED_MNGR_GAMMA_X10 / 10.0) * 255.0 + 0.5;
+    zassert_equal(expected, lut[i],
+      "the gamma table failed to correct the level %u.", i);
+  }
+}
+
+/**
+ * @test  colorMngrApplyGamma must correct each channel of the pixels, in
+ *        place or into other pixels.
+*/
+ZTEST_F(colorMngr_suite, test_colorMngrApplyGamma_Channels)
+{
+  const uint8_t *lut = colorMngrGetGammaLut();
+  ZephyrRgbPixel_t linear[TEST_MAX_PIXEL_COUNT];
+
+  for(uint8_t i = 0; i < TEST_MAX_PIXEL_COUNT; ++i)
+  {
+    linear[i].r = i * 25;
+    linear[i].g = 255 - i * 25;
+    linear[i].b = i * 11 + 128;
+  }
+
+  colorMngrApplyGamma(linear, fixture->pixels, TEST_MAX_PIXEL_COUNT);
+  for(uint8_t i = 0; i < TEST_MAX_PIXEL_COUNT; ++i)
+  {
+    zassert_equal(lut[linear[i].r], fixture->pixels[i].r,
+      "colorMngrApplyGamma failed to correct the red channel.");
+    zassert_equal(lut[linear[i].g], fixture->pixels[i].g,
+      "colorMngrApplyGamma failed to correct the green channel.");
+    zassert_equal(lut[linear[i].b], fixture->pixels[i].b,
+      "colorMngrApplyGamma failed to correct the blue channel.");
+  }
+
+  colorMngrApplyGamma(linear, linear, TEST_MAX_PIXEL_COUNT);
+  zassert_mem_equal(fixture->pixels, linear, sizeof(linear),
+    "colorMngrApplyGamma failed to correct the pixels in place.");
+}
+#endif
+
+/**
+ * @test  colorMngrSetSingle, colorMngrApplyFade and colorMngrApplyUnfade
+ *        must update every pixel of strips longer than 255 LEDs.
+*/
+ZTEST(colorMngr_suite, test_colorMngrApplyFade_StripLengths)
+{
+  size_t lengths[] = TEST_STRIP_LENGTHS;
+  Color_t color = {.hexColor = 0x00804020};
+  ZephyrRgbPixel_t guard = {.r = 0xaa, .g = 0xaa, .b = 0xaa};
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(lengths); ++i)
+  {
+    stripPixels[lengths[i]] = guard;
+
+    colorMngrSetSingle(&color, stripPixels, lengths[i]);
+    colorMngrApplyFade(0x30, stripPixels, lengths[i]);
+    colorMngrApplyUnfade(0x10, stripPixels, lengths[i]);
+
+    for(size_t j = 0; j < lengths[i]; ++j)
+    {
+      zassert_equal(0x60, stripPixels[j].r,
+        "the color kernels failed to update pixel %u of %u.", j, lengths[i]);
+      zassert_equal(0x20, stripPixels[j].g,
+        "the color kernels failed to update pixel %u of %u.", j, lengths[i]);
+      zassert_equal(0x10, stripPixels[j].b,
+        "the color kernels failed to update pixel %u of %u.", j, lengths[i]);
+    }
+    zassert_mem_equal(&guard, stripPixels + lengths[i], sizeof(guard),
+      "the color kernels failed to stay in the strip of %u.", lengths[i]);
+  }
+}
+
+/**
+ * @test  colorMngrUpdateRange must set every pixel of strips longer than 255
+ *        LEDs.
+*/
+ZTEST(colorMngr_suite, test_colorMngrUpdateRange_StripLengths)
+{
+  size_t lengths[] = TEST_STRIP_LENGTHS;
+  ZephyrRgbPixel_t expected;
+  uint8_t wheelPos = 0;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(lengths); ++i)
+  {
+    memset(stripPixels, 0x00, sizeof(stripPixels));
+
+    colorMngrUpdateRange(&wheelPos, 10, 100, 5, false, stripPixels,
+      lengths[i]);
+    calculateNewColor(wheelPos, &expected);
+
+    for(size_t j = 0; j < lengths[i]; ++j)
+      zassert_mem_equal(&expected, stripPixels + j, sizeof(expected),
+        "colorMngrUpdateRange failed to set pixel %u of %u.", j, lengths[i]);
+    zassert_equal(0, stripPixels[lengths[i]].r,
+      "colorMngrUpdateRange failed to stay in the strip of %u.", lengths[i]);
+  }
+}
+
+/**
+ * @test  colorMngrApplyRangeTrail must spread the whole range over strips
+ *        longer than the range, wrapping around the wheel.
+*/
+ZTEST(colorMngr_suite, test_colorMngrApplyRangeTrail_StripLengths)
+{
+  size_t lengths[] = TEST_STRIP_LENGTHS;
+  uint8_t wheelStarts[] = {0, 200};
+  uint8_t wheelEnds[] = {255, 26};
+  ZephyrRgbPixel_t expected;
+  uint32_t span;
+  uint32_t offset;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(lengths); ++i)
+  {
+    for(uint8_t j = 0; j < ARRAY_SIZE(wheelStarts); ++j)
+    {
+      span = (uint8_t)(wheelEnds[j] - wheelStarts[j]);
+
+      colorMngrApplyRangeTrail(0, wheelStarts[j], wheelEnds[j], true,
+        stripPixels, lengths[i]);
+
+      for(size_t k = 0; k < lengths[i]; ++k)
+      {
+        offset = k * span / lengths[i];
+        calculateNewColor(wheelStarts[j] + offset, &expected);
+        if(memcmp(&expected, stripPixels + k, sizeof(expected)) != 0)
+          calculateNewColor(wheelStarts[j] + offset - 1, &expected);
+        zassert_mem_equal(&expected, stripPixels + k, sizeof(expected),
+          "colorMngrApplyRangeTrail failed to spread pixel %u of %u.", k,
+          lengths[i]);
+      }
+    }
+  }
+}
+
+/**
+ * @test  colorMngrApplyFadeTrail must fade a trail over strips longer than
+ *        the fade level, with a fractional step.
+*/
+ZTEST(colorMngr_suite, test_colorMngrApplyFadeTrail_StripLengths)
+{
+  size_t lengths[] = TEST_STRIP_LENGTHS;
+  Color_t color = {.hexColor = 0x00ffffff};
+  uint32_t step;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(lengths); ++i)
+  {
+    step = ((uint32_t)UINT8_MAX << COLOR_STEP_SHIFT) / lengths[i];
+
+    colorMngrSetSingle(&color, stripPixels, lengths[i]);
+    colorMngrApplyFadeTrail(step, 0, true, stripPixels, lengths[i]);
+
+    zassert_equal(UINT8_MAX, stripPixels[0].r,
+      "colorMngrApplyFadeTrail failed to start the trail at full level.");
+    for(size_t j = 0; j < lengths[i]; ++j)
+      zassert_equal(UINT8_MAX - ((j * step) >> COLOR_STEP_SHIFT),
+        stripPixels[j].r,
+        "colorMngrApplyFadeTrail failed to fade pixel %u of %u.", j,
+        lengths[i]);
+    zassert_true(stripPixels[lengths[i] - 1].r <= UINT8_MAX / lengths[i] + 1,
+      "colorMngrApplyFadeTrail failed to fade the whole strip of %u.",
+      lengths[i]);
+  }
+}
+
 /** @} */
@@ -0,0 +1,252 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_compositor.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Compositor Module Test Cases
+ *
+ *            This file is the test cases of the compositor module.
+ *
+ * @ingroup  compositor
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "compositor.h"
+#include "compositor.c"
+
+#include "appMsg.h"
+#include "zephyrLedStrip.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(appMsgNotifyLedManager);
+
+/**
+ * @brief The test pixel count, leaving a partial word at the end.
+*/
+#define TEST_PIXEL_COUNT                9
+
+/**
+ * @brief The test alphas.
+*/
+static const uint8_t testAlphas[] = {1, 64, 128, 200, 255};
+
+/**
+ * @brief The test layer pixels.
+*/
+static ZephyrRgbPixel_t layerPixels[TEST_PIXEL_COUNT];
+
+/**
+ * @brief The test pixels below.
+*/
+static ZephyrRgbPixel_t belowPixels[TEST_PIXEL_COUNT];
+
+/**
+ * @brief   The channel by channel blend reference.
+ *
+ * @param blendMode   The blend mode.
+ * @param alpha       The layer alpha.
+ * @param below       The channel below.
+ * @param layer       The layer channel.
+ *
+ * @return  The blended channel.
+ */
+static uint8_t blendChannelRef(uint8_t blendMode, uint8_t alpha, uint8_t below,
+                               uint8_t layer)
+{
+  uint32_t weight = alpha + (alpha >> 7);
+  uint32_t target;
+
+  switch(blendMode)
+  {
+    case COMPOSITOR_BLEND_ADD:
+      target = below + ((layer * weight + 128) >> 8);
+      return MIN(target, UINT8_MAX);
+    case COMPOSITOR_BLEND_MULTIPLY:
+      target = (below * layer + 127) / 255;
+    break;
+    case COMPOSITOR_BLEND_MAX:
+      target = MAX(below, layer);
+    break;
+    default:
+      target = layer;
+    break;
+  }
+
+  return (below * (256 - weight) + target * weight + 128) >> 8;
+}
+
+/**
+ * @brief   Fill the test pixels with a pattern.
+ *
+ * @param seed        The pattern seed.
+ */
+static void fillPixels(uint8_t seed)
+{
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    layerPixels[i].r = seed + i * 29;
+    layerPixels[i].g = 255 - i * 31;
+    layerPixels[i].b = seed * 7 + i * 97;
+    belowPixels[i].r = 255 - seed - i * 13;
+    belowPixels[i].g = i * 41;
+    belowPixels[i].b = seed * 3 + i * 53;
+  }
+}
+
+/**
+ * @brief   Build a test layer.
+ *
+ * @param layerId     The layer ID.
+ * @param sectionId   The section ID.
+ *
+ * @return  The layer.
+ */
+static CompositorLayer_t buildLayer(uint8_t layerId, uint8_t sectionId)
+{
+  CompositorLayer_t layer = {
+    .layerId = layerId,
+    .alpha = 128,
+    .blendMode = COMPOSITOR_BLEND_ADD,
+    .seq = {.version = APP_MSG_LED_SEQ_VERSION, .seqType = SEQ_FADE_CHASER,
+            .sectionId = sectionId},
+  };
+
+  return layer;
+}
+
+static void compositorCaseSetup(void *f)
+{
+  RESET_FAKE(appMsgNotifyLedManager);
+
+  memset(&mailbox, 0x00, sizeof(mailbox));
+}
+
+ZTEST_SUITE(compositor_suite, NULL, NULL, compositorCaseSetup, NULL, NULL);
+
+/**
+ * @test  compositorSetLayer must reject an invalid layer.
+*/
+ZTEST(compositor_suite, test_compositorSetLayer_Invalid)
+{
+  CompositorLayer_t layers[5];
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(layers); ++i)
+    layers[i] = buildLayer(0, 0);
+
+  layers[0].layerId = CONFIG_LED_MNGR_COMPOSITOR_LAYERS;
+  layers[1].seq.sectionId = APP_MSG_LED_SECTION_COUNT;
+  layers[2].blendMode = COMPOSITOR_BLEND_COUNT;
+  layers[3].seq.seqType = SEQ_PROGRAM;
+  layers[4].seq.seqType = SEQ_COUNT;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(layers); ++i)
+    zassert_equal(-EINVAL, compositorSetLayer(layers + i),
+      "compositorSetLayer failed to reject the layer %u.", i);
+
+  layers[0] = buildLayer(0, 0);
+  layers[0].seq.version = APP_MSG_LED_SEQ_VERSION + 1;
+  zassert_equal(-EPROTONOSUPPORT, compositorSetLayer(layers),
+    "compositorSetLayer failed to reject the sequence version.");
+
+  zassert_equal(0, mailbox.pending, "compositorSetLayer set an invalid layer.");
+  zassert_equal(0, appMsgNotifyLedManager_fake.call_count,
+    "compositorSetLayer notified the LED manager of an invalid layer.");
+}
+
+/**
+ * @test  compositorSetLayer must keep the latest layer of each slot and
+ *        compositorPopLayer must pop each pending layer once.
+*/
+ZTEST(compositor_suite, test_compositorPopLayer_Coalesce)
+{
+  CompositorLayer_t layer = buildLayer(0, 1);
+  CompositorLayer_t popped;
+
+  zassert_equal(0, compositorSetLayer(&layer),
+    "compositorSetLayer failed to set the layer.");
+  layer.alpha = 255;
+  zassert_equal(0, compositorSetLayer(&layer),
+    "compositorSetLayer failed to replace the layer.");
+  layer = buildLayer(CONFIG_LED_MNGR_COMPOSITOR_LAYERS - 1, 0);
+  zassert_equal(0, compositorSetLayer(&layer),
+    "compositorSetLayer failed to set the other layer.");
+  zassert_equal(3, appMsgNotifyLedManager_fake.call_count,
+    "compositorSetLayer failed to notify the LED manager.");
+
+  zassert_equal(0, compositorPopLayer(&popped),
+    "compositorPopLayer failed to pop the first layer.");
+  zassert_equal(0, popped.seq.sectionId, "bad first popped section.");
+  zassert_equal(CONFIG_LED_MNGR_COMPOSITOR_LAYERS - 1, popped.layerId,
+    "bad first popped layer.");
+
+  zassert_equal(0, compositorPopLayer(&popped),
+    "compositorPopLayer failed to pop the second layer.");
+  zassert_equal(1, popped.seq.sectionId, "bad second popped section.");
+  zassert_equal(255, popped.alpha,
+    "compositorPopLayer failed to pop the latest layer.");
+
+  zassert_equal(-ENOMSG, compositorPopLayer(&popped),
+    "compositorPopLayer failed to return the error code.");
+}
+
+/**
+ * @test  compositorBlend must blend every channel like the channel by
+ *        channel reference, for every blend mode and alpha.
+*/
+ZTEST(compositor_suite, test_compositorBlend_MatchReference)
+{
+  ZephyrRgbPixel_t expected[TEST_PIXEL_COUNT];
+
+  for(uint8_t mode = 0; mode < COMPOSITOR_BLEND_COUNT; ++mode)
+  {
+    for(uint8_t i = 0; i < ARRAY_SIZE(testAlphas); ++i)
+    {
+      fillPixels(mode * 17 + i);
+      for(uint8_t j = 0; j < TEST_PIXEL_COUNT; ++j)
+      {
+        expected[j].r = blendChannelRef(mode, testAlphas[i],
+          belowPixels[j].r, layerPixels[j].r);
+        expected[j].g = blendChannelRef(mode, testAlphas[i],
+          belowPixels[j].g, layerPixels[j].g);
+        expected[j].b = blendChannelRef(mode, testAlphas[i],
+          belowPixels[j].b, layerPixels[j].b);
+      }
+
+      compositorBlend(mode, testAlphas[i], layerPixels, belowPixels,
+        TEST_PIXEL_COUNT);
+      zassert_mem_equal(expected, belowPixels, sizeof(expected),
+        "compositorBlend failed to blend the mode %u at alpha %u.", mode,
+        testAlphas[i]);
+    }
+  }
+}
+
+/**
+ * @test  compositorBlend must copy the layer at full alpha in normal mode
+ *        and leave the pixels below at 0 alpha.
+*/
+ZTEST(compositor_suite, test_compositorBlend_Bounds)
+{
+  ZephyrRgbPixel_t below[TEST_PIXEL_COUNT];
+
+  fillPixels(3);
+  memcpy(below, belowPixels, sizeof(below));
+
+  compositorBlend(COMPOSITOR_BLEND_NORMAL, 0, layerPixels, belowPixels,
+    TEST_PIXEL_COUNT);
+  zassert_mem_equal(below, belowPixels, sizeof(below),
+    "compositorBlend updated the pixels at 0 alpha.");
+
+  compositorBlend(COMPOSITOR_BLEND_NORMAL, 255, layerPixels, belowPixels,
+    TEST_PIXEL_COUNT);
+  zassert_mem_equal(layerPixels, belowPixels, sizeof(below),
+    "compositorBlend failed to copy the opaque layer.");
+}
+
+/** @} */
@@ -0,0 +1,404 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_effectVm.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Effect VM Module Test Cases
+ *
+ *            This file is the test cases of the effect VM module.
+ *
+ * @ingroup  effectVm
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "effectVm.h"
+#include "effectVm.c"
+#include "colorManager.c"
+
+#include "appMsg.h"
+#include "zephyrLedStrip.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(appMsgNotifyLedManager);
+
+/**
+ * @brief The test section pixel count.
+*/
+#define TEST_PIXEL_COUNT                9
+
+/**
+ * @brief The test start color.
+*/
+#define TEST_START_COLOR                0x00204080
+
+/**
+ * @brief The test end color.
+*/
+#define TEST_END_COLOR                  0x00ff0000
+
+/**
+ * @brief The test pixels.
+*/
+static ZephyrRgbPixel_t testPixels[TEST_PIXEL_COUNT];
+
+/**
+ * @brief The test program context.
+*/
+static EffectVmCtx_t testCtx;
+
+/**
+ * @brief The test start color.
+*/
+static Color_t testStartColor;
+
+/**
+ * @brief The test end color.
+*/
+static Color_t testEndColor;
+
+/**
+ * @brief   Write, load and swap in a program.
+ *
+ * @param code        The program.
+ * @param len         The program length.
+ *
+ * @return  The load status.
+ */
+static int loadProgram(const uint8_t *code, uint16_t len)
+{
+  int rc;
+
+  rc = effectVmWrite(0, code, len);
+  if(rc < 0)
+    return rc;
+
+  rc = effectVmLoad(len);
+  if(rc == 0)
+    effectVmSync();
+
+  return rc;
+}
+
+/**
+ * @brief   Run the test program for a frame.
+ *
+ * @param reset       The reset flag.
+ *
+ * @return  The pixels updated flag.
+ */
+static bool runFrame(bool reset)
+{
+  return effectVmRunFrame(&testCtx, &testStartColor, &testEndColor, reset,
+    testPixels, TEST_PIXEL_COUNT);
+}
+
+/**
+ * @brief   Check a pixel color.
+ *
+ * @param pixel       The pixel.
+ * @param color       The expected color (0x00RRGGBB).
+ *
+ * @return  True if the pixel has the color, false otherwise.
+ */
+static bool isPixelColor(const ZephyrRgbPixel_t *pixel, uint32_t color)
+{
+  return pixel->r == (uint8_t)(color >> 16) &&
+    pixel->g == (uint8_t)(color >> 8) && pixel->b == (uint8_t)color;
+}
+
+static void effectVmCaseSetup(void *f)
+{
+  RESET_FAKE(appMsgNotifyLedManager);
+
+  memset(staging, 0x00, sizeof(staging));
+  memset(program, 0x00, sizeof(program));
+  memset(&stats, 0x00, sizeof(stats));
+  memset(&testCtx, 0x00, sizeof(testCtx));
+  memset(testPixels, 0x00, sizeof(testPixels));
+  instrCount = 0;
+  pendingLen = 0;
+  isPending = false;
+
+  testStartColor.hexColor = TEST_START_COLOR;
+  testEndColor.hexColor = TEST_END_COLOR;
+}
+
+ZTEST_SUITE(effectVm_suite, NULL, NULL, effectVmCaseSetup, NULL, NULL);
+
+/**
+ * @test  effectVmWrite must reject a chunk out of the buffer.
+*/
+ZTEST(effectVm_suite, test_effectVmWrite_OutOfBuffer)
+{
+  uint8_t chunk[EFFECT_VM_INSTR_SIZE] = {0};
+
+  zassert_equal(-EINVAL, effectVmWrite(CONFIG_LED_MNGR_EFFECT_VM_SIZE - 3,
+    chunk, sizeof(chunk)), "effectVmWrite failed to return the error code.");
+  zassert_equal(0, effectVmWrite(CONFIG_LED_MNGR_EFFECT_VM_SIZE - 4,
+    chunk, sizeof(chunk)), "effectVmWrite failed to write the last chunk.");
+}
+
+/**
+ * @test  effectVmLoad must reject an invalid program length.
+*/
+ZTEST(effectVm_suite, test_effectVmLoad_InvalidLength)
+{
+  uint16_t lengths[] = {0, EFFECT_VM_INSTR_SIZE + 1,
+                        CONFIG_LED_MNGR_EFFECT_VM_SIZE + EFFECT_VM_INSTR_SIZE};
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(lengths); ++i)
+    zassert_equal(-EINVAL, effectVmLoad(lengths[i]),
+      "effectVmLoad failed to reject the length %u.", lengths[i]);
+
+  zassert_equal(0, appMsgNotifyLedManager_fake.call_count,
+    "effectVmLoad notified the LED manager of an invalid program.");
+}
+
+/**
+ * @test  effectVmLoad must reject a program with an invalid instruction.
+*/
+ZTEST(effectVm_suite, test_effectVmLoad_InvalidInstruction)
+{
+  uint8_t programs[][2 * EFFECT_VM_INSTR_SIZE] = {
+    {EFFECT_VM_INSTR(EFFECT_VM_OP_COUNT, 0, 0, 0),
+     EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0)},
+    {EFFECT_VM_INSTR(EFFECT_VM_OP_ADD, 0, 1, EFFECT_VM_REG_COUNT),
+     EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0)},
+    {EFFECT_VM_INSTR(EFFECT_VM_OP_FILL, 0, 1, 0),
+     EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0)},
+    {EFFECT_VM_INSTR(EFFECT_VM_OP_WAIT, 1, 0, 0),
+     EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0)},
+    {EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JNZ, 0, 2),
+     EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0)},
+  };
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(programs); ++i)
+  {
+    zassert_equal(-ENOEXEC, loadProgram(programs[i], sizeof(programs[i])),
+      "effectVmLoad failed to reject the program %u.", i);
+    zassert_false(isPending, "effectVmLoad loaded an invalid program.");
+  }
+}
+
+/**
+ * @test  effectVmWrite and effectVmLoad must be rejected until the loaded
+ *        program is swapped in.
+*/
+ZTEST(effectVm_suite, test_effectVmLoad_Busy)
+{
+  uint8_t code[] = {EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0)};
+  EffectVmStats_t vmStats;
+
+  zassert_equal(0, effectVmWrite(0, code, sizeof(code)),
+    "effectVmWrite failed to write the program.");
+  zassert_equal(0, effectVmLoad(sizeof(code)),
+    "effectVmLoad failed to load the program.");
+  zassert_equal(1, appMsgNotifyLedManager_fake.call_count,
+    "effectVmLoad failed to notify the LED manager.");
+
+  zassert_equal(-EBUSY, effectVmWrite(0, code, sizeof(code)),
+    "effectVmWrite failed to wait for the swap.");
+  zassert_equal(-EBUSY, effectVmLoad(sizeof(code)),
+    "effectVmLoad failed to wait for the swap.");
+
+  zassert_true(effectVmSync(), "effectVmSync failed to swap the program in.");
+  zassert_false(effectVmSync(), "effectVmSync swapped the program twice.");
+  zassert_equal(0, effectVmWrite(0, code, sizeof(code)),
+    "effectVmWrite failed to write after the swap.");
+
+  effectVmGetStats(&vmStats);
+  zassert_equal(sizeof(code), vmStats.programSize, "bad program size.");
+  zassert_equal(1, vmStats.loadCount, "bad load count.");
+}
+
+/**
+ * @test  effectVmRunFrame must stop without program.
+*/
+ZTEST(effectVm_suite, test_effectVmRunFrame_NoProgram)
+{
+  zassert_false(runFrame(true), "effectVmRunFrame updated the pixels.");
+  zassert_false(effectVmIsRunning(&testCtx),
+    "effectVmRunFrame failed to stop without program.");
+}
+
+/**
+ * @test  effectVmRunFrame must run the program up to a WAIT, then skip the
+ *        waited frames.
+*/
+ZTEST(effectVm_suite, test_effectVmRunFrame_Wait)
+{
+  uint8_t code[] = {
+    EFFECT_VM_INSTR(EFFECT_VM_OP_FILL, 0, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_WAIT, 0, 1),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_FILL, 1, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_WAIT, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JMP, 0, 0),
+  };
+
+  zassert_equal(0, loadProgram(code, sizeof(code)),
+    "effectVmLoad failed to load the program.");
+
+  zassert_true(runFrame(true), "effectVmRunFrame failed to fill the pixels.");
+  zassert_true(isPixelColor(testPixels + 8, TEST_START_COLOR),
+    "effectVmRunFrame failed to fill the start color.");
+  zassert_false(runFrame(false), "effectVmRunFrame failed to wait a frame.");
+  zassert_true(runFrame(false), "effectVmRunFrame failed to resume.");
+  zassert_true(isPixelColor(testPixels, TEST_END_COLOR),
+    "effectVmRunFrame failed to fill the end color.");
+  zassert_true(runFrame(false), "effectVmRunFrame failed to loop.");
+  zassert_true(isPixelColor(testPixels, TEST_START_COLOR),
+    "effectVmRunFrame failed to loop back to the start color.");
+  zassert_true(effectVmIsRunning(&testCtx),
+    "effectVmRunFrame stopped a waiting program.");
+}
+
+/**
+ * @test  effectVmRunFrame must set and rotate the pixels.
+*/
+ZTEST(effectVm_suite, test_effectVmRunFrame_Chaser)
+{
+  uint8_t code[] = {
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 2, 0),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_FILL, 2, 0, 0),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_SET, 2, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 3, 1),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_WAIT, 0, 0),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_SHIFT, 3, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JMP, 0, 4),
+  };
+
+  zassert_equal(0, loadProgram(code, sizeof(code)),
+    "effectVmLoad failed to load the program.");
+
+  runFrame(true);
+  zassert_true(isPixelColor(testPixels, TEST_START_COLOR) &&
+    isPixelColor(testPixels + 1, 0), "effectVmRunFrame failed to set a pixel.");
+
+  for(uint8_t i = 1; i <= TEST_PIXEL_COUNT; ++i)
+  {
+    zassert_true(runFrame(false), "effectVmRunFrame failed to shift.");
+    zassert_true(isPixelColor(testPixels + i % TEST_PIXEL_COUNT,
+      TEST_START_COLOR), "effectVmRunFrame failed to move the pixel %u.", i);
+    zassert_true(isPixelColor(testPixels + (i - 1) % TEST_PIXEL_COUNT, 0),
+      "effectVmRunFrame failed to clear the pixel %u.", i - 1);
+  }
+}
+
+/**
+ * @test  effectVmRunFrame must run the arithmetic and branch instructions.
+*/
+ZTEST(effectVm_suite, test_effectVmRunFrame_Arithmetic)
+{
+  uint8_t code[] = {
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 2, 0x1234),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDIH, 2, 0xabcd),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_CNT, 3, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 4, 20),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_MOD, 5, 4, 3),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_ADD, 6, 4, 3),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_SUB, 7, 3, 4),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_ADDI, 4, -4 & 0xffff),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JNZ, 4, 7),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_MOV, 1, 0, 0),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0),
+  };
+
+  zassert_equal(0, loadProgram(code, sizeof(code)),
+    "effectVmLoad failed to load the program.");
+
+  zassert_false(runFrame(true), "effectVmRunFrame updated the pixels.");
+  zassert_false(effectVmIsRunning(&testCtx),
+    "effectVmRunFrame failed to end the program.");
+  zassert_equal(0xabcd1234, testCtx.regs[2], "bad LDI/LDIH result.");
+  zassert_equal(TEST_PIXEL_COUNT, testCtx.regs[3], "bad CNT result.");
+  zassert_equal(20 % TEST_PIXEL_COUNT, testCtx.regs[5], "bad MOD result.");
+  zassert_equal(20 + TEST_PIXEL_COUNT, testCtx.regs[6], "bad ADD result.");
+  zassert_equal((uint32_t)(TEST_PIXEL_COUNT - 20), testCtx.regs[7],
+    "bad SUB result.");
+  zassert_equal(0, testCtx.regs[4], "bad ADDI/JNZ loop result.");
+  zassert_equal(TEST_START_COLOR, testCtx.regs[1], "bad MOV result.");
+}
+
+/**
+ * @test  effectVmRunFrame must run the color instructions.
+*/
+ZTEST(effectVm_suite, test_effectVmRunFrame_Color)
+{
+  uint8_t code[] = {
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 2, 85),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_WHEEL, 3, 2, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 4, 128),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_MOV, 5, 0, 0),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_BLEND, 5, 1, 4),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_FILL, 5, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 6, 0x40),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_FADE, 6, 0, 0),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_LDI, 2, 4),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_GET, 7, 2, 0),
+    EFFECT_VM_INSTR(EFFECT_VM_OP_END, 0, 0, 0),
+  };
+
+  zassert_equal(0, loadProgram(code, sizeof(code)),
+    "effectVmLoad failed to load the program.");
+
+  zassert_true(runFrame(true), "effectVmRunFrame failed to fill the pixels.");
+  zassert_equal(0x0000ff, testCtx.regs[3], "bad WHEEL result.");
+  zassert_equal(0x902040, testCtx.regs[5], "bad BLEND result.");
+  zassert_equal(0x500000, testCtx.regs[7], "bad FADE/GET result.");
+  zassert_true(isPixelColor(testPixels, 0x500000),
+    "effectVmRunFrame failed to fade the pixels.");
+}
+
+/**
+ * @test  effectVmRunFrame must fault and stop a program over its budget.
+*/
+ZTEST(effectVm_suite, test_effectVmRunFrame_Budget)
+{
+  uint8_t code[] = {
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_ADDI, 2, 1),
+    EFFECT_VM_INSTR_IMM(EFFECT_VM_OP_JMP, 0, 0),
+  };
+  EffectVmStats_t vmStats;
+
+  zassert_equal(0, loadProgram(code, sizeof(code)),
+    "effectVmLoad failed to load the program.");
+
+  runFrame(true);
+  zassert_false(effectVmIsRunning(&testCtx),
+    "effectVmRunFrame failed to stop the program.");
+  zassert_equal(CONFIG_LED_MNGR_EFFECT_VM_BUDGET / 2, testCtx.regs[2],
+    "effectVmRunFrame failed to enforce the budget.");
+
+  effectVmGetStats(&vmStats);
+  zassert_equal(1, vmStats.faultCount, "bad fault count.");
+
+  zassert_false(runFrame(false), "effectVmRunFrame ran a faulted program.");
+  runFrame(true);
+  zassert_equal(2, stats.faultCount,
+    "effectVmRunFrame failed to restart the program on reset.");
+}
+
+/**
+ * @test  effectVmRunFrame must stop a program running past its end.
+*/
+ZTEST(effectVm_suite, test_effectVmRunFrame_PastEnd)
+{
+  uint8_t code[] = {EFFECT_VM_INSTR(EFFECT_VM_OP_FILL, 1, 0, 0)};
+
+  zassert_equal(0, loadProgram(code, sizeof(code)),
+    "effectVmLoad failed to load the program.");
+
+  zassert_true(runFrame(true), "effectVmRunFrame failed to fill the pixels.");
+  zassert_false(effectVmIsRunning(&testCtx),
+    "effectVmRunFrame failed to stop the program.");
+  zassert_equal(0, stats.faultCount,
+    "effectVmRunFrame faulted an ended program.");
+}
+
+/** @} */
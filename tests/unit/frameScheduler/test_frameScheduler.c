@@ -0,0 +1,195 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_frameScheduler.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Scheduler Module Test Cases
+ *
+ *            This file is the test cases of the frame scheduler module.
+ *
+ * @ingroup  frameScheduler
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#include "frameScheduler.h"
+#include "frameScheduler.c"
+
+/**
+ * @brief The test frame rate.
+*/
+#define TEST_FPS                        100
+
+/**
+ * @brief The test frame period in microseconds.
+*/
+#define TEST_FRAME_PERIOD_US            (USEC_PER_SEC / TEST_FPS)
+
+/**
+ * @brief The test frame count.
+*/
+#define TEST_FRAME_COUNT                10
+
+/**
+ * @brief   Wait for the next frame deadline and start the frame, like the
+ *          LED manager does.
+ */
+static void waitNextFrame(void)
+{
+  k_sleep(frameSchedGetNextDeadline());
+  frameSchedStartFrame();
+}
+
+static void frameSchedCaseSetup(void *f)
+{
+  zassume_true(frameSchedInit(TEST_FPS) == 0, NULL);
+}
+
+ZTEST_SUITE(frameSched_suite, NULL, NULL, frameSchedCaseSetup, NULL, NULL);
+
+/**
+ * @test  frameSchedInit must return -EINVAL when the frame rate is 0 or
+ *        faster than the system tick.
+*/
+ZTEST(frameSched_suite, test_frameSchedInit_InvalidFps)
+{
+  zassert_equal(-EINVAL, frameSchedInit(0),
+    "frameSchedInit failed to return the error code.");
+  zassert_equal(-EINVAL, frameSchedInit(CONFIG_SYS_CLOCK_TICKS_PER_SEC + 1),
+    "frameSchedInit failed to return the error code.");
+}
+
+/**
+ * @test  frameSchedInit must set the target frame rate and reset the
+ *        statistics.
+*/
+ZTEST(frameSched_suite, test_frameSchedInit_Success)
+{
+  FrameSchedStats_t stats;
+
+  waitNextFrame();
+
+  zassert_equal(0, frameSchedInit(TEST_FPS),
+    "frameSchedInit failed to return the success code.");
+  zassert_equal(TEST_FPS, frameSchedGetFps(),
+    "frameSchedInit failed to set the target frame rate.");
+
+  frameSchedGetStats(&stats);
+  zassert_equal(0, stats.frameCount,
+    "frameSchedInit failed to reset the statistics.");
+  zassert_equal(0, stats.missedCount,
+    "frameSchedInit failed to reset the statistics.");
+}
+
+/**
+ * @test  frameSchedGetNextDeadline and frameSchedStartFrame must wake up on
+ *        each frame deadline, even when some render time is spent between
+ *        the frames.
+*/
+ZTEST(frameSched_suite, test_frameSchedGetNextDeadline_NoDrift)
+{
+  FrameSchedStats_t stats;
+  int64_t start;
+  int64_t elapsed;
+  int64_t expected = k_us_to_ticks_ceil64(TEST_FRAME_COUNT *
+    TEST_FRAME_PERIOD_US);
+
+  start = k_uptime_ticks();
+
+  for(uint8_t i = 0; i < TEST_FRAME_COUNT; ++i)
+  {
+    k_busy_wait(TEST_FRAME_PERIOD_US / 2);
+    waitNextFrame();
+  }
+
+  elapsed = k_uptime_ticks() - start;
+
+  frameSchedGetStats(&stats);
+  zassert_equal(TEST_FRAME_COUNT, stats.frameCount,
+    "frameSchedStartFrame failed to count the frames.");
+  zassert_equal(0, stats.missedCount,
+    "frameSchedGetNextDeadline failed to meet the deadlines.");
+  zassert_true(elapsed >= expected - 1 &&
+    elapsed <= expected + k_us_to_ticks_ceil64(TEST_FRAME_PERIOD_US),
+    "frameSchedGetNextDeadline failed to keep the frame period.");
+  zassert_true(stats.maxJitter >= stats.lastJitter,
+    "frameSchedStartFrame failed to track the maximum jitter.");
+}
+
+/**
+ * @test  frameSchedGetNextDeadline must count a missed deadline and the
+ *        dropped frame periods when the render overruns the frame.
+*/
+ZTEST(frameSched_suite, test_frameSchedGetNextDeadline_MissedDeadline)
+{
+  FrameSchedStats_t stats;
+
+  k_busy_wait(3 * TEST_FRAME_PERIOD_US + TEST_FRAME_PERIOD_US / 2);
+  waitNextFrame();
+
+  frameSchedGetStats(&stats);
+  zassert_equal(1, stats.frameCount,
+    "frameSchedStartFrame failed to count the frame.");
+  zassert_equal(1, stats.missedCount,
+    "frameSchedGetNextDeadline failed to count the missed deadline.");
+  zassert_true(stats.overrunCount >= 3,
+    "frameSchedGetNextDeadline failed to count the dropped frame periods.");
+
+  waitNextFrame();
+
+  frameSchedGetStats(&stats);
+  zassert_equal(1, stats.missedCount,
+    "frameSchedGetNextDeadline failed to resume the frame schedule.");
+}
+
+/**
+ * @test  frameSchedRestart must schedule the next frame one period from now
+ *        without counting the idle time as missed deadlines.
+*/
+ZTEST(frameSched_suite, test_frameSchedRestart_Idle)
+{
+  FrameSchedStats_t stats;
+  int64_t start;
+
+  k_busy_wait(5 * TEST_FRAME_PERIOD_US);
+  frameSchedRestart();
+  start = k_uptime_ticks();
+  waitNextFrame();
+
+  frameSchedGetStats(&stats);
+  zassert_equal(0, stats.missedCount,
+    "frameSchedRestart failed to restart the frame schedule.");
+  zassert_equal(0, stats.overrunCount,
+    "frameSchedRestart failed to restart the frame schedule.");
+  zassert_within(k_us_to_ticks_ceil64(TEST_FRAME_PERIOD_US),
+    k_uptime_ticks() - start, 1,
+    "frameSchedRestart failed to schedule the next frame one period ahead.");
+}
+
+/**
+ * @test  frameSchedResetStats must clear the statistics.
+*/
+ZTEST(frameSched_suite, test_frameSchedResetStats_Clear)
+{
+  FrameSchedStats_t stats;
+
+  k_busy_wait(2 * TEST_FRAME_PERIOD_US);
+  waitNextFrame();
+
+  frameSchedResetStats();
+
+  frameSchedGetStats(&stats);
+  zassert_equal(0, stats.frameCount,
+    "frameSchedResetStats failed to clear the statistics.");
+  zassert_equal(0, stats.missedCount,
+    "frameSchedResetStats failed to clear the statistics.");
+  zassert_equal(0, stats.overrunCount,
+    "frameSchedResetStats failed to clear the statistics.");
+  zassert_equal(0, stats.maxJitter,
+    "frameSchedResetStats failed to clear the statistics.");
+}
+
+/** @} */
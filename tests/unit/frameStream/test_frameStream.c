@@ -0,0 +1,486 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_frameStream.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Frame Stream Module Test Cases
+ *
+ *            This file is the test cases of the frame stream module.
+ *
+ * @ingroup  frameStream
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "frameStream.h"
+#include "frameStream.c"
+
+#include "appMsg.h"
+#include "zephyrLedStrip.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(appMsgNotifyLedManager);
+
+/**
+ * @brief The test pixel count.
+*/
+#define TEST_PIXEL_COUNT                18
+
+/**
+ * @brief The test frame chunk pixel count.
+*/
+#define TEST_CHUNK_PIXEL_COUNT          6
+
+/**
+ * @brief The loopback test frame count.
+*/
+#define TEST_LOOPBACK_FRAME_COUNT       500
+
+/**
+ * @brief The loopback producer thread stack size.
+*/
+#define TEST_PRODUCER_STACK_SIZE        512
+
+K_THREAD_STACK_DEFINE(testProducer_stack, TEST_PRODUCER_STACK_SIZE);
+
+/**
+ * @brief The loopback producer thread.
+*/
+static struct k_thread testProducer;
+
+/**
+ * @brief The loopback producer done flag.
+*/
+static volatile bool isProducerDone;
+
+/**
+ * @brief   Fill a synthetic frame. Each pixel holds the frame number and its
+ *          LED ID, so a torn frame can be detected.
+ *
+ * @param frameNum    The frame number.
+ * @param rgb         The output frame, FRAME_STREAM_PIXEL_SIZE bytes per pixel.
+ */
+static void fillFrame(uint16_t frameNum, uint8_t *rgb)
+{
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    rgb[i * FRAME_STREAM_PIXEL_SIZE] = frameNum & 0xff;
+    rgb[i * FRAME_STREAM_PIXEL_SIZE + 1] = frameNum >> 8;
+    rgb[i * FRAME_STREAM_PIXEL_SIZE + 2] = i;
+  }
+}
+
+/**
+ * @brief   Write a synthetic frame in chunks.
+ *
+ * @param frameNum    The frame number.
+ *
+ * @return  The status of the last chunk.
+ */
+static int writeFrame(uint16_t frameNum)
+{
+  uint8_t rgb[TEST_PIXEL_COUNT * FRAME_STREAM_PIXEL_SIZE];
+  int rc = 0;
+
+  fillFrame(frameNum, rgb);
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; i += TEST_CHUNK_PIXEL_COUNT)
+    rc = frameStreamWrite(i, rgb + i * FRAME_STREAM_PIXEL_SIZE,
+      TEST_CHUNK_PIXEL_COUNT);
+
+  return rc;
+}
+
+/**
+ * @brief   Check a latched synthetic frame.
+ *
+ * @param pixels      The latched pixels.
+ *
+ * @return  The frame number.
+ */
+static uint16_t checkFrame(const ZephyrRgbPixel_t *pixels)
+{
+  uint16_t frameNum = pixels[0].r | pixels[0].g << 8;
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    zassert_equal(frameNum, pixels[i].r | pixels[i].g << 8,
+      "the latched frame is torn.");
+    zassert_equal(i, pixels[i].b, "the latched frame pixels are misplaced.");
+  }
+
+  return frameNum;
+}
+
+static void frameStreamCaseSetup(void *f)
+{
+  RESET_FAKE(appMsgNotifyLedManager);
+
+  memset(&ring, 0x00, sizeof(ring));
+  memset(&stats, 0x00, sizeof(stats));
+  memset(slots, 0x00, sizeof(slots));
+}
+
+ZTEST_SUITE(frameStream_suite, NULL, NULL, frameStreamCaseSetup, NULL, NULL);
+
+/**
+ * @test  frameStreamStart and frameStreamStop must set the stream state and
+ *        wake the LED manager up.
+*/
+ZTEST(frameStream_suite, test_frameStreamStartStop_State)
+{
+  frameStreamStart();
+
+  zassert_true(frameStreamIsActive(),
+    "frameStreamStart failed to start the stream.");
+  zassert_equal(1, appMsgNotifyLedManager_fake.call_count,
+    "frameStreamStart failed to wake the LED manager up.");
+
+  frameStreamStop();
+
+  zassert_false(frameStreamIsActive(),
+    "frameStreamStop failed to stop the stream.");
+  zassert_equal(2, appMsgNotifyLedManager_fake.call_count,
+    "frameStreamStop failed to wake the LED manager up.");
+}
+
+/**
+ * @test  frameStreamWrite must reject the pixels while the stream is stopped
+ *        and the pixels out of the frame.
+*/
+ZTEST(frameStream_suite, test_frameStreamWrite_Invalid)
+{
+  uint8_t rgb[2 * FRAME_STREAM_PIXEL_SIZE] = {0};
+
+  zassert_equal(-EPERM, frameStreamWrite(0, rgb, 1),
+    "frameStreamWrite failed to reject the stopped stream.");
+
+  frameStreamStart();
+
+  zassert_equal(-EINVAL, frameStreamWrite(0, rgb, 0),
+    "frameStreamWrite failed to reject the empty write.");
+  zassert_equal(-EINVAL, frameStreamWrite(TEST_PIXEL_COUNT - 1, rgb, 2),
+    "frameStreamWrite failed to reject the pixels out of the frame.");
+  zassert_equal(0, ring.head, "frameStreamWrite published a frame.");
+}
+
+/**
+ * @test  A frame must be published once its last LED is written and latched
+ *        with its pixels.
+*/
+ZTEST(frameStream_suite, test_frameStream_PublishOnLastLed)
+{
+  uint8_t rgb[TEST_PIXEL_COUNT * FRAME_STREAM_PIXEL_SIZE];
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+  uint8_t half = TEST_PIXEL_COUNT / 2;
+
+  frameStreamStart();
+  fillFrame(0x1234, rgb);
+
+  zassert_equal(0, frameStreamWrite(0, rgb, half),
+    "frameStreamWrite failed to return the success code.");
+  zassert_equal(-ENOMSG, frameStreamLatch(pixels),
+    "frameStreamLatch latched a partial frame.");
+
+  zassert_equal(0, frameStreamWrite(half, rgb + half * FRAME_STREAM_PIXEL_SIZE,
+    TEST_PIXEL_COUNT - half),
+    "frameStreamWrite failed to return the success code.");
+  zassert_equal(0, frameStreamLatch(pixels),
+    "frameStreamLatch failed to latch the published frame.");
+  zassert_equal(0x1234, checkFrame(pixels),
+    "frameStreamLatch failed to latch the frame pixels.");
+  zassert_equal(1, stats.frameCount, "the latched frame was not counted.");
+  zassert_equal(0, stats.underrunCount,
+    "the wait for the first frame was counted as underrun.");
+}
+
+/**
+ * @test  A frame deadline without new frame must be counted as underrun once
+ *        a first frame was latched.
+*/
+ZTEST(frameStream_suite, test_frameStreamLatch_Underrun)
+{
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+
+  frameStreamStart();
+
+  zassert_equal(-ENOMSG, frameStreamLatch(pixels),
+    "frameStreamLatch failed to return the error code.");
+  zassert_equal(0, stats.underrunCount,
+    "the wait for the first frame was counted as underrun.");
+
+  writeFrame(1);
+  frameStreamLatch(pixels);
+
+  zassert_equal(-ENOMSG, frameStreamLatch(pixels),
+    "frameStreamLatch failed to return the error code.");
+  zassert_equal(1, stats.underrunCount, "the underrun was not counted.");
+}
+
+/**
+ * @test  A frame written while every slot is full must be dropped as a whole
+ *        and counted as overrun, even when a slot is released meanwhile.
+*/
+ZTEST(frameStream_suite, test_frameStreamWrite_Overrun)
+{
+  uint8_t rgb[TEST_PIXEL_COUNT * FRAME_STREAM_PIXEL_SIZE];
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+
+  frameStreamStart();
+
+  for(uint16_t i = 0; i < CONFIG_LED_MNGR_STREAM_SLOTS; ++i)
+    zassert_equal(0, writeFrame(i),
+      "frameStreamWrite failed to return the success code.");
+
+  fillFrame(0xbeef, rgb);
+  zassert_equal(-ENOSPC, frameStreamWrite(0, rgb, TEST_CHUNK_PIXEL_COUNT),
+    "frameStreamWrite failed to drop the frame.");
+
+  frameStreamLatch(pixels);
+
+  zassert_equal(-ENOSPC, frameStreamWrite(TEST_CHUNK_PIXEL_COUNT,
+    rgb + TEST_CHUNK_PIXEL_COUNT * FRAME_STREAM_PIXEL_SIZE,
+    TEST_PIXEL_COUNT - TEST_CHUNK_PIXEL_COUNT),
+    "frameStreamWrite failed to drop the rest of the frame.");
+  zassert_equal(1, stats.overrunCount, "the overrun was not counted.");
+
+  zassert_equal(0, writeFrame(CONFIG_LED_MNGR_STREAM_SLOTS),
+    "frameStreamWrite failed to recover from the overrun.");
+
+  for(uint16_t i = 1; i <= CONFIG_LED_MNGR_STREAM_SLOTS; ++i)
+  {
+    zassert_equal(0, frameStreamLatch(pixels),
+      "frameStreamLatch failed to latch the published frame.");
+    zassert_equal(i, checkFrame(pixels),
+      "frameStreamLatch failed to latch the frames in order.");
+  }
+}
+
+/**
+ * @test  frameStreamFlush must drop the published frames and wait for a new
+ *        first frame.
+*/
+ZTEST(frameStream_suite, test_frameStreamFlush_DropFrames)
+{
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+
+  frameStreamStart();
+  writeFrame(0);
+  frameStreamLatch(pixels);
+  writeFrame(1);
+  frameStreamStop();
+
+  frameStreamFlush();
+
+  zassert_equal(-ENOMSG, frameStreamLatch(pixels),
+    "frameStreamFlush failed to drop the published frames.");
+  zassert_equal(0, stats.underrunCount,
+    "the wait for the first frame was counted as underrun.");
+}
+
+/**
+ * @test  frameStreamWriteDelta must decode the operations in place on top of
+ *        the last published frame.
+*/
+ZTEST(frameStream_suite, test_frameStreamWriteDelta_Decode)
+{
+  const uint8_t ops[] = {FRAME_STREAM_OP_SKIP | 1,
+                         FRAME_STREAM_OP_LITERAL | 1, 0x11, 0x12, 0x13,
+                                                      0x21, 0x22, 0x23,
+                         FRAME_STREAM_OP_RUN | 3, 0x31, 0x32, 0x33};
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+
+  frameStreamStart();
+  writeFrame(0x0102);
+
+  zassert_equal(0, frameStreamWriteDelta(4, ops, sizeof(ops), true),
+    "frameStreamWriteDelta failed to return the success code.");
+  frameStreamLatch(pixels);
+  frameStreamLatch(pixels);
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    if(i == 6 || i == 7)
+    {
+      zassert_equal(0x11 + (i - 6) * 0x10, pixels[i].r,
+        "frameStreamWriteDelta failed to decode the literal.");
+      zassert_equal(0x13 + (i - 6) * 0x10, pixels[i].b,
+        "frameStreamWriteDelta failed to decode the literal.");
+    }
+    else if(i >= 8 && i < 12)
+    {
+      zassert_equal(0x31, pixels[i].r,
+        "frameStreamWriteDelta failed to decode the run.");
+      zassert_equal(0x32, pixels[i].g,
+        "frameStreamWriteDelta failed to decode the run.");
+      zassert_equal(0x33, pixels[i].b,
+        "frameStreamWriteDelta failed to decode the run.");
+    }
+    else
+    {
+      zassert_equal(0x02, pixels[i].r,
+        "frameStreamWriteDelta failed to keep the unchanged LED.");
+      zassert_equal(i, pixels[i].b,
+        "frameStreamWriteDelta failed to keep the unchanged LED.");
+    }
+  }
+}
+
+/**
+ * @test  frameStreamWriteDelta must publish a chunked delta frame on its last
+ *        write only.
+*/
+ZTEST(frameStream_suite, test_frameStreamWriteDelta_Chunks)
+{
+  const uint8_t first[] = {FRAME_STREAM_OP_RUN | 8, 0xaa, 0xbb, 0xcc};
+  const uint8_t last[] = {FRAME_STREAM_OP_RUN | 8, 0x11, 0x22, 0x33};
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+
+  frameStreamStart();
+
+  zassert_equal(0, frameStreamWriteDelta(0, first, sizeof(first), false),
+    "frameStreamWriteDelta failed to return the success code.");
+  zassert_equal(-ENOMSG, frameStreamLatch(pixels),
+    "frameStreamWriteDelta published a partial frame.");
+  zassert_equal(0, frameStreamWriteDelta(9, last, sizeof(last), true),
+    "frameStreamWriteDelta failed to return the success code.");
+  zassert_equal(0, frameStreamLatch(pixels),
+    "frameStreamWriteDelta failed to publish the frame.");
+  zassert_equal(0xaa, pixels[8].r,
+    "frameStreamWriteDelta failed to decode the first chunk.");
+  zassert_equal(0x33, pixels[9].b,
+    "frameStreamWriteDelta failed to decode the last chunk.");
+}
+
+/**
+ * @test  frameStreamWriteDelta must drop the frame of invalid operations up
+ *        to its last write and count the decoding error.
+*/
+ZTEST(frameStream_suite, test_frameStreamWriteDelta_Invalid)
+{
+  const uint8_t badOp[] = {FRAME_STREAM_OP_MASK};
+  const uint8_t truncLiteral[] = {FRAME_STREAM_OP_LITERAL | 1, 0x01, 0x02,
+                                  0x03};
+  const uint8_t truncRun[] = {FRAME_STREAM_OP_RUN, 0x01};
+  const uint8_t overflow[] = {FRAME_STREAM_OP_SKIP | (TEST_PIXEL_COUNT - 1),
+                              FRAME_STREAM_OP_RUN | 1, 0x01, 0x02, 0x03};
+  const uint8_t valid[] = {FRAME_STREAM_OP_SKIP};
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+
+  frameStreamStart();
+
+  zassert_equal(-EINVAL, frameStreamWriteDelta(TEST_PIXEL_COUNT + 1, valid,
+    sizeof(valid), true),
+    "frameStreamWriteDelta failed to reject the LED out of the frame.");
+
+  zassert_equal(-EBADMSG, frameStreamWriteDelta(0, badOp, sizeof(badOp),
+    false), "frameStreamWriteDelta failed to reject the bad operation.");
+  zassert_equal(-EBADMSG, frameStreamWriteDelta(0, valid, sizeof(valid),
+    false), "frameStreamWriteDelta failed to drop the rest of the frame.");
+  zassert_equal(-EBADMSG, frameStreamWriteDelta(0, valid, sizeof(valid),
+    true), "frameStreamWriteDelta failed to drop the rest of the frame.");
+
+  zassert_equal(-EBADMSG, frameStreamWriteDelta(0, truncLiteral,
+    sizeof(truncLiteral), true),
+    "frameStreamWriteDelta failed to reject the truncated literal.");
+  zassert_equal(-EBADMSG, frameStreamWriteDelta(0, truncRun,
+    sizeof(truncRun), true),
+    "frameStreamWriteDelta failed to reject the truncated run.");
+  zassert_equal(-EBADMSG, frameStreamWriteDelta(0, overflow,
+    sizeof(overflow), true),
+    "frameStreamWriteDelta failed to reject the operation out of the frame.");
+
+  zassert_equal(4, stats.decodeErrorCount,
+    "the decoding errors were not counted.");
+  zassert_equal(-ENOMSG, frameStreamLatch(pixels),
+    "frameStreamWriteDelta published an invalid frame.");
+
+  zassert_equal(0, frameStreamWriteDelta(0, valid, sizeof(valid), true),
+    "frameStreamWriteDelta failed to recover from the decoding error.");
+}
+
+/**
+ * @test  frameStreamWriteDelta must drop the frame written while every slot
+ *        is full and count the overrun.
+*/
+ZTEST(frameStream_suite, test_frameStreamWriteDelta_Overrun)
+{
+  const uint8_t ops[] = {FRAME_STREAM_OP_SKIP};
+
+  frameStreamStart();
+
+  for(uint16_t i = 0; i < CONFIG_LED_MNGR_STREAM_SLOTS; ++i)
+    writeFrame(i);
+
+  zassert_equal(-ENOSPC, frameStreamWriteDelta(0, ops, sizeof(ops), false),
+    "frameStreamWriteDelta failed to drop the frame.");
+  zassert_equal(-ENOSPC, frameStreamWriteDelta(0, ops, sizeof(ops), true),
+    "frameStreamWriteDelta failed to drop the frame.");
+  zassert_equal(1, stats.overrunCount, "the overrun was not counted.");
+  zassert_equal(CONFIG_LED_MNGR_STREAM_SLOTS, ring.head,
+    "frameStreamWriteDelta published the dropped frame.");
+}
+
+/**
+ * @brief   The loopback producer thread, streaming the synthetic frames as
+ *          the host link would.
+ *
+ * @param p1          First user parameter.
+ * @param p2          Second user parameter.
+ * @param p3          Third user parameter.
+ */
+static void testProducerThread(void *p1, void *p2, void *p3)
+{
+  for(uint16_t i = 0; i < TEST_LOOPBACK_FRAME_COUNT; ++i)
+  {
+    writeFrame(i);
+    k_yield();
+  }
+
+  isProducerDone = true;
+}
+
+/**
+ * @test  The synthetic frames streamed from a producer thread must be latched
+ *        whole and in order, and every frame must be either latched or
+ *        counted as overrun.
+*/
+ZTEST(frameStream_suite, test_frameStream_Loopback)
+{
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT];
+  int32_t lastFrameNum = -1;
+  uint16_t frameNum;
+
+  frameStreamStart();
+  isProducerDone = false;
+
+  k_thread_create(&testProducer, testProducer_stack,
+    K_THREAD_STACK_SIZEOF(testProducer_stack), testProducerThread, NULL, NULL,
+    NULL, k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+  do
+  {
+    if(frameStreamLatch(pixels) == 0)
+    {
+      frameNum = checkFrame(pixels);
+      zassert_true(frameNum > lastFrameNum,
+        "the frames were not latched in order.");
+      lastFrameNum = frameNum;
+    }
+    k_yield();
+  } while(!isProducerDone || ring.head != ring.tail);
+
+  k_thread_join(&testProducer, K_FOREVER);
+
+  zassert_true(lastFrameNum >= 0, "no frame was latched.");
+  zassert_equal(TEST_LOOPBACK_FRAME_COUNT,
+    stats.frameCount + stats.overrunCount,
+    "the frames were not all latched or counted as overrun.");
+}
+
+/** @} */
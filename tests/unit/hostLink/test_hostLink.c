@@ -0,0 +1,931 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_hostLink.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Host Link Module Test Cases
+ *
+ *            This file is the test cases of the host link module. The
+ *            captured frames are fed through a fake UART.
+ *
+ * @ingroup  hostLink
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "hostLink.h"
+#include "hostLink.c"
+
+#include "appMsg.h"
+#include "compositor.h"
+#include "effectVm.h"
+#include "frameStream.h"
+#include "ledManager.h"
+#include "timeline.h"
+#include "zephyrCommon.h"
+#include "zephyrThread.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(int, appMsgPushLedSequence, LedSequence_t*);
+FAKE_VOID_FUNC(appMsgBeginLedTransaction, LedTransaction_t*);
+FAKE_VALUE_FUNC(int, appMsgStageLedSequence, LedTransaction_t*, LedSequence_t*);
+FAKE_VALUE_FUNC(int, appMsgCommitLedTransaction, LedTransaction_t*);
+FAKE_VOID_FUNC(zephyrThreadCreate, ZephyrThread_t*, char*, uint32_t,
+  ZephyrTimeUnit_t);
+#ifdef CONFIG_LED_MNGR_STREAM
+FAKE_VOID_FUNC(frameStreamStart);
+FAKE_VOID_FUNC(frameStreamStop);
+FAKE_VALUE_FUNC(int, frameStreamWrite, uint16_t, const uint8_t*, size_t);
+FAKE_VALUE_FUNC(int, frameStreamWriteDelta, uint16_t, const uint8_t*, size_t,
+  bool);
+#endif
+#ifdef CONFIG_LED_MNGR_TIMELINE
+FAKE_VALUE_FUNC(int, timelineWrite, uint16_t, const uint8_t*, size_t);
+FAKE_VALUE_FUNC(int, timelinePlay);
+FAKE_VOID_FUNC(timelineStop);
+#endif
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+FAKE_VALUE_FUNC(int, effectVmWrite, uint16_t, const uint8_t*, size_t);
+FAKE_VALUE_FUNC(int, effectVmLoad, uint16_t);
+#endif
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+FAKE_VALUE_FUNC(int, compositorSetLayer, const CompositorLayer_t*);
+#endif
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+FAKE_VOID_FUNC(ledMngrSetTransitionTime, uint16_t);
+#endif
+
+/**
+ * @brief The fake UART TX capture size.
+*/
+#define TEST_TX_CAPTURE_SIZE            64
+
+/**
+ * @brief The captured ping frame.
+*/
+static const uint8_t pingFrame[] = {0x04, 0x01, 0xd1, 0xf1, 0x00};
+
+/**
+ * @brief The captured ping reply frame.
+*/
+static const uint8_t pingReplyFrame[] = {0x02, 0x81, 0x03, 0xa6, 0x35, 0x00};
+
+/**
+ * @brief The captured LED sequence frame: a 3 seconds 0x123456 breather on
+ *        section 1.
+*/
+static const uint8_t sequenceFrame[] = {0x07, 0x02, 0x01, 0x01, 0x01, 0x02,
+                                        0x03, 0x04, 0x56, 0x34, 0x12, 0x01,
+                                        0x01, 0x03, 0xf3, 0x96, 0x00};
+
+/**
+ * @brief The captured LED sequence reply frame.
+*/
+static const uint8_t sequenceReplyFrame[] = {0x02, 0x82, 0x03, 0xf5, 0x60,
+                                             0x00};
+
+/**
+ * @brief The captured frame of an unknown command.
+*/
+static const uint8_t unknownFrame[] = {0x04, 0x7f, 0x88, 0x6e, 0x00};
+
+/**
+ * @brief The last pushed LED sequence.
+*/
+static LedSequence_t pushedSequence;
+
+/**
+ * @brief The fake UART RX stream.
+*/
+static const uint8_t *rxStream;
+
+/**
+ * @brief The fake UART RX stream length.
+*/
+static size_t rxStreamLen;
+
+/**
+ * @brief The fake UART RX stream read index.
+*/
+static size_t rxStreamIdx;
+
+/**
+ * @brief The fake UART RX FIFO depth, the bytes available per interrupt.
+*/
+static size_t rxFifoDepth;
+
+/**
+ * @brief The fake UART TX capture.
+*/
+static uint8_t txCapture[TEST_TX_CAPTURE_SIZE];
+
+/**
+ * @brief The fake UART TX capture length.
+*/
+static size_t txCaptureLen;
+
+/**
+ * @brief The fake UART RX enable count.
+*/
+static uint32_t rxEnableCount;
+
+/**
+ * @brief The fake UART ISR.
+*/
+static uart_irq_callback_user_data_t fakeIsr;
+
+/**
+ * @brief The fake UART bytes left in the FIFO for the current interrupt.
+*/
+static size_t rxFifoLeft;
+
+static int capturePushedSequence(LedSequence_t *sequence)
+{
+  memcpy(&pushedSequence, sequence, sizeof(pushedSequence));
+  return appMsgPushLedSequence_fake.return_val;
+}
+
+static int fakeFifoRead(const struct device *dev, uint8_t *data, const int size)
+{
+  int count = 0;
+
+  while(count < size && rxFifoLeft > 0 && rxStreamIdx < rxStreamLen)
+  {
+    data[count++] = rxStream[rxStreamIdx++];
+    --rxFifoLeft;
+  }
+
+  return count;
+}
+
+static void fakeIrqRxEnable(const struct device *dev)
+{
+  ++rxEnableCount;
+}
+
+static int fakeIrqRxReady(const struct device *dev)
+{
+  return rxFifoLeft > 0 && rxStreamIdx < rxStreamLen;
+}
+
+static int fakeIrqUpdate(const struct device *dev)
+{
+  return 1;
+}
+
+static void fakeIrqCallbackSet(const struct device *dev,
+  uart_irq_callback_user_data_t cb, void *userData)
+{
+  fakeIsr = cb;
+}
+
+static void fakePollOut(const struct device *dev, unsigned char c)
+{
+  if(txCaptureLen < TEST_TX_CAPTURE_SIZE)
+    txCapture[txCaptureLen++] = c;
+}
+
+/**
+ * @brief The fake UART driver API.
+*/
+static const struct uart_driver_api fakeUartApi = {
+  .fifo_read = fakeFifoRead,
+  .irq_rx_enable = fakeIrqRxEnable,
+  .irq_rx_ready = fakeIrqRxReady,
+  .irq_update = fakeIrqUpdate,
+  .irq_callback_set = fakeIrqCallbackSet,
+  .poll_out = fakePollOut,
+};
+
+/**
+ * @brief The fake UART state.
+*/
+static struct device_state fakeUartState = {.initialized = true};
+
+/**
+ * @brief The fake UART.
+*/
+static const struct device fakeUart = {
+  .name = "fakeUart",
+  .api = &fakeUartApi,
+  .state = &fakeUartState,
+};
+
+/**
+ * @brief   Feed a byte stream through the fake UART, raising an interrupt
+ *          each time the FIFO is filled.
+ *
+ * @param stream      The byte stream.
+ * @param len         The stream length.
+ */
+static void feedUart(const uint8_t *stream, size_t len)
+{
+  rxStream = stream;
+  rxStreamLen = len;
+  rxStreamIdx = 0;
+
+  while(rxStreamIdx < rxStreamLen)
+  {
+    rxFifoLeft = rxFifoDepth;
+    uartIsr(&fakeUart, NULL);
+  }
+}
+
+/**
+ * @brief   Decode the status of the captured reply frame.
+ *
+ * @param cmd         The expected replied command.
+ *
+ * @return  The reply status.
+ */
+static int decodeReplyStatus(uint8_t cmd)
+{
+  uint8_t frame[HOST_LINK_REPLY_SIZE];
+  int len;
+
+  zassert_true(txCaptureLen > 1, "no reply was sent.");
+  zassert_equal(HOST_LINK_FRAME_DELIMITER, txCapture[txCaptureLen - 1],
+    "the reply has no delimiter.");
+
+  len = cobsDecode(txCapture, txCaptureLen - 1, frame, sizeof(frame));
+  zassert_equal(HOST_LINK_REPLY_SIZE, len, "the reply has a bad size.");
+  zassert_equal(cmd | HOST_LINK_REPLY_FLAG, frame[0],
+    "the reply has a bad command.");
+
+  return (int8_t)frame[1];
+}
+
+static void hostLinkCaseSetup(void *f)
+{
+  RESET_FAKE(appMsgPushLedSequence);
+  RESET_FAKE(appMsgBeginLedTransaction);
+  RESET_FAKE(appMsgStageLedSequence);
+  RESET_FAKE(appMsgCommitLedTransaction);
+  RESET_FAKE(zephyrThreadCreate);
+#ifdef CONFIG_LED_MNGR_STREAM
+  RESET_FAKE(frameStreamStart);
+  RESET_FAKE(frameStreamStop);
+  RESET_FAKE(frameStreamWrite);
+  RESET_FAKE(frameStreamWriteDelta);
+#endif
+#ifdef CONFIG_LED_MNGR_TIMELINE
+  RESET_FAKE(timelineWrite);
+  RESET_FAKE(timelinePlay);
+  RESET_FAKE(timelineStop);
+#endif
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+  RESET_FAKE(effectVmWrite);
+  RESET_FAKE(effectVmLoad);
+#endif
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+  RESET_FAKE(compositorSetLayer);
+#endif
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+  RESET_FAKE(ledMngrSetTransitionTime);
+#endif
+
+  appMsgPushLedSequence_fake.custom_fake = capturePushedSequence;
+  memset(&pushedSequence, 0x00, sizeof(pushedSequence));
+  memset(&rx, 0x00, sizeof(rx));
+  memset(&stats, 0x00, sizeof(stats));
+  k_sem_reset(&rxFrameSem);
+
+  uartDev = &fakeUart;
+  rxFifoDepth = 1;
+  txCaptureLen = 0;
+  rxEnableCount = 0;
+  fakeIsr = NULL;
+}
+
+ZTEST_SUITE(hostLink_suite, NULL, NULL, hostLinkCaseSetup, NULL, NULL);
+
+/**
+ * @test  hostLinkInit must return -ENODEV when the UART is not ready.
+*/
+ZTEST(hostLink_suite, test_hostLinkInit_UartNotReady)
+{
+  fakeUartState.initialized = false;
+
+  zassert_equal(-ENODEV, hostLinkInit(),
+    "hostLinkInit failed to return the error code.");
+  zassert_equal(0, zephyrThreadCreate_fake.call_count,
+    "hostLinkInit failed to return before creating the thread.");
+  zassert_equal(0, rxEnableCount,
+    "hostLinkInit failed to leave the reception disabled.");
+
+  fakeUartState.initialized = true;
+}
+
+/**
+ * @test  hostLinkInit must set the UART ISR, create the thread and enable
+ *        the reception.
+*/
+ZTEST(hostLink_suite, test_hostLinkInit_Success)
+{
+  zassert_equal(0, hostLinkInit(),
+    "hostLinkInit failed to return the success code.");
+  zassert_equal(uartIsr, fakeIsr, "hostLinkInit failed to set the UART ISR.");
+  zassert_equal(1, zephyrThreadCreate_fake.call_count,
+    "hostLinkInit failed to create the thread.");
+  zassert_equal(&thread, zephyrThreadCreate_fake.arg0_val,
+    "hostLinkInit failed to create the thread.");
+  zassert_equal(1, rxEnableCount,
+    "hostLinkInit failed to enable the reception.");
+}
+
+/**
+ * @test  cobsEncode and cobsDecode must give back the frame, zeros and long
+ *        non-zero runs included.
+*/
+ZTEST(hostLink_suite, test_cobs_RoundTrip)
+{
+  uint8_t data[300];
+  uint8_t encoded[HOST_LINK_COBS_SIZE(sizeof(data))];
+  uint8_t decoded[sizeof(data)];
+  size_t encodedLen;
+
+  for(size_t i = 0; i < sizeof(data); ++i)
+    data[i] = i < 20 ? (i % 5 == 0 ? 0 : i) : 0xa5;
+
+  encodedLen = cobsEncode(data, sizeof(data), encoded);
+
+  zassert_true(encodedLen <= sizeof(encoded),
+    "cobsEncode failed to stay in the encoded size.");
+  for(size_t i = 0; i < encodedLen; ++i)
+    zassert_not_equal(HOST_LINK_FRAME_DELIMITER, encoded[i],
+      "cobsEncode failed to remove the delimiters.");
+
+  zassert_equal(sizeof(data), cobsDecode(encoded, encodedLen, decoded,
+    sizeof(decoded)), "cobsDecode failed to decode the frame.");
+  zassert_mem_equal(data, decoded, sizeof(data),
+    "cobsDecode failed to give back the frame.");
+}
+
+/**
+ * @test  cobsDecode must reject invalid encodings and frames too long for
+ *        the output.
+*/
+ZTEST(hostLink_suite, test_cobsDecode_Invalid)
+{
+  const uint8_t overrun[] = {0x05, 0x01, 0x02};
+  const uint8_t zeroCode[] = {0x02, 0x01, 0x00, 0x01};
+  const uint8_t valid[] = {0x04, 0x01, 0x02, 0x03};
+  uint8_t decoded[2];
+
+  zassert_equal(-EBADMSG, cobsDecode(overrun, sizeof(overrun), decoded,
+    sizeof(decoded)), "cobsDecode failed to reject the block overrun.");
+  zassert_equal(-EBADMSG, cobsDecode(zeroCode, sizeof(zeroCode), decoded,
+    sizeof(decoded)), "cobsDecode failed to reject the zero code.");
+  zassert_equal(-EMSGSIZE, cobsDecode(valid, sizeof(valid), decoded,
+    sizeof(decoded)), "cobsDecode failed to reject the long frame.");
+}
+
+/**
+ * @test  A captured ping frame must be replied with the success status.
+*/
+ZTEST(hostLink_suite, test_hostLink_Ping)
+{
+  feedUart(pingFrame, sizeof(pingFrame));
+
+  zassert_equal(1, k_sem_count_get(&rxFrameSem),
+    "uartIsr failed to hand the frame over.");
+
+  processPendingFrames();
+
+  zassert_equal(sizeof(pingReplyFrame), txCaptureLen,
+    "the ping reply has a bad size.");
+  zassert_mem_equal(pingReplyFrame, txCapture, sizeof(pingReplyFrame),
+    "the ping reply is not the captured one.");
+  zassert_equal(1, stats.frameCount, "the ping frame was not counted.");
+}
+
+/**
+ * @test  A captured LED sequence frame must push its sequence and be replied
+ *        with the push status.
+*/
+ZTEST(hostLink_suite, test_hostLink_Sequence)
+{
+  LedSequence_t expected = {.version = APP_MSG_LED_SEQ_VERSION,
+                            .seqType = SEQ_SOLID_BREATHER,
+                            .sectionId = 1,
+                            .timeUnit = SECONDS,
+                            .timeBase = 3,
+                            .startColor = {.r = 0x12, .g = 0x34, .b = 0x56}};
+
+  rxFifoDepth = 16;
+  feedUart(sequenceFrame, sizeof(sequenceFrame));
+  processPendingFrames();
+
+  zassert_equal(1, appMsgPushLedSequence_fake.call_count,
+    "the LED sequence was not pushed.");
+  zassert_mem_equal(&expected, &pushedSequence, sizeof(expected),
+    "the pushed LED sequence is not the captured one.");
+  zassert_mem_equal(sequenceReplyFrame, txCapture, sizeof(sequenceReplyFrame),
+    "the LED sequence reply is not the captured one.");
+
+  txCaptureLen = 0;
+  appMsgPushLedSequence_fake.return_val = -EINVAL;
+  feedUart(sequenceFrame, sizeof(sequenceFrame));
+  processPendingFrames();
+
+  zassert_equal(-EINVAL, decodeReplyStatus(HOST_LINK_CMD_SEQUENCE),
+    "the LED sequence reply failed to hold the push status.");
+}
+
+/**
+ * @test  A frame with a bad CRC must be counted and dropped without reply.
+*/
+ZTEST(hostLink_suite, test_hostLink_CrcError)
+{
+  uint8_t frame[sizeof(sequenceFrame)];
+
+  memcpy(frame, sequenceFrame, sizeof(frame));
+  frame[8] ^= 0x01;
+
+  feedUart(frame, sizeof(frame));
+  processPendingFrames();
+
+  zassert_equal(1, stats.crcErrorCount, "the CRC error was not counted.");
+  zassert_equal(0, stats.frameCount, "the bad frame was counted as valid.");
+  zassert_equal(0, appMsgPushLedSequence_fake.call_count,
+    "the bad frame was executed.");
+  zassert_equal(0, txCaptureLen, "the bad frame was replied.");
+}
+
+/**
+ * @test  An unknown command must be replied with -ENOTSUP.
+*/
+ZTEST(hostLink_suite, test_hostLink_UnknownCommand)
+{
+  feedUart(unknownFrame, sizeof(unknownFrame));
+  processPendingFrames();
+
+  zassert_equal(-ENOTSUP, decodeReplyStatus(0x7f),
+    "the unknown command reply failed to hold the error code.");
+}
+
+/**
+ * @test  A frame received while every RX buffer is waiting must be counted
+ *        as overrun and dropped, the buffered frames must be processed.
+*/
+ZTEST(hostLink_suite, test_hostLink_Overrun)
+{
+  for(uint8_t i = 0; i < HOST_LINK_RX_BUFFER_COUNT + 1; ++i)
+    feedUart(pingFrame, sizeof(pingFrame));
+
+  zassert_equal(1, stats.overrunCount, "the overrun was not counted.");
+
+  processPendingFrames();
+
+  zassert_equal(HOST_LINK_RX_BUFFER_COUNT, stats.frameCount,
+    "the buffered frames were not processed.");
+  zassert_equal(HOST_LINK_RX_BUFFER_COUNT * sizeof(pingReplyFrame),
+    txCaptureLen, "the buffered frames were not replied.");
+
+  txCaptureLen = 0;
+  feedUart(pingFrame, sizeof(pingFrame));
+  processPendingFrames();
+
+  zassert_equal(sizeof(pingReplyFrame), txCaptureLen,
+    "the reception failed to recover from the overrun.");
+}
+
+/**
+ * @test  A bare delimiter received while every RX buffer is waiting must be
+ *        counted as overrun and leave the buffered frames, each buffered
+ *        frame must be processed once.
+*/
+ZTEST(hostLink_suite, test_hostLink_OverrunDelimiter)
+{
+  const uint8_t delimiters[] = {HOST_LINK_FRAME_DELIMITER,
+                                HOST_LINK_FRAME_DELIMITER};
+
+  for(uint8_t i = 0; i < HOST_LINK_RX_BUFFER_COUNT; ++i)
+    feedUart(pingFrame, sizeof(pingFrame));
+
+  feedUart(delimiters, sizeof(delimiters));
+
+  zassert_equal(HOST_LINK_RX_BUFFER_COUNT, rx.head - rx.tail,
+    "the delimiter handed over a pending buffer.");
+  zassert_equal(sizeof(delimiters), stats.overrunCount,
+    "the overrun was not counted.");
+
+  processPendingFrames();
+
+  zassert_equal(HOST_LINK_RX_BUFFER_COUNT, stats.frameCount,
+    "the buffered frames were not processed once.");
+  zassert_equal(HOST_LINK_RX_BUFFER_COUNT * sizeof(pingReplyFrame),
+    txCaptureLen, "the buffered frames were not replied once.");
+
+  txCaptureLen = 0;
+  feedUart(pingFrame, sizeof(pingFrame));
+  processPendingFrames();
+
+  zassert_equal(sizeof(pingReplyFrame), txCaptureLen,
+    "the reception failed to recover from the overrun.");
+}
+
+/**
+ * @test  A frame too long for the RX buffer must be counted as framing error
+ *        and dropped up to its delimiter, the next frame must be processed.
+*/
+ZTEST(hostLink_suite, test_hostLink_FrameTooLong)
+{
+  const size_t tooLongLen = sizeof(rx.buffers[0].data) + 1;
+  uint8_t stream[sizeof(rx.buffers[0].data) + 2 + sizeof(pingFrame)];
+
+  memset(stream, 0x01, tooLongLen);
+  stream[tooLongLen] = HOST_LINK_FRAME_DELIMITER;
+  memcpy(stream + tooLongLen + 1, pingFrame, sizeof(pingFrame));
+
+  rxFifoDepth = 4;
+  feedUart(stream, sizeof(stream));
+  processPendingFrames();
+
+  zassert_equal(1, stats.framingErrorCount,
+    "the framing error was not counted.");
+  zassert_equal(1, stats.frameCount, "the next frame was not processed.");
+  zassert_mem_equal(pingReplyFrame, txCapture, sizeof(pingReplyFrame),
+    "the next frame was not replied.");
+}
+
+/**
+ * @brief   Build and feed a frame through the fake UART.
+ *
+ * @param cmd         The frame command.
+ * @param payload     The frame payload.
+ * @param len         The payload length.
+ */
+static void feedCommand(uint8_t cmd, const uint8_t *payload, size_t len)
+{
+  uint8_t frame[HOST_LINK_MAX_FRAME_SIZE];
+  uint8_t encoded[HOST_LINK_COBS_SIZE(HOST_LINK_MAX_FRAME_SIZE) + 1];
+  size_t frameLen;
+
+  frame[0] = cmd;
+  memcpy(frame + HOST_LINK_CMD_SIZE, payload, len);
+  frameLen = appendCrc(frame, HOST_LINK_CMD_SIZE + len);
+  frameLen = cobsEncode(frame, frameLen, encoded);
+  encoded[frameLen++] = HOST_LINK_FRAME_DELIMITER;
+
+  rxFifoDepth = 16;
+  feedUart(encoded, frameLen);
+  processPendingFrames();
+}
+
+/**
+ * @test  The LED sequence batch command must stage every sequence and commit
+ *        them at once.
+*/
+ZTEST(hostLink_suite, test_hostLink_SequenceBatch)
+{
+  LedSequence_t seqs[APP_MSG_LED_SECTION_COUNT];
+
+  for(uint8_t i = 0; i < APP_MSG_LED_SECTION_COUNT; ++i)
+    seqs[i] = (LedSequence_t){.version = APP_MSG_LED_SEQ_VERSION,
+                              .seqType = SEQ_SOLID, .sectionId = i};
+
+  appMsgCommitLedTransaction_fake.return_val = -ENOSPC;
+  feedCommand(HOST_LINK_CMD_SEQUENCE_BATCH, (uint8_t *)seqs, sizeof(seqs));
+
+  zassert_equal(1, appMsgBeginLedTransaction_fake.call_count,
+    "the sequence batch command failed to begin the transaction.");
+  zassert_equal(APP_MSG_LED_SECTION_COUNT,
+    appMsgStageLedSequence_fake.call_count,
+    "the sequence batch command failed to stage every sequence.");
+  zassert_equal(1, appMsgCommitLedTransaction_fake.call_count,
+    "the sequence batch command failed to commit the transaction.");
+  zassert_equal(0, appMsgPushLedSequence_fake.call_count,
+    "the sequence batch command pushed a sequence outside the transaction.");
+  zassert_equal(-ENOSPC, decodeReplyStatus(HOST_LINK_CMD_SEQUENCE_BATCH),
+    "the sequence batch command reply failed to hold the commit status.");
+}
+
+/**
+ * @test  The LED sequence batch command must reject a partial sequence and
+ *        commit nothing when a sequence is invalid.
+*/
+ZTEST(hostLink_suite, test_hostLink_SequenceBatch_Invalid)
+{
+  LedSequence_t seqs[APP_MSG_LED_SECTION_COUNT] = {0};
+
+  feedCommand(HOST_LINK_CMD_SEQUENCE_BATCH, (uint8_t *)seqs,
+    sizeof(seqs) - 1);
+  zassert_equal(0, appMsgBeginLedTransaction_fake.call_count,
+    "the sequence batch command began a partial batch.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_SEQUENCE_BATCH),
+    "the sequence batch command failed to reject the partial sequence.");
+
+  txCaptureLen = 0;
+  appMsgStageLedSequence_fake.return_val = -EPROTONOSUPPORT;
+  feedCommand(HOST_LINK_CMD_SEQUENCE_BATCH, (uint8_t *)seqs, sizeof(seqs));
+  zassert_equal(1, appMsgStageLedSequence_fake.call_count,
+    "the sequence batch command failed to stop on the invalid sequence.");
+  zassert_equal(0, appMsgCommitLedTransaction_fake.call_count,
+    "the sequence batch command committed an invalid batch.");
+  zassert_equal(-EPROTONOSUPPORT,
+    decodeReplyStatus(HOST_LINK_CMD_SEQUENCE_BATCH),
+    "the sequence batch command reply failed to hold the staging status.");
+}
+
+#ifdef CONFIG_LED_MNGR_STREAM
+/**
+ * @test  The frame stream command must start and stop the stream, and
+ *        reject the other payloads.
+*/
+ZTEST(hostLink_suite, test_hostLink_Stream)
+{
+  const uint8_t start = 1;
+  const uint8_t stop = 0;
+  const uint8_t invalid[] = {2, 1};
+
+  feedCommand(HOST_LINK_CMD_STREAM, &start, sizeof(start));
+  zassert_equal(1, frameStreamStart_fake.call_count,
+    "the stream command failed to start the stream.");
+  zassert_equal(0, decodeReplyStatus(HOST_LINK_CMD_STREAM),
+    "the stream command reply failed to hold the success code.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_STREAM, &stop, sizeof(stop));
+  zassert_equal(1, frameStreamStop_fake.call_count,
+    "the stream command failed to stop the stream.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_STREAM, invalid, 1);
+  zassert_equal(-EINVAL, decodeReplyStatus(HOST_LINK_CMD_STREAM),
+    "the stream command failed to reject the invalid state.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_STREAM, invalid, sizeof(invalid));
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_STREAM),
+    "the stream command failed to reject the payload size.");
+}
+
+/**
+ * @test  The stream frame chunk command must write its pixels in the stream
+ *        and reply with the write status.
+*/
+ZTEST(hostLink_suite, test_hostLink_Frame)
+{
+  const uint8_t chunk[] = {0x09, 0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60};
+
+  frameStreamWrite_fake.return_val = -ENOSPC;
+  feedCommand(HOST_LINK_CMD_FRAME, chunk, sizeof(chunk));
+
+  zassert_equal(1, frameStreamWrite_fake.call_count,
+    "the frame command failed to write the pixels.");
+  zassert_equal(9, frameStreamWrite_fake.arg0_val,
+    "the frame command failed to write the pixels at their LED.");
+  zassert_equal(2, frameStreamWrite_fake.arg2_val,
+    "the frame command failed to write every pixel.");
+  zassert_equal(-ENOSPC, decodeReplyStatus(HOST_LINK_CMD_FRAME),
+    "the frame command reply failed to hold the write status.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_FRAME, chunk, sizeof(chunk) - 1);
+  zassert_equal(1, frameStreamWrite_fake.call_count,
+    "the frame command wrote a partial pixel.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_FRAME),
+    "the frame command failed to reject the partial pixel.");
+}
+
+/**
+ * @test  The stream frame delta command must decode its operations in the
+ *        stream and reply with the decoding status.
+*/
+ZTEST(hostLink_suite, test_hostLink_FrameDelta)
+{
+  const uint8_t chunk[] = {HOST_LINK_DELTA_LAST_FLAG, 0x02, 0x01,
+                           FRAME_STREAM_OP_RUN | 3, 0x10, 0x20, 0x30};
+
+  frameStreamWriteDelta_fake.return_val = -EBADMSG;
+  feedCommand(HOST_LINK_CMD_FRAME_DELTA, chunk, sizeof(chunk));
+
+  zassert_equal(1, frameStreamWriteDelta_fake.call_count,
+    "the frame delta command failed to decode the operations.");
+  zassert_equal(0x0102, frameStreamWriteDelta_fake.arg0_val,
+    "the frame delta command failed to decode from the first LED.");
+  zassert_equal(sizeof(chunk) - 3, frameStreamWriteDelta_fake.arg2_val,
+    "the frame delta command failed to pass every operation.");
+  zassert_true(frameStreamWriteDelta_fake.arg3_val,
+    "the frame delta command failed to pass the last write flag.");
+  zassert_equal(-EBADMSG, decodeReplyStatus(HOST_LINK_CMD_FRAME_DELTA),
+    "the frame delta command reply failed to hold the decoding status.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_FRAME_DELTA, chunk, 2);
+  zassert_equal(1, frameStreamWriteDelta_fake.call_count,
+    "the frame delta command decoded a truncated header.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_FRAME_DELTA),
+    "the frame delta command failed to reject the truncated header.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_TIMELINE
+/**
+ * @test  The timeline show command must play and stop the show, and reject
+ *        the other payloads.
+*/
+ZTEST(hostLink_suite, test_hostLink_Timeline)
+{
+  const uint8_t play = 1;
+  const uint8_t stop = 0;
+  const uint8_t invalid[] = {2, 1};
+
+  timelinePlay_fake.return_val = -EBADMSG;
+  feedCommand(HOST_LINK_CMD_TIMELINE, &play, sizeof(play));
+  zassert_equal(1, timelinePlay_fake.call_count,
+    "the timeline command failed to play the show.");
+  zassert_equal(-EBADMSG, decodeReplyStatus(HOST_LINK_CMD_TIMELINE),
+    "the timeline command reply failed to hold the play status.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_TIMELINE, &stop, sizeof(stop));
+  zassert_equal(1, timelineStop_fake.call_count,
+    "the timeline command failed to stop the show.");
+  zassert_equal(0, decodeReplyStatus(HOST_LINK_CMD_TIMELINE),
+    "the timeline command reply failed to hold the success code.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_TIMELINE, invalid, 1);
+  zassert_equal(-EINVAL, decodeReplyStatus(HOST_LINK_CMD_TIMELINE),
+    "the timeline command failed to reject the invalid state.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_TIMELINE, invalid, sizeof(invalid));
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_TIMELINE),
+    "the timeline command failed to reject the payload size.");
+}
+
+/**
+ * @test  The timeline show chunk command must write the chunk at its offset
+ *        and reply with the write status.
+*/
+ZTEST(hostLink_suite, test_hostLink_TimelineWrite)
+{
+  const uint8_t chunk[] = {0x10, 0x01, 0xaa, 0xbb, 0xcc};
+
+  timelineWrite_fake.return_val = -EBUSY;
+  feedCommand(HOST_LINK_CMD_TIMELINE_WRITE, chunk, sizeof(chunk));
+
+  zassert_equal(1, timelineWrite_fake.call_count,
+    "the timeline chunk command failed to write the chunk.");
+  zassert_equal(0x0110, timelineWrite_fake.arg0_val,
+    "the timeline chunk command failed to write at the offset.");
+  zassert_equal(sizeof(chunk) - 2, timelineWrite_fake.arg2_val,
+    "the timeline chunk command failed to write every byte.");
+  zassert_equal(-EBUSY, decodeReplyStatus(HOST_LINK_CMD_TIMELINE_WRITE),
+    "the timeline chunk command reply failed to hold the write status.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_TIMELINE_WRITE, chunk, 2);
+  zassert_equal(1, timelineWrite_fake.call_count,
+    "the timeline chunk command wrote an empty chunk.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_TIMELINE_WRITE),
+    "the timeline chunk command failed to reject the empty chunk.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+/**
+ * @test  The effect program chunk command must write the chunk at its offset
+ *        and reply with the write status.
+*/
+ZTEST(hostLink_suite, test_hostLink_ProgramWrite)
+{
+  const uint8_t chunk[] = {0x08, 0x00, 0x0c, 0x00, 0x00, 0x00};
+
+  effectVmWrite_fake.return_val = -EINVAL;
+  feedCommand(HOST_LINK_CMD_PROGRAM_WRITE, chunk, sizeof(chunk));
+
+  zassert_equal(1, effectVmWrite_fake.call_count,
+    "the program chunk command failed to write the chunk.");
+  zassert_equal(0x0008, effectVmWrite_fake.arg0_val,
+    "the program chunk command failed to write at the offset.");
+  zassert_equal(sizeof(chunk) - 2, effectVmWrite_fake.arg2_val,
+    "the program chunk command failed to write every byte.");
+  zassert_equal(-EINVAL, decodeReplyStatus(HOST_LINK_CMD_PROGRAM_WRITE),
+    "the program chunk command reply failed to hold the write status.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_PROGRAM_WRITE, chunk, 2);
+  zassert_equal(1, effectVmWrite_fake.call_count,
+    "the program chunk command wrote an empty chunk.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_PROGRAM_WRITE),
+    "the program chunk command failed to reject the empty chunk.");
+}
+
+/**
+ * @test  The effect program load command must load the program length and
+ *        reply with the load status.
+*/
+ZTEST(hostLink_suite, test_hostLink_ProgramLoad)
+{
+  const uint8_t length[] = {0x24, 0x01, 0x00};
+
+  effectVmLoad_fake.return_val = -ENOEXEC;
+  feedCommand(HOST_LINK_CMD_PROGRAM_LOAD, length, 2);
+
+  zassert_equal(1, effectVmLoad_fake.call_count,
+    "the program load command failed to load the program.");
+  zassert_equal(0x0124, effectVmLoad_fake.arg0_val,
+    "the program load command failed to load the program length.");
+  zassert_equal(-ENOEXEC, decodeReplyStatus(HOST_LINK_CMD_PROGRAM_LOAD),
+    "the program load command reply failed to hold the load status.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_PROGRAM_LOAD, length, sizeof(length));
+  zassert_equal(1, effectVmLoad_fake.call_count,
+    "the program load command loaded an invalid payload.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_PROGRAM_LOAD),
+    "the program load command failed to reject the payload size.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+/**
+ * @brief The test set layer.
+*/
+static CompositorLayer_t setLayer;
+
+/**
+ * @brief   The set layer custom fake, capturing the layer.
+ *
+ * @param layer       The layer.
+ *
+ * @return  Always 0.
+ */
+static int captureSetLayer(const CompositorLayer_t *layer)
+{
+  setLayer = *layer;
+
+  return 0;
+}
+
+/**
+ * @test  The overlay layer command must set the layer and reply with the
+ *        set status.
+*/
+ZTEST(hostLink_suite, test_hostLink_Layer)
+{
+  CompositorLayer_t layer = {
+    .layerId = 1,
+    .alpha = 0x80,
+    .blendMode = COMPOSITOR_BLEND_MAX,
+    .seq = {.version = APP_MSG_LED_SEQ_VERSION, .seqType = SEQ_FADE_CHASER,
+            .sectionId = 1, .timeBase = 0x0203},
+  };
+
+  compositorSetLayer_fake.custom_fake = captureSetLayer;
+  feedCommand(HOST_LINK_CMD_LAYER, (const uint8_t *)&layer, sizeof(layer));
+
+  zassert_equal(1, compositorSetLayer_fake.call_count,
+    "the layer command failed to set the layer.");
+  zassert_mem_equal(&layer, &setLayer, sizeof(layer),
+    "the layer command failed to decode the layer.");
+  zassert_equal(0, decodeReplyStatus(HOST_LINK_CMD_LAYER),
+    "the layer command reply failed to hold the success code.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_LAYER, (const uint8_t *)&layer,
+    sizeof(layer) - 1);
+  zassert_equal(1, compositorSetLayer_fake.call_count,
+    "the layer command set a truncated layer.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_LAYER),
+    "the layer command failed to reject the payload size.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+/**
+ * @test  The transition time command must set the little-endian transition
+ *        time and reject a bad payload size.
+*/
+ZTEST(hostLink_suite, test_hostLink_Transition)
+{
+  uint8_t timeMs[] = {0xf4, 0x01};
+
+  feedCommand(HOST_LINK_CMD_TRANSITION, timeMs, sizeof(timeMs));
+
+  zassert_equal(1, ledMngrSetTransitionTime_fake.call_count,
+    "the transition command failed to set the transition time.");
+  zassert_equal(500, ledMngrSetTransitionTime_fake.arg0_val,
+    "the transition command failed to decode the transition time.");
+  zassert_equal(0, decodeReplyStatus(HOST_LINK_CMD_TRANSITION),
+    "the transition command reply failed to hold the success code.");
+
+  txCaptureLen = 0;
+  feedCommand(HOST_LINK_CMD_TRANSITION, timeMs, sizeof(timeMs) - 1);
+  zassert_equal(1, ledMngrSetTransitionTime_fake.call_count,
+    "the transition command set a truncated transition time.");
+  zassert_equal(-EMSGSIZE, decodeReplyStatus(HOST_LINK_CMD_TRANSITION),
+    "the transition command failed to reject the payload size.");
+}
+#endif
+
+/** @} */
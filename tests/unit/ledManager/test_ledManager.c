@@ -22,32 +22,183 @@
 #include "ledManager.c"
 
 #include "appMsg.h"
+#include "colorManager.h"
+#include "compositor.h"
+#include "effectVm.h"
+#include "frameScheduler.h"
+#include "frameStream.h"
+#include "powerLimiter.h"
 #include "sequenceManager.h"
+#include "timeline.h"
+#include "ws2812Encoder.h"
 #include "zephyrCommon.h"
 #include "zephyrLedStrip.h"
 #include "zephyrThread.h"
 
 DEFINE_FFF_GLOBALS;
 
+FAKE_VALUE_FUNC(int, appMsgWaitLedSequence, k_timeout_t);
 FAKE_VALUE_FUNC(int, appMsgPopLedSequence, LedSequence_t*);
-FAKE_VOID_FUNC(seqMngrUpdateSolidFrame, Color_t*, ZephyrRgbPixel_t*, size_t);
-FAKE_VOID_FUNC(seqMngrUpdateSingleBreatherFrame, Color_t*, uint8_t, bool,
-  ZephyrRgbPixel_t*, size_t);
-FAKE_VOID_FUNC(seqMngrUpdateFadeChaserFrame, Color_t*, bool, bool,
-  ZephyrRgbPixel_t*, size_t);
-FAKE_VOID_FUNC(seqMngrUpdateColorRangeFrame, Color_t*, Color_t*, bool,
-  ZephyrRgbPixel_t*, size_t);
-FAKE_VOID_FUNC(seqMngrUpdateColorRangeChaserFrame, Color_t*, Color_t*, bool,
+FAKE_VALUE_FUNC(bool, seqMngrIsAnimated, SequenceContext_t*);
+FAKE_VALUE_FUNC(bool, seqMngrUpdateSolidFrame, SequenceContext_t*, Color_t*,
   bool, ZephyrRgbPixel_t*, size_t);
+FAKE_VOID_FUNC(seqMngrSetCycle, SequenceContext_t*, uint32_t, ZephyrTimeUnit_t,
+  uint32_t);
+FAKE_VALUE_FUNC(bool, seqMngrUpdateSingleBreatherFrame, SequenceContext_t*,
+  Color_t*, bool, ZephyrRgbPixel_t*, size_t);
+FAKE_VALUE_FUNC(bool, seqMngrUpdateFadeChaserFrame, SequenceContext_t*,
+  Color_t*, bool, bool, ZephyrRgbPixel_t*, size_t);
+FAKE_VALUE_FUNC(bool, seqMngrUpdateColorRangeFrame, SequenceContext_t*,
+  Color_t*, Color_t*, bool, ZephyrRgbPixel_t*, size_t);
+FAKE_VALUE_FUNC(bool, seqMngrUpdateColorRangeChaserFrame, SequenceContext_t*,
+  Color_t*, Color_t*, bool, bool, ZephyrRgbPixel_t*, size_t);
 FAKE_VALUE_FUNC(int, zephyrLedStripInit, ZephyrLedStrip_t*, const uint32_t);
 FAKE_VOID_FUNC(zephyrThreadCreate, ZephyrThread_t*, char*, uint32_t,
   ZephyrTimeUnit_t);
-FAKE_VALUE_FUNC(uint32_t, zephyrThreadSleep, uint32_t, ZephyrTimeUnit_t);
+FAKE_VALUE_FUNC(int, frameSchedInit, uint32_t);
+FAKE_VALUE_FUNC(k_timeout_t, frameSchedGetNextDeadline);
+FAKE_VOID_FUNC(frameSchedStartFrame);
+FAKE_VOID_FUNC(frameSchedRestart);
+FAKE_VALUE_FUNC(uint32_t, frameSchedGetFps);
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+FAKE_VALUE_FUNC(int, ws2812EncInit);
+FAKE_VOID_FUNC(ws2812EncEncode, const ZephyrRgbPixel_t*, size_t, uint32_t*);
+FAKE_VALUE_FUNC(int, ws2812EncSend, const uint32_t*, size_t);
+#endif
+#ifdef CONFIG_LED_MNGR_STREAM
+FAKE_VALUE_FUNC(bool, frameStreamIsActive);
+FAKE_VALUE_FUNC(int, frameStreamLatch, ZephyrRgbPixel_t*);
+FAKE_VOID_FUNC(frameStreamFlush);
+#endif
+#ifdef CONFIG_LED_MNGR_TIMELINE
+FAKE_VALUE_FUNC(bool, timelineIsActive);
+FAKE_VOID_FUNC(timelineRewind, uint32_t);
+FAKE_VALUE_FUNC(bool, timelineAdvance);
+FAKE_VALUE_FUNC(bool, timelineHasTrack, uint8_t);
+FAKE_VALUE_FUNC(bool, timelineRender, uint8_t, ZephyrRgbPixel_t*, size_t);
+FAKE_VOID_FUNC(timelineRelease);
+#endif
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+FAKE_VALUE_FUNC(bool, effectVmSync);
+FAKE_VALUE_FUNC(bool, effectVmIsRunning, EffectVmCtx_t*);
+FAKE_VALUE_FUNC(bool, effectVmRunFrame, EffectVmCtx_t*, Color_t*, Color_t*,
+  bool, ZephyrRgbPixel_t*, size_t);
+#endif
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+FAKE_VALUE_FUNC(int, compositorPopLayer, CompositorLayer_t*);
+FAKE_VOID_FUNC(compositorBlend, uint8_t, uint8_t, const ZephyrRgbPixel_t*,
+  ZephyrRgbPixel_t*, size_t);
+#endif
+#ifdef CONFIG_LED_MNGR_GAMMA
+FAKE_VOID_FUNC(colorMngrApplyGamma, const ZephyrRgbPixel_t*, ZephyrRgbPixel_t*,
+  size_t);
+#endif
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+FAKE_VALUE_FUNC(uint16_t, powerLimiterUpdate, const ZephyrRgbPixel_t*, size_t);
+FAKE_VOID_FUNC(powerLimiterApply, uint16_t, const ZephyrRgbPixel_t*,
+  ZephyrRgbPixel_t*, size_t);
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+FAKE_VOID_FUNC(ws2812EncSetScale, uint16_t);
+#endif
+#endif
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+FAKE_VOID_FUNC(colorMngrApplyLerp, uint32_t, const ZephyrRgbPixel_t*,
+  ZephyrRgbPixel_t*, size_t);
+#endif
+
+/**
+ * @brief The test pixel count.
+*/
+#define TEST_PIXEL_COUNT                18
+
+/**
+ * @brief The test pixel buffer.
+*/
+static ZephyrRgbPixel_t testPixels[TEST_PIXEL_COUNT];
 
 static void ledMngrCaseSetup(void *f)
 {
   RESET_FAKE(zephyrLedStripInit);
   RESET_FAKE(zephyrThreadCreate);
+  RESET_FAKE(frameSchedInit);
+  RESET_FAKE(frameSchedGetFps);
+  RESET_FAKE(frameSchedGetNextDeadline);
+  RESET_FAKE(frameSchedStartFrame);
+  RESET_FAKE(frameSchedRestart);
+  RESET_FAKE(appMsgWaitLedSequence);
+  RESET_FAKE(appMsgPopLedSequence);
+  RESET_FAKE(seqMngrIsAnimated);
+  RESET_FAKE(seqMngrSetCycle);
+  RESET_FAKE(seqMngrUpdateSolidFrame);
+  RESET_FAKE(seqMngrUpdateSingleBreatherFrame);
+  RESET_FAKE(seqMngrUpdateFadeChaserFrame);
+  RESET_FAKE(seqMngrUpdateColorRangeFrame);
+  RESET_FAKE(seqMngrUpdateColorRangeChaserFrame);
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+  RESET_FAKE(ws2812EncInit);
+  RESET_FAKE(ws2812EncEncode);
+  RESET_FAKE(ws2812EncSend);
+#endif
+#ifdef CONFIG_LED_MNGR_STREAM
+  RESET_FAKE(frameStreamIsActive);
+  RESET_FAKE(frameStreamLatch);
+  RESET_FAKE(frameStreamFlush);
+  isStreaming = false;
+#endif
+#ifdef CONFIG_LED_MNGR_TIMELINE
+  RESET_FAKE(timelineIsActive);
+  RESET_FAKE(timelineRewind);
+  RESET_FAKE(timelineAdvance);
+  RESET_FAKE(timelineHasTrack);
+  RESET_FAKE(timelineRender);
+  RESET_FAKE(timelineRelease);
+  isShowPlaying = false;
+#endif
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+  RESET_FAKE(effectVmSync);
+  RESET_FAKE(effectVmIsRunning);
+  RESET_FAKE(effectVmRunFrame);
+#endif
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+  RESET_FAKE(compositorPopLayer);
+  RESET_FAKE(compositorBlend);
+  compositorPopLayer_fake.return_val = -ENOMSG;
+  memset(layers, 0x00, sizeof(layers));
+  memset(layerPixels, 0x00, sizeof(layerPixels));
+#endif
+#ifdef CONFIG_LED_MNGR_GAMMA
+  RESET_FAKE(colorMngrApplyGamma);
+#endif
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+  RESET_FAKE(powerLimiterUpdate);
+  RESET_FAKE(powerLimiterApply);
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+  RESET_FAKE(ws2812EncSetScale);
+#endif
+  powerLimiterUpdate_fake.return_val = POWER_LIMITER_SCALE_ONE;
+  powerScale = POWER_LIMITER_SCALE_ONE;
+#endif
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+  RESET_FAKE(colorMngrApplyLerp);
+  memset(fadeFrames, 0x00, sizeof(fadeFrames));
+  transitionMs = CONFIG_LED_MNGR_CROSSFADE_TIME;
+#endif
+
+  ledStrip.rgbPixels = testPixels;
+  backPixels = testPixels;
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+  frontPixels = framePixels;
+  k_sem_reset(&txReadySem);
+  k_sem_reset(&txDoneSem);
+  k_sem_give(&txDoneSem);
+#endif
+  ledStrip.pixelCount = TEST_PIXEL_COUNT;
+  memset(sequences, 0x00, sizeof(sequences));
+  memset(dirties, 0x00, sizeof(dirties));
+  memset(resets, 0x00, sizeof(resets));
+  isIdle = false;
+
+  appMsgPopLedSequence_fake.return_val = -ENOMSG;
 }
 
 ZTEST_SUITE(ledMngr_suite, NULL, NULL, ledMngrCaseSetup, NULL, NULL);
@@ -72,6 +223,55 @@ ZTEST(ledMngr_suite, test_ledMngrInit_LedStripInitFail)
     "ledMngrInit failed to initalize the LED strip.");
 }
 
+/**
+ * @test  ledMngrInit must return the error code if the frame scheduler
+ *        initialization fails.
+*/
+ZTEST(ledMngr_suite, test_ledMngrInit_FrameSchedInitFail)
+{
+  int failRet = -EINVAL;
+
+  frameSchedInit_fake.return_val = failRet;
+
+  zassert_equal(failRet, ledMngrInit(),
+    "ledMngrInit failed to return the error code.");
+  zassert_equal(1, frameSchedInit_fake.call_count,
+    "ledMngrInit failed to initialize the frame scheduler.");
+  zassert_equal(CONFIG_LED_MNGR_TARGET_FPS, frameSchedInit_fake.arg0_val,
+    "ledMngrInit failed to initialize the frame scheduler.");
+  zassert_equal(0, zephyrThreadCreate_fake.call_count,
+    "ledMngrInit failed to return before creating the thread.");
+}
+
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+/**
+ * @test  ledMngrInit must return the error code if the WS2812 encoder
+ *        initialization fails.
+*/
+ZTEST(ledMngr_suite, test_ledMngrInit_EncoderInitFail)
+{
+  int failRet = -ENODEV;
+
+  ws2812EncInit_fake.return_val = failRet;
+
+  zassert_equal(failRet, ledMngrInit(),
+    "ledMngrInit failed to return the error code.");
+  zassert_equal(1, ws2812EncInit_fake.call_count,
+    "ledMngrInit failed to initialize the WS2812 encoder.");
+  zassert_equal(0, zephyrThreadCreate_fake.call_count,
+    "ledMngrInit failed to return before creating the thread.");
+}
+#endif
+
+/**
+ * @brief The count of thread created by the LED manager.
+*/
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+#define TEST_THREAD_COUNT               2
+#else
+#define TEST_THREAD_COUNT               1
+#endif
+
 /**
  * @test  ledMngrInit must create the thread and return the success code when
  *        the LED strip initialization succeeds.
@@ -90,8 +290,16 @@ ZTEST(ledMngr_suite, test_ledMngrInit_CreateThread)
     "ledMngrInit failed to initalize the LED strip.");
   zassert_equal(ledStrip.pixelCount, zephyrLedStripInit_fake.arg1_val,
     "ledMngrInit failed to initalize the LED strip.");
-  zassert_equal(1, zephyrThreadCreate_fake.call_count,
+  zassert_equal(TEST_THREAD_COUNT, zephyrThreadCreate_fake.call_count,
     "ledMngrInit failed to create and start the thread.");
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+  zassert_equal(&txThread, zephyrThreadCreate_fake.arg0_history[0],
+    "ledMngrInit failed to create and start the transfer thread.");
+  zassert_equal(framePixels, frontPixels,
+    "ledMngrInit failed to set the front buffer.");
+#endif
+  zassert_equal(testPixels, backPixels,
+    "ledMngrInit failed to set the back buffer.");
   zassert_equal(&thread, zephyrThreadCreate_fake.arg0_val,
     "ledMngrInit failed to create and start the thread.");
   zassert_equal(LED_MNGR_THREAD_NAME, zephyrThreadCreate_fake.arg1_val,
@@ -102,4 +310,1098 @@ ZTEST(ledMngr_suite, test_ledMngrInit_CreateThread)
     "ledMngrInit failed to create and start the thread.");
 }
 
+/**
+ * @test  ledMngrGetSectionCount must return the LED strip section count.
+*/
+ZTEST(ledMngr_suite, test_ledMngrGetSectionCount_Count)
+{
+  zassert_equal(ARRAY_SIZE(sections), ledMngrGetSectionCount(),
+    "ledMngrGetSectionCount failed to return the section count.");
+}
+
+/**
+ * @test  ledMngrGetSectionId must return the ID of the section matching the
+ *        given name.
+*/
+ZTEST(ledMngr_suite, test_ledMngrGetSectionId_Found)
+{
+  for(uint8_t i = 0; i < ARRAY_SIZE(sections); ++i)
+  {
+    zassert_equal(i, ledMngrGetSectionId(sections[i].name),
+      "ledMngrGetSectionId failed to return the section ID.");
+  }
+}
+
+/**
+ * @test  ledMngrGetSectionId must return -ENOENT when no section matches the
+ *        given name.
+*/
+ZTEST(ledMngr_suite, test_ledMngrGetSectionId_NotFound)
+{
+  zassert_equal(-ENOENT, ledMngrGetSectionId("unknown"),
+    "ledMngrGetSectionId failed to return the error code.");
+}
+
+/**
+ * @test  renderSection must render the section sequence into the section
+ *        pixels only.
+*/
+ZTEST(ledMngr_suite, test_renderSection_RenderSectionPixels)
+{
+  size_t pixelCnt;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(sections); ++i)
+  {
+    RESET_FAKE(seqMngrUpdateSolidFrame);
+    RESET_FAKE(seqMngrSetCycle);
+
+    pixelCnt = sections[i].lastLed - sections[i].firstLed + 1;
+    sequences[i].seqType = SEQ_SOLID;
+    sequences[i].timeBase = APP_MSG_TIME_FOREVER;
+    sequences[i].startColor = (PackedColor_t){.r = 0x12, .g = 0x34, .b = i};
+
+    zassert_equal(0, renderSection(i, true),
+      "renderSection failed to return the success code.");
+    zassert_equal(1, seqMngrUpdateSolidFrame_fake.call_count,
+      "renderSection failed to render the section sequence.");
+    zassert_equal(seqCtxs + i, seqMngrUpdateSolidFrame_fake.arg0_val,
+      "renderSection failed to use the section context.");
+    zassert_equal(startColors + i,
+      seqMngrUpdateSolidFrame_fake.arg1_val,
+      "renderSection failed to render the section sequence.");
+    zassert_equal(0x123400 | i, startColors[i].hexColor,
+      "renderSection failed to unpack the sequence color.");
+    zassert_equal(ZEPHYR_TIME_FOREVER, seqMngrSetCycle_fake.arg1_val,
+      "renderSection failed to convert the sequence time base.");
+    zassert_true(seqMngrUpdateSolidFrame_fake.arg2_val,
+      "renderSection failed to reset the section sequence.");
+    zassert_equal(testPixels + sections[i].firstLed,
+      seqMngrUpdateSolidFrame_fake.arg3_val,
+      "renderSection failed to render into the section pixels.");
+    zassert_equal(pixelCnt, seqMngrUpdateSolidFrame_fake.arg4_val,
+      "renderSection failed to render into the section pixels.");
+  }
+}
+
+/**
+ * @test  renderSection must set the section sequence cycle from the sequence
+ *        length and the frame rate on reset only.
+*/
+ZTEST(ledMngr_suite, test_renderSection_SetCycleOnReset)
+{
+  uint32_t fps = 30;
+
+  frameSchedGetFps_fake.return_val = fps;
+  sequences[1].seqType = SEQ_SOLID_BREATHER;
+  sequences[1].timeBase = 5;
+  sequences[1].timeUnit = SECONDS;
+
+  zassert_equal(0, renderSection(1, true),
+    "renderSection failed to return the success code.");
+  zassert_equal(1, seqMngrSetCycle_fake.call_count,
+    "renderSection failed to set the sequence cycle.");
+  zassert_equal(seqCtxs + 1, seqMngrSetCycle_fake.arg0_val,
+    "renderSection failed to use the section context.");
+  zassert_equal(5, seqMngrSetCycle_fake.arg1_val,
+    "renderSection failed to use the sequence length.");
+  zassert_equal(sequences[1].timeUnit, seqMngrSetCycle_fake.arg2_val,
+    "renderSection failed to use the sequence time unit.");
+  zassert_equal(fps, seqMngrSetCycle_fake.arg3_val,
+    "renderSection failed to use the frame rate.");
+  zassert_equal(1, seqMngrUpdateSingleBreatherFrame_fake.call_count,
+    "renderSection failed to render the section sequence.");
+  zassert_true(seqMngrUpdateSingleBreatherFrame_fake.arg2_val,
+    "renderSection failed to reset the section sequence.");
+
+  zassert_equal(0, renderSection(1, false),
+    "renderSection failed to return the success code.");
+  zassert_equal(1, seqMngrSetCycle_fake.call_count,
+    "renderSection failed to keep the sequence cycle.");
+}
+
+/**
+ * @test  renderSection must set the section dirty flag only when the section
+ *        pixels were updated and keep it until the strip is refreshed.
+*/
+ZTEST(ledMngr_suite, test_renderSection_DirtyFlag)
+{
+  sequences[0].seqType = SEQ_FADE_CHASER;
+  sequences[1].seqType = SEQ_FADE_CHASER;
+
+  seqMngrUpdateFadeChaserFrame_fake.return_val = false;
+  zassert_equal(0, renderSection(0, false),
+    "renderSection failed to return the success code.");
+  zassert_false(dirties[0],
+    "renderSection failed to keep the section clean.");
+
+  seqMngrUpdateFadeChaserFrame_fake.return_val = true;
+  zassert_equal(0, renderSection(0, false),
+    "renderSection failed to return the success code.");
+  zassert_true(dirties[0],
+    "renderSection failed to set the section dirty flag.");
+  zassert_false(dirties[1],
+    "renderSection failed to keep the other section clean.");
+
+  seqMngrUpdateFadeChaserFrame_fake.return_val = false;
+  zassert_equal(0, renderSection(0, false),
+    "renderSection failed to return the success code.");
+  zassert_true(dirties[0],
+    "renderSection failed to keep the section dirty flag.");
+}
+
+/**
+ * @test  renderSection must return -ENOTSUP when the section sequence type
+ *        is not supported.
+*/
+ZTEST(ledMngr_suite, test_renderSection_UnsupportedSequence)
+{
+  sequences[0].seqType = SEQ_COUNT;
+
+  zassert_equal(-ENOTSUP, renderSection(0, true),
+    "renderSection failed to return the error code.");
+}
+
+/**
+ * @brief The test pushed sequence section ID.
+*/
+#define TEST_PUSHED_SECTION_ID          1
+
+/**
+ * @brief The tick count when the pushed sequence was pushed.
+*/
+static int64_t pushTicks;
+
+/**
+ * @brief The tick count of the pushed sequence first frame.
+*/
+static int64_t firstFrameTicks;
+
+/**
+ * @brief   The message pop custom fake, popping one solid sequence for the
+ *          test section.
+ *
+ * @param seq         The output sequence.
+ *
+ * @return  0 for the first pop, -ENOMSG after.
+ */
+static int popOneSequence(LedSequence_t *seq)
+{
+  if(appMsgPopLedSequence_fake.call_count > 1)
+    return -ENOMSG;
+
+  memset(seq, 0x00, sizeof(*seq));
+  seq->seqType = SEQ_SOLID;
+  seq->version = APP_MSG_LED_SEQ_VERSION;
+  seq->timeBase = APP_MSG_TIME_FOREVER;
+  seq->timeUnit = SECONDS;
+  seq->sectionId = TEST_PUSHED_SECTION_ID;
+
+  return 0;
+}
+
+/**
+ * @brief   The message wait custom fake, waking up on a sequence pushed
+ *          before the frame deadline.
+ *
+ * @param timeout     The wait timeout.
+ *
+ * @return  0.
+ */
+static int wakeOnPush(k_timeout_t timeout)
+{
+  pushTicks = k_uptime_ticks();
+
+  return 0;
+}
+
+/**
+ * @brief   The solid frame custom fake, recording the first frame tick count.
+ *
+ * @return  False, the test strip is not refreshed.
+ */
+static bool recordFirstFrame(SequenceContext_t *ctx, Color_t *color,
+                             bool reset, ZephyrRgbPixel_t *pixels,
+                             size_t pixelCnt)
+{
+  if(reset)
+    firstFrameTicks = k_uptime_ticks();
+
+  return false;
+}
+
+/**
+ * @test  runCycle must render a pushed sequence in the cycle it wakes up in,
+ *        without waiting for the frame deadline.
+*/
+ZTEST(ledMngr_suite, test_runCycle_PushLatency)
+{
+  k_timeout_t deadline = K_TIMEOUT_ABS_TICKS(k_uptime_ticks() +
+    k_ms_to_ticks_ceil32(MSEC_PER_SEC / CONFIG_LED_MNGR_TARGET_FPS));
+
+  frameSchedGetNextDeadline_fake.return_val = deadline;
+  appMsgWaitLedSequence_fake.custom_fake = wakeOnPush;
+  appMsgPopLedSequence_fake.custom_fake = popOneSequence;
+  seqMngrUpdateSolidFrame_fake.custom_fake = recordFirstFrame;
+  firstFrameTicks = -1;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_true(K_TIMEOUT_EQ(deadline, appMsgWaitLedSequence_fake.arg0_val),
+    "runCycle failed to wait for the frame deadline.");
+  zassert_equal(0, frameSchedStartFrame_fake.call_count,
+    "runCycle failed to render the pushed sequence out of frame.");
+  zassert_equal(1, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to render the pushed sequence only.");
+  zassert_equal(seqCtxs + TEST_PUSHED_SECTION_ID,
+    seqMngrUpdateSolidFrame_fake.arg0_val,
+    "runCycle failed to render the pushed sequence section.");
+  zassert_true(firstFrameTicks >= pushTicks,
+    "runCycle failed to render the pushed sequence.");
+  zassert_true(firstFrameTicks - pushTicks <
+    k_ms_to_ticks_ceil32(MSEC_PER_SEC / CONFIG_LED_MNGR_TARGET_FPS),
+    "runCycle failed to render the pushed sequence within one frame.");
+}
+
+/**
+ * @test  runCycle must render the animated sections on the frame deadline.
+*/
+ZTEST(ledMngr_suite, test_runCycle_FrameDue)
+{
+  sequences[0].seqType = SEQ_FADE_CHASER;
+  sequences[1].seqType = SEQ_FADE_CHASER;
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+  seqMngrIsAnimated_fake.return_val = true;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, frameSchedStartFrame_fake.call_count,
+    "runCycle failed to start the frame.");
+  zassert_equal(ARRAY_SIZE(sections),
+    seqMngrUpdateFadeChaserFrame_fake.call_count,
+    "runCycle failed to render the animated sections.");
+  zassert_false(isIdle, "runCycle failed to clear the idle flag.");
+}
+
+/**
+ * @test  runCycle must log and skip a section with an unsupported sequence,
+ *        keep rendering the other sections and stop the failed section
+ *        context.
+*/
+ZTEST(ledMngr_suite, test_runCycle_UnsupportedSequence)
+{
+  sequences[0].seqType = SEQ_COUNT;
+  sequences[1].seqType = SEQ_FADE_CHASER;
+  seqCtxs[0].phaseStep = SEQ_MNGR_PHASE_ONE;
+  memset(resets, true, sizeof(resets));
+  appMsgWaitLedSequence_fake.return_val = 0;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_false(resets[0], "runCycle failed to skip the failed section.");
+  zassert_equal(0, seqCtxs[0].phaseStep,
+    "runCycle failed to stop the failed section.");
+  zassert_equal(ARRAY_SIZE(sections) - 1,
+    seqMngrUpdateFadeChaserFrame_fake.call_count,
+    "runCycle failed to render the other sections.");
+}
+
+/**
+ * @test  runCycle must wait for a new sequence without frame deadline when
+ *        every section is static, and restart the frame schedule on wake-up.
+*/
+ZTEST(ledMngr_suite, test_runCycle_Idle)
+{
+  isIdle = true;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  seqMngrIsAnimated_fake.return_val = false;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_true(K_TIMEOUT_EQ(K_FOREVER, appMsgWaitLedSequence_fake.arg0_val),
+    "runCycle failed to wait for a new sequence only.");
+  zassert_equal(0, frameSchedGetNextDeadline_fake.call_count,
+    "runCycle failed to wait for a new sequence only.");
+  zassert_equal(1, frameSchedRestart_fake.call_count,
+    "runCycle failed to restart the frame schedule.");
+  zassert_equal(0, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to skip the static sections.");
+  zassert_true(isIdle, "runCycle failed to keep the idle flag.");
+}
+
+#ifdef CONFIG_LED_MNGR_DOUBLE_BUFFER
+/**
+ * @test  refreshStrip must hand the rendered frame over to the transfer
+ *        thread, swap the buffers and carry the frame in the new back buffer.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_SwapBuffers)
+{
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    testPixels[i].r = i;
+    testPixels[i].g = i + 1;
+    testPixels[i].b = i + 2;
+  }
+  dirties[1] = true;
+
+  refreshStrip();
+
+  zassert_equal(testPixels, frontPixels,
+    "refreshStrip failed to swap the front buffer.");
+  zassert_equal(framePixels, backPixels,
+    "refreshStrip failed to swap the back buffer.");
+  zassert_mem_equal(frontPixels, backPixels, sizeof(testPixels),
+    "refreshStrip failed to carry the frame in the back buffer.");
+  zassert_equal(1, k_sem_count_get(&txReadySem),
+    "refreshStrip failed to hand the frame over to the transfer thread.");
+  zassert_equal(0, k_sem_count_get(&txDoneSem),
+    "refreshStrip failed to wait for the previous transfer.");
+  zassert_false(dirties[1], "refreshStrip failed to clear the dirty flags.");
+}
+
+/**
+ * @test  refreshStrip must keep the buffers when no section is dirty.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_Clean)
+{
+  refreshStrip();
+
+  zassert_equal(testPixels, backPixels,
+    "refreshStrip failed to keep the back buffer.");
+  zassert_equal(0, k_sem_count_get(&txReadySem),
+    "refreshStrip failed to skip the transfer.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+/**
+ * @test  refreshStrip must only encode the dirty sections, at their place in
+ *        the strip symbols, and send the whole strip symbols.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_EncodeDirtySections)
+{
+  dirties[1] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, ws2812EncEncode_fake.call_count,
+    "refreshStrip failed to only encode the dirty section.");
+  zassert_equal(testPixels + sections[1].firstLed,
+    ws2812EncEncode_fake.arg0_val,
+    "refreshStrip failed to encode the dirty section pixels.");
+  zassert_equal(sections[1].lastLed - sections[1].firstLed + 1,
+    ws2812EncEncode_fake.arg1_val,
+    "refreshStrip failed to encode the dirty section pixels.");
+  zassert_equal(spiSymbols + sections[1].firstLed * WS2812_ENC_WORDS_PER_LED,
+    ws2812EncEncode_fake.arg2_val,
+    "refreshStrip failed to encode the section at its place.");
+  zassert_equal(1, ws2812EncSend_fake.call_count,
+    "refreshStrip failed to send the strip symbols.");
+  zassert_equal(spiSymbols, ws2812EncSend_fake.arg0_val,
+    "refreshStrip failed to send the strip symbols.");
+  zassert_equal(TEST_PIXEL_COUNT, ws2812EncSend_fake.arg1_val,
+    "refreshStrip failed to send the whole strip.");
+  zassert_false(dirties[1], "refreshStrip failed to clear the dirty flags.");
+}
+
+/**
+ * @test  refreshStrip must clear the dirty flags once encoded, even if the
+ *        symbols fail to be sent.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_SendFail)
+{
+  dirties[0] = true;
+  ws2812EncSend_fake.return_val = -EIO;
+
+  refreshStrip();
+
+  zassert_equal(1, ws2812EncEncode_fake.call_count,
+    "refreshStrip failed to encode the dirty section.");
+  zassert_false(dirties[0], "refreshStrip failed to clear the dirty flags.");
+}
+
+/**
+ * @test  refreshStrip must skip the encoding and the transfer when no
+ *        section is dirty.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_CleanSymbols)
+{
+  refreshStrip();
+
+  zassert_equal(0, ws2812EncEncode_fake.call_count,
+    "refreshStrip failed to skip the encoding.");
+  zassert_equal(0, ws2812EncSend_fake.call_count,
+    "refreshStrip failed to skip the transfer.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_STREAM
+/**
+ * @test  runCycle must latch a streamed frame on the frame deadline and send
+ *        the whole strip, without rendering the sequences. The strip is
+ *        checked through the SPI encoder fakes.
+*/
+ZTEST(ledMngr_suite, test_runCycle_StreamLatchOnDeadline)
+{
+  resets[0] = true;
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+  frameStreamIsActive_fake.return_val = true;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, frameStreamLatch_fake.call_count,
+    "runCycle failed to latch the streamed frame.");
+  zassert_equal(testPixels, frameStreamLatch_fake.arg0_val,
+    "runCycle failed to latch the frame in the back buffer.");
+  zassert_equal(0, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to bypass the sequences.");
+  zassert_true(resets[0], "runCycle failed to keep the pending reset.");
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+  zassert_equal(LED_MNGR_SECTION_COUNT, ws2812EncEncode_fake.call_count,
+    "runCycle failed to encode the whole frame.");
+  zassert_equal(1, ws2812EncSend_fake.call_count,
+    "runCycle failed to send the streamed frame.");
+#endif
+  zassert_true(isStreaming, "runCycle failed to set the streaming flag.");
+  zassert_false(isIdle, "runCycle failed to clear the idle flag.");
+}
+
+/**
+ * @test  runCycle must keep the strip as is when no streamed frame is ready
+ *        on the frame deadline.
+*/
+ZTEST(ledMngr_suite, test_runCycle_StreamUnderrun)
+{
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+  frameStreamIsActive_fake.return_val = true;
+  frameStreamLatch_fake.return_val = -ENOMSG;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, frameStreamLatch_fake.call_count,
+    "runCycle failed to try latching a streamed frame.");
+  for(uint8_t i = 0; i < LED_MNGR_SECTION_COUNT; ++i)
+    zassert_false(dirties[i], "runCycle failed to keep the strip as is.");
+#ifdef CONFIG_LED_MNGR_SPI_ENCODER
+  zassert_equal(0, ws2812EncSend_fake.call_count,
+    "runCycle failed to keep the strip as is.");
+#endif
+}
+
+/**
+ * @test  runCycle must leave the idle wait when the stream starts and only
+ *        latch the frames on the frame deadlines.
+*/
+ZTEST(ledMngr_suite, test_runCycle_StreamStart)
+{
+  isIdle = true;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  frameStreamIsActive_fake.return_val = true;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, frameSchedRestart_fake.call_count,
+    "runCycle failed to restart the frame schedule.");
+  zassert_equal(0, frameStreamLatch_fake.call_count,
+    "runCycle latched a frame before the frame deadline.");
+  zassert_false(isIdle, "runCycle failed to clear the idle flag.");
+}
+
+/**
+ * @test  runCycle must drop the pending streamed frames and reset every
+ *        section when the stream stops.
+*/
+ZTEST(ledMngr_suite, test_runCycle_StreamStop)
+{
+  isStreaming = true;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  frameStreamIsActive_fake.return_val = false;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, frameStreamFlush_fake.call_count,
+    "runCycle failed to drop the pending streamed frames.");
+  zassert_equal(LED_MNGR_SECTION_COUNT, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to render every section again.");
+  zassert_false(isStreaming, "runCycle failed to clear the streaming flag.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_TIMELINE
+/**
+ * @brief   The has track custom fake, the show having a track for the
+ *          section 0 only.
+ *
+ * @param sectionId   The section ID.
+ *
+ * @return  True for the section 0, false otherwise.
+ */
+static bool hasFirstTrack(uint8_t sectionId)
+{
+  return sectionId == 0;
+}
+
+/**
+ * @test  runCycle must rewind the show when it starts and render its tracks
+ *        at once, in place of the sequences of their sections.
+*/
+ZTEST(ledMngr_suite, test_runCycle_TimelineStart)
+{
+  isIdle = true;
+  resets[0] = true;
+  resets[1] = true;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  frameSchedGetFps_fake.return_val = 60;
+  timelineIsActive_fake.return_val = true;
+  timelineHasTrack_fake.custom_fake = hasFirstTrack;
+  timelineRender_fake.return_val = true;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, timelineRewind_fake.call_count,
+    "runCycle failed to rewind the show.");
+  zassert_equal(60, timelineRewind_fake.arg0_val,
+    "runCycle failed to rewind the show at the frame rate.");
+  zassert_equal(0, timelineAdvance_fake.call_count,
+    "runCycle advanced the show before its first frame.");
+  zassert_equal(LED_MNGR_SECTION_COUNT, timelineRender_fake.call_count,
+    "runCycle failed to render the show.");
+  zassert_equal(1, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to render the sequence of the other section only.");
+  zassert_equal(seqCtxs + 1, seqMngrUpdateSolidFrame_fake.arg0_val,
+    "runCycle failed to render the sequence of the other section.");
+  zassert_true(resets[0], "runCycle failed to keep the track section reset.");
+  zassert_true(isShowPlaying, "runCycle failed to set the show flag.");
+  zassert_false(isIdle, "runCycle failed to clear the idle flag.");
+}
+
+/**
+ * @test  runCycle must advance and render the show on the frame deadline
+ *        only.
+*/
+ZTEST(ledMngr_suite, test_runCycle_TimelineFrameDue)
+{
+  isShowPlaying = true;
+  timelineIsActive_fake.return_val = true;
+  timelineHasTrack_fake.custom_fake = hasFirstTrack;
+
+  appMsgWaitLedSequence_fake.return_val = 0;
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+  zassert_equal(0, timelineAdvance_fake.call_count,
+    "runCycle advanced the show out of frame.");
+  zassert_equal(0, timelineRender_fake.call_count,
+    "runCycle rendered the show out of frame.");
+
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+  zassert_equal(1, timelineAdvance_fake.call_count,
+    "runCycle failed to advance the show.");
+  zassert_equal(LED_MNGR_SECTION_COUNT, timelineRender_fake.call_count,
+    "runCycle failed to render the show.");
+}
+
+/**
+ * @test  runCycle must release the stopped show and reset its sections.
+*/
+ZTEST(ledMngr_suite, test_runCycle_TimelineStop)
+{
+  isShowPlaying = true;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  timelineIsActive_fake.return_val = false;
+  timelineHasTrack_fake.custom_fake = hasFirstTrack;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, timelineRelease_fake.call_count,
+    "runCycle failed to release the show.");
+  zassert_equal(1, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to render the track section sequence again.");
+  zassert_equal(seqCtxs, seqMngrUpdateSolidFrame_fake.arg0_val,
+    "runCycle failed to reset the track section only.");
+  zassert_false(isShowPlaying, "runCycle failed to clear the show flag.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_EFFECT_VM
+/**
+ * @test  runCycle must run the section program on the frame deadline while
+ *        it runs, in place of the sequence manager.
+*/
+ZTEST(ledMngr_suite, test_runCycle_ProgramFrameDue)
+{
+  sequences[0].seqType = SEQ_PROGRAM;
+  sequences[1].seqType = SEQ_SOLID;
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+  effectVmIsRunning_fake.return_val = true;
+  effectVmRunFrame_fake.return_val = true;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, effectVmRunFrame_fake.call_count,
+    "runCycle failed to run the section program.");
+  zassert_equal(vmCtxs, effectVmRunFrame_fake.arg0_val,
+    "runCycle failed to run the section program context.");
+  zassert_equal(testPixels + sections[0].firstLed,
+    effectVmRunFrame_fake.arg4_val,
+    "runCycle failed to run the program on the section pixels.");
+  zassert_equal(0, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle rendered the static section.");
+  zassert_false(isIdle, "runCycle failed to clear the idle flag.");
+
+  effectVmIsRunning_fake.return_val = false;
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+  zassert_equal(1, effectVmRunFrame_fake.call_count,
+    "runCycle ran an ended program.");
+  zassert_true(isIdle, "runCycle failed to set the idle flag.");
+}
+
+/**
+ * @test  runCycle must reset the sections running a newly loaded program.
+*/
+ZTEST(ledMngr_suite, test_runCycle_ProgramLoaded)
+{
+  sequences[0].seqType = SEQ_SOLID;
+  sequences[1].seqType = SEQ_PROGRAM;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  effectVmSync_fake.return_val = true;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, effectVmSync_fake.call_count,
+    "runCycle failed to swap the program in.");
+  zassert_equal(1, effectVmRunFrame_fake.call_count,
+    "runCycle failed to restart the section program.");
+  zassert_equal(vmCtxs + 1, effectVmRunFrame_fake.arg0_val,
+    "runCycle failed to restart the program section.");
+  zassert_true(effectVmRunFrame_fake.arg3_val,
+    "runCycle failed to reset the section program.");
+  zassert_equal(0, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle reset the other section.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_COMPOSITOR
+/**
+ * @brief The test popped layer.
+*/
+static CompositorLayer_t poppedLayer;
+
+/**
+ * @brief   The pop layer custom fake, popping the test layer once.
+ *
+ * @param layer       The output layer.
+ *
+ * @return  0 on the first call, -ENOMSG otherwise.
+ */
+static int popTestLayer(CompositorLayer_t *layer)
+{
+  if(compositorPopLayer_fake.call_count > 1)
+    return -ENOMSG;
+
+  *layer = poppedLayer;
+
+  return 0;
+}
+
+/**
+ * @brief   Set the test layer popped on the next cycle.
+ *
+ * @param layerId     The layer ID.
+ * @param alpha       The layer alpha.
+ */
+static void setTestLayer(uint8_t layerId, uint8_t alpha)
+{
+  poppedLayer = (CompositorLayer_t){
+    .layerId = layerId,
+    .alpha = alpha,
+    .blendMode = COMPOSITOR_BLEND_ADD,
+    .seq = {.version = APP_MSG_LED_SEQ_VERSION, .seqType = SEQ_FADE_CHASER,
+            .sectionId = 0},
+  };
+  RESET_FAKE(compositorPopLayer);
+  compositorPopLayer_fake.custom_fake = popTestLayer;
+}
+
+/**
+ * @test  runCycle must render the sequence of a section gaining an overlay
+ *        into the sequence layer, render the overlay and compose both into
+ *        the section pixels.
+*/
+ZTEST(ledMngr_suite, test_runCycle_LayerAdded)
+{
+  sequences[0].seqType = SEQ_SOLID;
+  sequences[1].seqType = SEQ_SOLID;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  seqMngrUpdateSolidFrame_fake.return_val = true;
+  setTestLayer(1, 128);
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to reset the overlaid section only.");
+  zassert_equal(layerPixels[0], seqMngrUpdateSolidFrame_fake.arg3_val,
+    "runCycle failed to render the sequence into the sequence layer.");
+  zassert_equal(1, seqMngrUpdateFadeChaserFrame_fake.call_count,
+    "runCycle failed to render the overlay layer.");
+  zassert_equal(&layers[0][1].seqCtx,
+    seqMngrUpdateFadeChaserFrame_fake.arg0_val,
+    "runCycle failed to use the overlay layer context.");
+  zassert_equal(layerPixels[2], seqMngrUpdateFadeChaserFrame_fake.arg4_val,
+    "runCycle failed to render the overlay into its layer.");
+  zassert_true(seqMngrUpdateFadeChaserFrame_fake.arg3_val,
+    "runCycle failed to reset the overlay layer.");
+
+  zassert_equal(CONFIG_LED_MNGR_COMPOSITOR_LAYERS,
+    compositorBlend_fake.call_count, "runCycle failed to compose the layers.");
+  zassert_equal(COMPOSITOR_BLEND_ADD, compositorBlend_fake.arg0_val,
+    "runCycle failed to use the layer blend mode.");
+  zassert_equal(128, compositorBlend_fake.arg1_val,
+    "runCycle failed to use the layer alpha.");
+  zassert_equal(testPixels, compositorBlend_fake.arg3_val,
+    "runCycle failed to compose into the section pixels.");
+  zassert_equal(sections[0].lastLed + 1, compositorBlend_fake.arg4_val,
+    "runCycle failed to compose the section pixels.");
+}
+
+/**
+ * @test  runCycle must render an animated overlay on the frame deadline and
+ *        compose it over the static section sequence.
+*/
+ZTEST(ledMngr_suite, test_runCycle_LayerFrameDue)
+{
+  sequences[0].seqType = SEQ_SOLID;
+  sequences[1].seqType = SEQ_SOLID;
+  layers[0][0].config.alpha = 255;
+  layers[0][0].config.seq.seqType = SEQ_FADE_CHASER;
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+  seqMngrUpdateFadeChaserFrame_fake.return_val = false;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+  zassert_equal(0, seqMngrUpdateFadeChaserFrame_fake.call_count,
+    "runCycle rendered a static overlay.");
+  zassert_equal(0, compositorBlend_fake.call_count,
+    "runCycle composed an unchanged section.");
+  zassert_true(isIdle, "runCycle failed to set the idle flag.");
+
+  seqMngrIsAnimated_fake.return_val = true;
+  seqMngrUpdateFadeChaserFrame_fake.return_val = true;
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+  zassert_equal(1, seqMngrUpdateFadeChaserFrame_fake.call_count,
+    "runCycle failed to render the animated overlay.");
+  zassert_false(seqMngrUpdateFadeChaserFrame_fake.arg3_val,
+    "runCycle reset the animated overlay.");
+  zassert_equal(CONFIG_LED_MNGR_COMPOSITOR_LAYERS,
+    compositorBlend_fake.call_count,
+    "runCycle failed to compose the updated section.");
+  zassert_false(isIdle, "runCycle failed to clear the idle flag.");
+}
+
+/**
+ * @test  runCycle must render the sequence of a section losing its last
+ *        overlay into the section pixels again.
+*/
+ZTEST(ledMngr_suite, test_runCycle_LayerRemoved)
+{
+  sequences[0].seqType = SEQ_SOLID;
+  sequences[1].seqType = SEQ_SOLID;
+  layers[0][0].config.alpha = 255;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  setTestLayer(0, 0);
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(1, seqMngrUpdateSolidFrame_fake.call_count,
+    "runCycle failed to reset the section.");
+  zassert_equal(testPixels, seqMngrUpdateSolidFrame_fake.arg3_val,
+    "runCycle failed to render the sequence into the section pixels.");
+  zassert_equal(0, compositorBlend_fake.call_count,
+    "runCycle composed a section without overlay.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_CROSSFADE
+/**
+ * @brief The test transition time, 3 frames at 30 FPS.
+*/
+#define TEST_TRANSITION_MS              100
+
+/**
+ * @test  runCycle must start the transition of a section getting a new
+ *        sequence: the new sequence is rendered into the transition pixels,
+ *        over a copy of the current frame, and the section pixels are kept.
+*/
+ZTEST(ledMngr_suite, test_runCycle_TransitionStart)
+{
+  size_t firstLed = sections[TEST_PUSHED_SECTION_ID].firstLed;
+
+  ledMngrSetTransitionTime(TEST_TRANSITION_MS);
+  frameSchedGetFps_fake.return_val = 30;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  appMsgPopLedSequence_fake.custom_fake = popOneSequence;
+  seqMngrUpdateSolidFrame_fake.return_val = true;
+  testPixels[firstLed].r = 0x42;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(3, fadeFrames[TEST_PUSHED_SECTION_ID],
+    "runCycle failed to set the transition frame count.");
+  zassert_equal(0x42, fadePixels[firstLed].r,
+    "runCycle failed to copy the current frame.");
+  zassert_equal(fadePixels + firstLed, seqMngrUpdateSolidFrame_fake.arg3_val,
+    "runCycle failed to render the new sequence into the transition pixels.");
+  zassert_equal(0, colorMngrApplyLerp_fake.call_count,
+    "runCycle moved the section pixels out of frame.");
+  zassert_false(isIdle, "runCycle failed to clear the idle flag.");
+}
+
+/**
+ * @test  runCycle must move the section pixels toward the transition pixels
+ *        by one over the remaining frame count on each frame deadline, and
+ *        end the transition on the new sequence frame.
+*/
+ZTEST(ledMngr_suite, test_runCycle_TransitionFrameDue)
+{
+  size_t firstLed = sections[TEST_PUSHED_SECTION_ID].firstLed;
+  uint32_t weights[] = {COLOR_LERP_ONE / 2, COLOR_LERP_ONE};
+
+  fadeFrames[TEST_PUSHED_SECTION_ID] = ARRAY_SIZE(weights);
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(weights); ++i)
+  {
+    zassert_equal(0, runCycle(),
+      "runCycle failed to return the success code.");
+    zassert_equal(i + 1, colorMngrApplyLerp_fake.call_count,
+      "runCycle failed to move the section pixels.");
+    zassert_equal(weights[i], colorMngrApplyLerp_fake.arg0_val,
+      "runCycle failed to use the transition weight %u.", i);
+    zassert_equal(fadePixels + firstLed, colorMngrApplyLerp_fake.arg1_val,
+      "runCycle failed to move toward the transition pixels.");
+    zassert_equal(testPixels + firstLed, colorMngrApplyLerp_fake.arg2_val,
+      "runCycle failed to move the section pixels.");
+  }
+
+  zassert_equal(0, fadeFrames[TEST_PUSHED_SECTION_ID],
+    "runCycle failed to end the transition.");
+  zassert_true(isIdle, "runCycle failed to set the idle flag.");
+}
+
+/**
+ * @brief The test long transition time, 300 frames at 60 FPS.
+*/
+#define TEST_LONG_TRANSITION_MS         5000
+
+/**
+ * @test  runCycle must keep moving the section pixels on every frame of a
+ *        transition longer than the lerp weight resolution of 8 bits.
+*/
+ZTEST(ledMngr_suite, test_runCycle_TransitionLongFade)
+{
+  uint32_t frameCnt;
+
+  ledMngrSetTransitionTime(TEST_LONG_TRANSITION_MS);
+  frameSchedGetFps_fake.return_val = 60;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  appMsgPopLedSequence_fake.custom_fake = popOneSequence;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  frameCnt = fadeFrames[TEST_PUSHED_SECTION_ID];
+  zassert_equal(300, frameCnt,
+    "runCycle failed to set the transition frame count.");
+
+  appMsgWaitLedSequence_fake.return_val = -EAGAIN;
+
+  for(uint32_t i = 0; i < frameCnt; ++i)
+  {
+    zassert_equal(0, runCycle(),
+      "runCycle failed to return the success code.");
+    zassert_equal(COLOR_LERP_ONE / (frameCnt - i),
+      colorMngrApplyLerp_fake.arg0_val,
+      "runCycle failed to use the transition weight %u.", i);
+    zassert_not_equal(0, colorMngrApplyLerp_fake.arg0_val,
+      "runCycle failed to move the section pixels on frame %u.", i);
+  }
+
+  zassert_equal(frameCnt, colorMngrApplyLerp_fake.call_count,
+    "runCycle failed to move the section pixels on each frame.");
+  zassert_equal(COLOR_LERP_ONE, colorMngrApplyLerp_fake.arg0_val,
+    "runCycle failed to end the transition on the new sequence frame.");
+  zassert_equal(0, fadeFrames[TEST_PUSHED_SECTION_ID],
+    "runCycle failed to end the transition.");
+}
+
+/**
+ * @test  runCycle must cut over to a new sequence without transition time.
+*/
+ZTEST(ledMngr_suite, test_runCycle_TransitionHardCut)
+{
+  ledMngrSetTransitionTime(0);
+  zassert_equal(0, ledMngrGetTransitionTime(),
+    "ledMngrGetTransitionTime failed to return the transition time.");
+  frameSchedGetFps_fake.return_val = 30;
+  appMsgWaitLedSequence_fake.return_val = 0;
+  appMsgPopLedSequence_fake.custom_fake = popOneSequence;
+
+  zassert_equal(0, runCycle(), "runCycle failed to return the success code.");
+
+  zassert_equal(0, fadeFrames[TEST_PUSHED_SECTION_ID],
+    "runCycle started a transition.");
+  zassert_equal(testPixels + sections[TEST_PUSHED_SECTION_ID].firstLed,
+    seqMngrUpdateSolidFrame_fake.arg3_val,
+    "runCycle failed to render the new sequence into the section pixels.");
+}
+#endif
+
+#if defined(CONFIG_LED_MNGR_GAMMA) && defined(CONFIG_LED_MNGR_DOUBLE_BUFFER)
+/**
+ * @test  refreshStrip must gamma correct the front buffer only, once the
+ *        linear frame is carried in the back buffer.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_GammaFrontBuffer)
+{
+  dirties[0] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, colorMngrApplyGamma_fake.call_count,
+    "refreshStrip failed to gamma correct the frame.");
+  zassert_equal(frontPixels, colorMngrApplyGamma_fake.arg0_val,
+    "refreshStrip failed to gamma correct the front buffer.");
+  zassert_equal(frontPixels, colorMngrApplyGamma_fake.arg1_val,
+    "refreshStrip failed to gamma correct the front buffer in place.");
+  zassert_equal(TEST_PIXEL_COUNT, colorMngrApplyGamma_fake.arg2_val,
+    "refreshStrip failed to gamma correct the whole strip.");
+}
+#elif defined(CONFIG_LED_MNGR_GAMMA) && !defined(CONFIG_LED_MNGR_SPI_ENCODER)
+/**
+ * @test  refreshStrip must gamma correct the frame into the output pixels
+ *        and keep the back buffer linear.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_GammaOutput)
+{
+  dirties[0] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, colorMngrApplyGamma_fake.call_count,
+    "refreshStrip failed to gamma correct the frame.");
+  zassert_equal(testPixels, colorMngrApplyGamma_fake.arg0_val,
+    "refreshStrip failed to gamma correct the back buffer.");
+  zassert_equal(outputPixels, colorMngrApplyGamma_fake.arg1_val,
+    "refreshStrip failed to gamma correct into the output pixels.");
+  zassert_false(dirties[0], "refreshStrip failed to clear the dirty flags.");
+}
+#endif
+
+#if defined(CONFIG_LED_MNGR_POWER_LIMIT) && defined(CONFIG_LED_MNGR_DOUBLE_BUFFER)
+/**
+ * @test  refreshStrip must estimate the linear frame and scale the front
+ *        buffer only, when the frame exceeds the current budget.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_PowerLimitFrontBuffer)
+{
+  uint16_t scale = 128;
+
+  powerLimiterUpdate_fake.return_val = scale;
+  dirties[0] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, powerLimiterUpdate_fake.call_count,
+    "refreshStrip failed to estimate the frame current.");
+  zassert_equal(testPixels, powerLimiterUpdate_fake.arg0_val,
+    "refreshStrip failed to estimate the back buffer.");
+  zassert_equal(TEST_PIXEL_COUNT, powerLimiterUpdate_fake.arg1_val,
+    "refreshStrip failed to estimate the whole strip.");
+  zassert_equal(1, powerLimiterApply_fake.call_count,
+    "refreshStrip failed to scale the frame.");
+  zassert_equal(scale, powerLimiterApply_fake.arg0_val,
+    "refreshStrip failed to scale the frame to the budget.");
+  zassert_equal(frontPixels, powerLimiterApply_fake.arg1_val,
+    "refreshStrip failed to scale the front buffer.");
+  zassert_equal(frontPixels, powerLimiterApply_fake.arg2_val,
+    "refreshStrip failed to scale the front buffer in place.");
+}
+#elif defined(CONFIG_LED_MNGR_POWER_LIMIT) && defined(CONFIG_LED_MNGR_SPI_ENCODER)
+/**
+ * @test  refreshStrip must set the encoder scale and encode every section
+ *        again when the power limiter scale changes.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_PowerLimitScaleChange)
+{
+  uint16_t scale = 128;
+
+  powerLimiterUpdate_fake.return_val = scale;
+  dirties[0] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, ws2812EncSetScale_fake.call_count,
+    "refreshStrip failed to set the encoder scale.");
+  zassert_equal(scale, ws2812EncSetScale_fake.arg0_val,
+    "refreshStrip failed to set the frame scale.");
+  zassert_equal(LED_MNGR_SECTION_COUNT, ws2812EncEncode_fake.call_count,
+    "refreshStrip failed to encode every section.");
+
+  RESET_FAKE(ws2812EncEncode);
+  dirties[0] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, ws2812EncSetScale_fake.call_count,
+    "refreshStrip failed to keep the encoder scale.");
+  zassert_equal(1, ws2812EncEncode_fake.call_count,
+    "refreshStrip failed to only encode the dirty section.");
+}
+#elif defined(CONFIG_LED_MNGR_POWER_LIMIT)
+/**
+ * @test  refreshStrip must scale the frame into the output pixels when it
+ *        exceeds the current budget, and keep the back buffer at full level.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_PowerLimitOutput)
+{
+  uint16_t scale = 128;
+
+  powerLimiterUpdate_fake.return_val = scale;
+  dirties[0] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, powerLimiterUpdate_fake.call_count,
+    "refreshStrip failed to estimate the frame current.");
+  zassert_equal(testPixels, powerLimiterUpdate_fake.arg0_val,
+    "refreshStrip failed to estimate the back buffer.");
+  zassert_equal(1, powerLimiterApply_fake.call_count,
+    "refreshStrip failed to scale the frame.");
+  zassert_equal(scale, powerLimiterApply_fake.arg0_val,
+    "refreshStrip failed to scale the frame to the budget.");
+#ifdef CONFIG_LED_MNGR_GAMMA
+  zassert_equal(outputPixels, powerLimiterApply_fake.arg1_val,
+    "refreshStrip failed to scale the gamma corrected frame.");
+#else
+  zassert_equal(testPixels, powerLimiterApply_fake.arg1_val,
+    "refreshStrip failed to scale the back buffer.");
+#endif
+  zassert_equal(outputPixels, powerLimiterApply_fake.arg2_val,
+    "refreshStrip failed to scale into the output pixels.");
+}
+
+/**
+ * @test  refreshStrip must skip the scaling when the frame fits the current
+ *        budget.
+*/
+ZTEST(ledMngr_suite, test_refreshStrip_PowerLimitInBudget)
+{
+  dirties[0] = true;
+
+  refreshStrip();
+
+  zassert_equal(1, powerLimiterUpdate_fake.call_count,
+    "refreshStrip failed to estimate the frame current.");
+  zassert_equal(0, powerLimiterApply_fake.call_count,
+    "refreshStrip failed to skip the scaling.");
+  zassert_false(dirties[0], "refreshStrip failed to clear the dirty flags.");
+}
+#endif
+
 /** @} */
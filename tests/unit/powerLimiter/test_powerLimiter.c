@@ -0,0 +1,266 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_powerLimiter.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Power Limiter Module Test Cases
+ *
+ *            This file is the test cases of the power limiter module.
+ *
+ * @ingroup  powerLimiter
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "powerLimiter.h"
+#include "powerLimiter.c"
+
+#include "colorManager.h"
+#include "zephyrLedStrip.h"
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(const uint8_t*, colorMngrGetGammaLut);
+#endif
+
+/**
+ * @brief The test pixel count.
+*/
+#define TEST_PIXEL_COUNT                18
+
+/**
+ * @brief The test pixels.
+*/
+static ZephyrRgbPixel_t testPixels[TEST_PIXEL_COUNT];
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+/**
+ * @brief The identity gamma table, the estimation tests use linear levels.
+*/
+static uint8_t identityLut[COLOR_GAMMA_SIZE];
+#endif
+
+/**
+ * @brief   Get the estimated current of the test pixels set to a color.
+ *
+ * @param r           The red level.
+ * @param g           The green level.
+ * @param b           The blue level.
+ *
+ * @return  The estimated current (mA).
+ */
+static uint32_t fillPixels(uint8_t r, uint8_t g, uint8_t b)
+{
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+    testPixels[i] = (ZephyrRgbPixel_t){.r = r, .g = g, .b = b};
+
+  return (TEST_PIXEL_COUNT * (r * CONFIG_LED_MNGR_POWER_RED_MA +
+    g * CONFIG_LED_MNGR_POWER_GREEN_MA + b * CONFIG_LED_MNGR_POWER_BLUE_MA) +
+    UINT8_MAX / 2) / UINT8_MAX;
+}
+
+static void powerLimiterCaseSetup(void *f)
+{
+#ifdef CONFIG_LED_MNGR_GAMMA
+  for(uint16_t i = 0; i < ARRAY_SIZE(identityLut); ++i)
+    identityLut[i] = i;
+
+  RESET_FAKE(colorMngrGetGammaLut);
+  colorMngrGetGammaLut_fake.return_val = identityLut;
+#endif
+
+  budget = CONFIG_LED_MNGR_POWER_BUDGET_MA;
+  powerLimiterResetStats();
+}
+
+ZTEST_SUITE(powerLimiter_suite, NULL, NULL, powerLimiterCaseSetup, NULL, NULL);
+
+/**
+ * @test  powerLimiterUpdate must leave a frame fitting the budget at full
+ *        level and count it.
+*/
+ZTEST(powerLimiter_suite, test_powerLimiterUpdate_InBudget)
+{
+  PowerLimiterStats_t stats;
+  uint32_t current;
+
+  current = fillPixels(0x80, 0x40, 0x00);
+  budget = current;
+
+  zassert_equal(POWER_LIMITER_SCALE_ONE,
+    powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT),
+    "powerLimiterUpdate failed to leave the frame at full level.");
+
+  powerLimiterGetStats(&stats);
+  zassert_equal(1, stats.frameCount,
+    "powerLimiterUpdate failed to count the frame.");
+  zassert_equal(0, stats.limitedCount,
+    "powerLimiterUpdate failed to skip the limited frame count.");
+  zassert_equal(current, stats.lastCurrent,
+    "powerLimiterUpdate failed to estimate the frame current.");
+}
+
+/**
+ * @test  powerLimiterUpdate must get the scale fitting a frame exceeding the
+ *        budget in it, and count how often the limiter fires.
+*/
+ZTEST(powerLimiter_suite, test_powerLimiterUpdate_OverBudget)
+{
+  PowerLimiterStats_t stats;
+  uint32_t current;
+  uint16_t scale;
+
+  current = fillPixels(0xff, 0xff, 0xff);
+  budget = current / 3;
+
+  scale = powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT);
+
+  zassert_true(scale < POWER_LIMITER_SCALE_ONE,
+    "powerLimiterUpdate failed to scale the frame down.");
+  zassert_true(current * scale / POWER_LIMITER_SCALE_ONE <= budget,
+    "powerLimiterUpdate failed to fit the frame in the budget.");
+  zassert_true(current * (scale + 1) / POWER_LIMITER_SCALE_ONE > budget,
+    "powerLimiterUpdate failed to keep the most of the budget.");
+
+  fillPixels(0x10, 0x10, 0x10);
+  powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT);
+
+  powerLimiterGetStats(&stats);
+  zassert_equal(2, stats.frameCount,
+    "powerLimiterUpdate failed to count the frames.");
+  zassert_equal(1, stats.limitedCount,
+    "powerLimiterUpdate failed to count the limited frame.");
+  zassert_equal(current, stats.maxCurrent,
+    "powerLimiterUpdate failed to keep the maximum current.");
+}
+
+/**
+ * @test  powerLimiterUpdate must weight each channel with its own current.
+*/
+ZTEST(powerLimiter_suite, test_powerLimiterUpdate_ChannelWeights)
+{
+  PowerLimiterStats_t stats;
+
+  fillPixels(0xff, 0x00, 0x00);
+  powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT);
+  powerLimiterGetStats(&stats);
+  zassert_equal(TEST_PIXEL_COUNT * CONFIG_LED_MNGR_POWER_RED_MA,
+    stats.lastCurrent,
+    "powerLimiterUpdate failed to estimate the red current.");
+
+  fillPixels(0x00, 0xff, 0x00);
+  powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT);
+  powerLimiterGetStats(&stats);
+  zassert_equal(TEST_PIXEL_COUNT * CONFIG_LED_MNGR_POWER_GREEN_MA,
+    stats.lastCurrent,
+    "powerLimiterUpdate failed to estimate the green current.");
+
+  fillPixels(0x00, 0x00, 0xff);
+  powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT);
+  powerLimiterGetStats(&stats);
+  zassert_equal(TEST_PIXEL_COUNT * CONFIG_LED_MNGR_POWER_BLUE_MA,
+    stats.lastCurrent,
+    "powerLimiterUpdate failed to estimate the blue current.");
+}
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+/**
+ * @test  powerLimiterUpdate must estimate the gamma corrected levels.
+*/
+ZTEST(powerLimiter_suite, test_powerLimiterUpdate_Gamma)
+{
+  PowerLimiterStats_t stats;
+  uint8_t gammaLut[COLOR_GAMMA_SIZE];
+
+  for(uint16_t i = 0; i < ARRAY_SIZE(gammaLut); ++i)
+    gammaLut[i] = 255 - i;
+
+  colorMngrGetGammaLut_fake.return_val = gammaLut;
+
+  fillPixels(0x00, 0x00, 0x00);
+  powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT);
+
+  powerLimiterGetStats(&stats);
+  zassert_equal(fillPixels(0xff, 0xff, 0xff), stats.lastCurrent,
+    "powerLimiterUpdate failed to estimate the corrected levels.");
+}
+#endif
+
+/**
+ * @test  powerLimiterApply must scale each channel, in place too.
+*/
+ZTEST(powerLimiter_suite, test_powerLimiterApply_Channels)
+{
+  ZephyrRgbPixel_t scaled[TEST_PIXEL_COUNT];
+  uint16_t scale = 100;
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+    testPixels[i] = (ZephyrRgbPixel_t){.r = i * 14, .g = 255 - i, .b = i};
+
+  powerLimiterApply(scale, testPixels, scaled, TEST_PIXEL_COUNT);
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    zassert_equal(testPixels[i].r * scale >> POWER_LIMITER_SCALE_SHIFT,
+      scaled[i].r, "powerLimiterApply failed to scale the red channel.");
+    zassert_equal(testPixels[i].g * scale >> POWER_LIMITER_SCALE_SHIFT,
+      scaled[i].g, "powerLimiterApply failed to scale the green channel.");
+    zassert_equal(testPixels[i].b * scale >> POWER_LIMITER_SCALE_SHIFT,
+      scaled[i].b, "powerLimiterApply failed to scale the blue channel.");
+  }
+
+  powerLimiterApply(scale, testPixels, testPixels, TEST_PIXEL_COUNT);
+  zassert_mem_equal(scaled, testPixels, sizeof(scaled),
+    "powerLimiterApply failed to scale in place.");
+
+  memcpy(scaled, testPixels, sizeof(scaled));
+  powerLimiterApply(POWER_LIMITER_SCALE_ONE, testPixels, testPixels,
+    TEST_PIXEL_COUNT);
+  zassert_mem_equal(scaled, testPixels, sizeof(scaled),
+    "powerLimiterApply failed to keep the full level.");
+}
+
+/**
+ * @test  powerLimiterSetBudget must reject a 0 budget and keep the budget.
+*/
+ZTEST(powerLimiter_suite, test_powerLimiterSetBudget_Invalid)
+{
+  zassert_equal(-EINVAL, powerLimiterSetBudget(0),
+    "powerLimiterSetBudget failed to reject the 0 budget.");
+  zassert_equal(CONFIG_LED_MNGR_POWER_BUDGET_MA, powerLimiterGetBudget(),
+    "powerLimiterSetBudget failed to keep the budget.");
+
+  zassert_equal(0, powerLimiterSetBudget(250),
+    "powerLimiterSetBudget failed to set the budget.");
+  zassert_equal(250, powerLimiterGetBudget(),
+    "powerLimiterSetBudget failed to set the budget.");
+}
+
+/**
+ * @test  powerLimiterResetStats must clear the statistics.
+*/
+ZTEST(powerLimiter_suite, test_powerLimiterResetStats_Clear)
+{
+  PowerLimiterStats_t stats;
+
+  fillPixels(0xff, 0xff, 0xff);
+  budget = 1;
+  powerLimiterUpdate(testPixels, TEST_PIXEL_COUNT);
+
+  powerLimiterResetStats();
+
+  powerLimiterGetStats(&stats);
+  zassert_equal(0, stats.frameCount,
+    "powerLimiterResetStats failed to clear the frame count.");
+  zassert_equal(0, stats.limitedCount,
+    "powerLimiterResetStats failed to clear the limited frame count.");
+  zassert_equal(0, stats.maxCurrent,
+    "powerLimiterResetStats failed to clear the maximum current.");
+}
+
+/** @} */
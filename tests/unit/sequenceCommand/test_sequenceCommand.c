@@ -21,14 +21,31 @@
 #include "sequenceCommand.c"
 
 #include "appMsg.h"
+#include "ledManager.h"
 
 DEFINE_FFF_GLOBALS;
 
 FAKE_VALUE_FUNC(int, appMsgPushLedSequence, LedSequence_t*);
+FAKE_VALUE_FUNC(uint32_t, appMsgGetCoalescedCount);
+FAKE_VOID_FUNC(appMsgBeginLedTransaction, LedTransaction_t*);
+FAKE_VALUE_FUNC(int, appMsgStageLedSequence, LedTransaction_t*, LedSequence_t*);
+FAKE_VALUE_FUNC(int, appMsgCommitLedTransaction, LedTransaction_t*);
+FAKE_VALUE_FUNC(size_t, ledMngrGetSectionCount);
+FAKE_VALUE_FUNC(int, ledMngrGetSectionId, const char*);
 
 static void seqCommandCaseSetup(void *f)
 {
   RESET_FAKE(appMsgPushLedSequence);
+  RESET_FAKE(appMsgGetCoalescedCount);
+  RESET_FAKE(appMsgBeginLedTransaction);
+  RESET_FAKE(appMsgStageLedSequence);
+  RESET_FAKE(appMsgCommitLedTransaction);
+  RESET_FAKE(ledMngrGetSectionCount);
+  RESET_FAKE(ledMngrGetSectionId);
+
+  ledMngrGetSectionId_fake.return_val = -ENOENT;
+
+  isTransactionOpen = false;
 }
 
 ZTEST_SUITE(seqCommand_suite, NULL, NULL, seqCommandCaseSetup, NULL, NULL);
@@ -47,12 +64,13 @@ static LedSequence_t expectedSeq;
  */
 static int customPushSolidSequence(LedSequence_t *seq)
 {
+  zassert_equal(APP_MSG_LED_SEQ_VERSION, seq->version, "bad sequence pushed.");
   zassert_equal(expectedSeq.seqType, seq->seqType, "bad sequence pushed.");
   zassert_equal(expectedSeq.sectionId, seq->sectionId, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeBase, seq->timeBase, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeUnit, seq->timeUnit, "bad sequence pushed.");
-  zassert_equal(expectedSeq.startColor.hexColor, seq->startColor.hexColor,
-    "bad sequence pushed.");
+  zassert_mem_equal(&expectedSeq.startColor, &seq->startColor,
+    sizeof(PackedColor_t), "bad sequence pushed.");
 
   return 0;
 }
@@ -66,12 +84,13 @@ static int customPushSolidSequence(LedSequence_t *seq)
  */
 static int customPushBreatherSequence(LedSequence_t *seq)
 {
+  zassert_equal(APP_MSG_LED_SEQ_VERSION, seq->version, "bad sequence pushed.");
   zassert_equal(expectedSeq.seqType, seq->seqType, "bad sequence pushed.");
   zassert_equal(expectedSeq.sectionId, seq->sectionId, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeBase, seq->timeBase, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeUnit, seq->timeUnit, "bad sequence pushed.");
-  zassert_equal(expectedSeq.startColor.hexColor, seq->startColor.hexColor,
-    "bad sequence pushed.");
+  zassert_mem_equal(&expectedSeq.startColor, &seq->startColor,
+    sizeof(PackedColor_t), "bad sequence pushed.");
 
   return 0;
 }
@@ -85,12 +104,13 @@ static int customPushBreatherSequence(LedSequence_t *seq)
  */
 static int customPushFadeChaserSequence(LedSequence_t *seq)
 {
+  zassert_equal(APP_MSG_LED_SEQ_VERSION, seq->version, "bad sequence pushed.");
   zassert_equal(expectedSeq.seqType, seq->seqType, "bad sequence pushed.");
   zassert_equal(expectedSeq.sectionId, seq->sectionId, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeBase, seq->timeBase, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeUnit, seq->timeUnit, "bad sequence pushed.");
-  zassert_equal(expectedSeq.startColor.hexColor, seq->startColor.hexColor,
-    "bad sequence pushed.");
+  zassert_mem_equal(&expectedSeq.startColor, &seq->startColor,
+    sizeof(PackedColor_t), "bad sequence pushed.");
 
   return 0;
 }
@@ -104,14 +124,15 @@ static int customPushFadeChaserSequence(LedSequence_t *seq)
  */
 static int custompushColorRangeSequence(LedSequence_t *seq)
 {
+  zassert_equal(APP_MSG_LED_SEQ_VERSION, seq->version, "bad sequence pushed.");
   zassert_equal(expectedSeq.seqType, seq->seqType, "bad sequence pushed.");
   zassert_equal(expectedSeq.sectionId, seq->sectionId, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeBase, seq->timeBase, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeUnit, seq->timeUnit, "bad sequence pushed.");
-  zassert_equal(expectedSeq.startColor.hexColor, seq->startColor.hexColor,
-    "bad sequence pushed.");
-  zassert_equal(expectedSeq.endColor.hexColor, seq->endColor.hexColor,
-    "bad sequence pushed.");
+  zassert_mem_equal(&expectedSeq.startColor, &seq->startColor,
+    sizeof(PackedColor_t), "bad sequence pushed.");
+  zassert_mem_equal(&expectedSeq.endColor, &seq->endColor,
+    sizeof(PackedColor_t), "bad sequence pushed.");
 
   return 0;
 }
@@ -125,14 +146,15 @@ static int custompushColorRangeSequence(LedSequence_t *seq)
  */
 static int custompushRangeChaserSequence(LedSequence_t *seq)
 {
+  zassert_equal(APP_MSG_LED_SEQ_VERSION, seq->version, "bad sequence pushed.");
   zassert_equal(expectedSeq.seqType, seq->seqType, "bad sequence pushed.");
   zassert_equal(expectedSeq.sectionId, seq->sectionId, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeBase, seq->timeBase, "bad sequence pushed.");
   zassert_equal(expectedSeq.timeUnit, seq->timeUnit, "bad sequence pushed.");
-  zassert_equal(expectedSeq.startColor.hexColor, seq->startColor.hexColor,
-    "bad sequence pushed.");
-  zassert_equal(expectedSeq.endColor.hexColor, seq->endColor.hexColor,
-    "bad sequence pushed.");
+  zassert_mem_equal(&expectedSeq.startColor, &seq->startColor,
+    sizeof(PackedColor_t), "bad sequence pushed.");
+  zassert_mem_equal(&expectedSeq.endColor, &seq->endColor,
+    sizeof(PackedColor_t), "bad sequence pushed.");
 
   return 0;
 }
@@ -163,6 +185,8 @@ ZTEST(seqCommand_suite, test_isSectionValid_success)
   char *args[SECTION_CONVERT_TEST_COUNT] = {"1", "54", "100"};
   uint32_t expectedVals[SECTION_CONVERT_TEST_COUNT] = {1, 54, 100};
 
+  ledMngrGetSectionCount_fake.return_val = 101;
+
   for(uint8_t i = 0; i < SECTION_CONVERT_TEST_COUNT; ++i)
   {
     zassert_true(isSectionValid(args[i], &section),
@@ -172,6 +196,43 @@ ZTEST(seqCommand_suite, test_isSectionValid_success)
   }
 }
 
+/**
+ * @test  isSectionValid must return false if the converted section ID is
+ *        not a LED strip section.
+*/
+ZTEST(seqCommand_suite, test_isSectionValid_outOfRange)
+{
+  uint32_t section;
+  char *args[SECTION_CONVERT_TEST_COUNT] = {"2", "54", "100"};
+
+  ledMngrGetSectionCount_fake.return_val = 2;
+
+  for(uint8_t i = 0; i < SECTION_CONVERT_TEST_COUNT; ++i)
+  {
+    zassert_false(isSectionValid(args[i], &section),
+      "isSectionValid failed to flag the invalidity of the secion.");
+  }
+}
+
+/**
+ * @test  isSectionValid must return true and the section ID when the
+ *        argument is a section name.
+*/
+ZTEST(seqCommand_suite, test_isSectionValid_name)
+{
+  uint32_t section;
+  int sectionId = 1;
+
+  ledMngrGetSectionId_fake.return_val = sectionId;
+
+  zassert_true(isSectionValid("right", &section),
+    "isSectionValid failed to flag the validity of the secion.");
+  zassert_equal(sectionId, section,
+    "isSectionValid failed to convert the section name.");
+  zassert_equal(0, ledMngrGetSectionCount_fake.call_count,
+    "isSectionValid failed to use the section name.");
+}
+
 #define COLOR_CONVERT_TEST_COUNT                    3
 /**
  * @test  isColorValid must return false if the convertion fails.
@@ -240,6 +301,22 @@ ZTEST(seqCommand_suite, test_isLengthValid_convertFail)
   }
 }
 
+/**
+ * @test  isLengthValid must return false if the length does not fit in the
+ *        message time base.
+*/
+ZTEST(seqCommand_suite, test_isLengthValid_outOfRange)
+{
+  uint32_t length;
+  char *args[LENGTH_CONVERT_TEST_COUNT] = {"65535", "65536", "100000"};
+
+  for(uint8_t i = 0; i < LENGTH_CONVERT_TEST_COUNT; ++i)
+  {
+    zassert_false(isLengthValid(args[i], &length),
+      "isLengthValid failed to flag the invalidity of the sequence length.");
+  }
+}
+
 /**
  * @test  isLengthValid must return true if the convertion succeeds and
  *        the converted value.
@@ -324,8 +401,8 @@ ZTEST(seqCommand_suite, test_pushSolidColorSequence_success)
 
   expectedSeq.seqType = SEQ_SOLID;
   expectedSeq.sectionId = section;
-  expectedSeq.startColor.hexColor = color.hexColor;
-  expectedSeq.timeBase = ZEPHYR_TIME_FOREVER;
+  appMsgPackColor(&color, &expectedSeq.startColor);
+  expectedSeq.timeBase = APP_MSG_TIME_FOREVER;
   expectedSeq.timeUnit = SECONDS;
 
   zassert_equal(successRet, pushSolidColorSequence(section, &color),
@@ -364,7 +441,7 @@ ZTEST(seqCommand_suite, test_pushBreatherSequence_success)
 
   expectedSeq.seqType = SEQ_SOLID_BREATHER;
   expectedSeq.sectionId = section;
-  expectedSeq.startColor.hexColor = color.hexColor;
+  appMsgPackColor(&color, &expectedSeq.startColor);
   expectedSeq.timeBase = length;
   expectedSeq.timeUnit = SECONDS;
 
@@ -410,7 +487,7 @@ ZTEST(seqCommand_suite, test_pushFadeChaserSequence_success)
   {
     expectedSeq.seqType = isInverted[i] ? SEQ_INVERT_FADE_CHASER : SEQ_FADE_CHASER;
     expectedSeq.sectionId = sections[i];
-    expectedSeq.startColor.hexColor = colors[i].hexColor;
+    appMsgPackColor(&colors[i], &expectedSeq.startColor);
     expectedSeq.timeBase = lengths[i];
     expectedSeq.timeUnit = SECONDS;
 
@@ -453,8 +530,8 @@ ZTEST(seqCommand_suite, test_pushColorRangeSequence_success)
 
   expectedSeq.seqType = SEQ_COLOR_RANGE;
   expectedSeq.sectionId = section;
-  expectedSeq.startColor.hexColor = startClr.hexColor;
-  expectedSeq.endColor.hexColor = endClr.hexColor;
+  appMsgPackColor(&startClr, &expectedSeq.startColor);
+  appMsgPackColor(&endClr, &expectedSeq.endColor);
   expectedSeq.timeBase = length;
   expectedSeq.timeUnit = SECONDS;
 
@@ -503,8 +580,8 @@ ZTEST(seqCommand_suite, test_pushRangeChaserSequence_success)
   {
     expectedSeq.seqType = isInverted[i] ? SEQ_INVERT_RANGE_CHASER : SEQ_RANGE_CHASER;
     expectedSeq.sectionId = sections[i];
-    expectedSeq.startColor.hexColor = startClrs[i].hexColor;
-    expectedSeq.endColor.hexColor = endClrs[i].hexColor;
+    appMsgPackColor(&startClrs[i], &expectedSeq.startColor);
+    appMsgPackColor(&endClrs[i], &expectedSeq.endColor);
     expectedSeq.timeBase = lengths[i];
     expectedSeq.timeUnit = SECONDS;
 
@@ -514,4 +591,44 @@ ZTEST(seqCommand_suite, test_pushRangeChaserSequence_success)
   }
 }
 
+/**
+ * @test  submitSequence must push the sequence when no transaction is open.
+*/
+ZTEST(seqCommand_suite, test_submitSequence_push)
+{
+  LedSequence_t sequence = {.version = APP_MSG_LED_SEQ_VERSION};
+
+  appMsgPushLedSequence_fake.return_val = -ENOSPC;
+
+  zassert_equal(-ENOSPC, submitSequence(&sequence),
+    "submitSequence failed to return the push result.");
+  zassert_equal(1, appMsgPushLedSequence_fake.call_count,
+    "submitSequence failed to push the sequence.");
+  zassert_equal(0, appMsgStageLedSequence_fake.call_count,
+    "submitSequence failed to leave the transaction.");
+}
+
+/**
+ * @test  submitSequence must stage the sequence in the transaction when one
+ *        is open.
+*/
+ZTEST(seqCommand_suite, test_submitSequence_stage)
+{
+  LedSequence_t sequence = {.version = APP_MSG_LED_SEQ_VERSION};
+
+  isTransactionOpen = true;
+  appMsgStageLedSequence_fake.return_val = -EINVAL;
+
+  zassert_equal(-EINVAL, submitSequence(&sequence),
+    "submitSequence failed to return the staging result.");
+  zassert_equal(1, appMsgStageLedSequence_fake.call_count,
+    "submitSequence failed to stage the sequence.");
+  zassert_equal(&transaction, appMsgStageLedSequence_fake.arg0_val,
+    "submitSequence failed to stage in the transaction.");
+  zassert_equal(&sequence, appMsgStageLedSequence_fake.arg1_val,
+    "submitSequence failed to stage the sequence.");
+  zassert_equal(0, appMsgPushLedSequence_fake.call_count,
+    "submitSequence failed to hold the sequence back.");
+}
+
 /** @} */
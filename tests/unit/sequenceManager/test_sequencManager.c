@@ -28,9 +28,9 @@ DEFINE_FFF_GLOBALS;
 FAKE_VOID_FUNC(colorMngrSetSingle, Color_t*, ZephyrRgbPixel_t*, size_t);
 FAKE_VOID_FUNC(colorMngrApplyFade, uint8_t, ZephyrRgbPixel_t*, size_t);
 FAKE_VOID_FUNC(colorMngrApplyUnfade, uint8_t, ZephyrRgbPixel_t*, size_t);
-FAKE_VOID_FUNC(colorMngrApplyFadeTrail, uint8_t, uint32_t, bool,
+FAKE_VOID_FUNC(colorMngrApplyFadeTrail, uint32_t, uint32_t, bool,
                ZephyrRgbPixel_t*, size_t);
-FAKE_VOID_FUNC(colorMngrUpdateRange, uint8_t, uint8_t, bool,
+FAKE_VOID_FUNC(colorMngrUpdateRange, uint8_t*, uint8_t, uint8_t, uint8_t, bool,
                ZephyrRgbPixel_t*, size_t);
 FAKE_VOID_FUNC(colorMngrApplyRangeTrail, uint32_t, uint8_t, uint8_t, bool,
                ZephyrRgbPixel_t*, size_t);
@@ -41,9 +41,15 @@ FAKE_VALUE_FUNC(uint8_t, colorMngrConvertColor, Color_t*);
 */
 #define TEST_MAX_PIXEL_COUNT            10
 
+/**
+ * @brief The test section count.
+*/
+#define TEST_SECTION_COUNT              2
+
 struct seqMngr_suite_fixture
 {
   ZephyrRgbPixel_t pixels[TEST_MAX_PIXEL_COUNT];
+  SequenceContext_t ctx[TEST_SECTION_COUNT];
 };
 
 static void *seqMngrSuiteSetup(void)
@@ -62,7 +68,7 @@ static void seqMngrSuiteTeardown(void *f)
 
 static void seqMngrCaseSetup(void *f)
 {
-  memset(f, 0x00, TEST_MAX_PIXEL_COUNT);
+  memset(f, 0x00, sizeof(struct seqMngr_suite_fixture));
 
   RESET_FAKE(colorMngrSetSingle);
   RESET_FAKE(colorMngrApplyFade);
@@ -84,7 +90,9 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateSolidFrame_SetSolidColor)
 {
   Color_t color;
 
-  seqMngrUpdateSolidFrame(&color, fixture->pixels, TEST_MAX_PIXEL_COUNT);
+  zassert_true(seqMngrUpdateSolidFrame(fixture->ctx, &color, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT),
+    "seqMngrUpdateSolidFrame failed to report the pixel update.");
 
   zassert_equal(1, colorMngrSetSingle_fake.call_count,
     "seqMngrUpdateSolidFrame failed to set the pixel buffer to the desired color.");
@@ -97,9 +105,81 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateSolidFrame_SetSolidColor)
 }
 
 #define BREATHER_TEST_COUNT               3
+/**
+ * @brief   Set the breather cycle to get the given fade level step per frame.
+ *
+ * @param ctx         The section sequence context.
+ * @param step        The fade level step per frame.
+*/
+static void setBreatherStep(SequenceContext_t *ctx, uint8_t step)
+{
+  seqMngrSetCycle(ctx, MSEC_PER_SEC / step, MILLI_SEC, SEQ_MNGR_BREATHER_SPAN);
+}
+
+/**
+ * @test  seqMngrSetCycle must convert the sequence length to milliseconds and
+ *        keep the frame rate.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrSetCycle_Convert)
+{
+  seqMngrSetCycle(fixture->ctx, 5, SECONDS, 30);
+  zassert_equal(5000, fixture->ctx->cycleMs,
+    "seqMngrSetCycle failed to convert the length in milliseconds.");
+  zassert_equal(30, fixture->ctx->fps,
+    "seqMngrSetCycle failed to set the frame rate.");
+
+  seqMngrSetCycle(fixture->ctx, 250, MILLI_SEC, 60);
+  zassert_equal(250, fixture->ctx->cycleMs,
+    "seqMngrSetCycle failed to keep the length in milliseconds.");
+  zassert_equal(60, fixture->ctx->fps,
+    "seqMngrSetCycle failed to set the frame rate.");
+
+  seqMngrSetCycle(fixture->ctx, 250500, MICRO_SEC, 60);
+  zassert_equal(251, fixture->ctx->cycleMs,
+    "seqMngrSetCycle failed to convert the length in milliseconds.");
+
+  seqMngrSetCycle(fixture->ctx, 500, MICRO_SEC, 60);
+  zassert_equal(17, fixture->ctx->cycleMs,
+    "seqMngrSetCycle failed to round the length up to one frame.");
+
+  seqMngrSetCycle(fixture->ctx, 5, MILLI_SEC, 30);
+  zassert_equal(34, fixture->ctx->cycleMs,
+    "seqMngrSetCycle failed to round the length up to one frame.");
+
+  seqMngrSetCycle(fixture->ctx, ZEPHYR_TIME_FOREVER, SECONDS, 30);
+  zassert_equal(ZEPHYR_TIME_FOREVER, fixture->ctx->cycleMs,
+    "seqMngrSetCycle failed to keep the static length.");
+
+  seqMngrSetCycle(fixture->ctx, ZEPHYR_TIME_FOREVER, MICRO_SEC, 30);
+  zassert_equal(ZEPHYR_TIME_FOREVER, fixture->ctx->cycleMs,
+    "seqMngrSetCycle failed to keep the static length.");
+}
+
+/**
+ * @test  seqMngrUpdateSolidFrame must leave the pixels untouched and report
+ *        a static sequence when not resetting.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateSolidFrame_Static)
+{
+  Color_t color;
+
+  zassert_false(seqMngrUpdateSolidFrame(fixture->ctx, &color, false,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT),
+    "seqMngrUpdateSolidFrame failed to report the static frame.");
+  zassert_equal(0, colorMngrSetSingle_fake.call_count,
+    "seqMngrUpdateSolidFrame failed to leave the pixels untouched.");
+
+  fixture->ctx->phaseStep = SEQ_MNGR_PHASE_ONE;
+  seqMngrUpdateSolidFrame(fixture->ctx, &color, true, fixture->pixels,
+    TEST_MAX_PIXEL_COUNT);
+  zassert_false(seqMngrIsAnimated(fixture->ctx),
+    "seqMngrUpdateSolidFrame failed to report a static sequence.");
+}
+
 /**
  * @test  seqMngrUpdateSingleBreatherFrame must set the pixels to the desired
- *        color when resetting the sequence.
+ *        color and compute the per-frame phase increment when resetting the
+ *        sequence.
 */
 ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_Reset)
 {
@@ -108,9 +188,12 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_Reset)
 
   for(uint8_t i = 0; i < BREATHER_TEST_COUNT; ++i)
   {
-    seqMngrUpdateSingleBreatherFrame(&color, steps[i], true, fixture->pixels,
-      TEST_MAX_PIXEL_COUNT);
+    setBreatherStep(fixture->ctx, steps[i]);
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, true,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
+    zassert_equal(steps[i] << SEQ_MNGR_PHASE_SHIFT, fixture->ctx->phaseStep,
+      "seqMngrUpdateSingleBreatherFrame failed to compute the phase increment.");
     zassert_equal(1, colorMngrSetSingle_fake.call_count,
       "seqMngrUpdateSolidFrame failed to set the pixel buffer to the desired color.");
     zassert_equal(&color, colorMngrSetSingle_fake.arg0_val,
@@ -135,8 +218,11 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_ExhaleFade)
 
   for(uint8_t i = 0; i < BREATHER_TEST_COUNT; ++i)
   {
-    seqMngrUpdateSingleBreatherFrame(&color, steps[i], false, fixture->pixels,
-      TEST_MAX_PIXEL_COUNT);
+    setBreatherStep(fixture->ctx, steps[i]);
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, true,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, false,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
     zassert_equal(1, colorMngrApplyFade_fake.call_count,
       "seqMngrUpdateSolidFrame failed to fade the pixels.");
@@ -162,15 +248,21 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_InhaleUnfade)
 
   for(uint8_t i = 0; i < BREATHER_TEST_COUNT; ++i)
   {
-    /* this reset the sequence and do the last exhale step */
-    seqMngrUpdateSingleBreatherFrame(&color, 255 - steps[i] + 1, true,
+    setBreatherStep(fixture->ctx, steps[i]);
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, true,
       fixture->pixels, TEST_MAX_PIXEL_COUNT);
-    seqMngrUpdateSingleBreatherFrame(&color, steps[i], false, fixture->pixels,
-      TEST_MAX_PIXEL_COUNT);
 
-    seqMngrUpdateSingleBreatherFrame(&color, steps[i], false, fixture->pixels,
-      TEST_MAX_PIXEL_COUNT);
+    /* go through the whole exhale */
+    for(uint16_t level = 0; level < 256; level += steps[i])
+      seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, false,
+        fixture->pixels, TEST_MAX_PIXEL_COUNT);
+
+    RESET_FAKE(colorMngrApplyFade);
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, false,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
+    zassert_equal(0, colorMngrApplyFade_fake.call_count,
+      "seqMngrUpdateSolidFrame failed to stop fading the pixels.");
     zassert_equal(1, colorMngrApplyUnfade_fake.call_count,
       "seqMngrUpdateSolidFrame failed to fade the pixels.");
     zassert_equal(steps[i], colorMngrApplyUnfade_fake.arg0_val,
@@ -184,6 +276,88 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_InhaleUnfade)
   }
 }
 
+#define BREATHER_CYCLE_SEC                2
+#define BREATHER_CYCLE_FPS                30
+/**
+ * @test  seqMngrUpdateSingleBreatherFrame must go through a whole exhale and
+ *        inhale within the sequence length at the frame rate.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_FullCycle)
+{
+  Color_t color;
+  uint32_t levels = 0;
+
+  seqMngrSetCycle(fixture->ctx, BREATHER_CYCLE_SEC, SECONDS,
+    BREATHER_CYCLE_FPS);
+  seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
+
+  for(uint8_t i = 0; i < BREATHER_CYCLE_SEC * BREATHER_CYCLE_FPS; ++i)
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, false,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
+
+  for(uint8_t i = 0; i < colorMngrApplyFade_fake.call_count; ++i)
+    levels += colorMngrApplyFade_fake.arg0_history[i];
+  for(uint8_t i = 0; i < colorMngrApplyUnfade_fake.call_count; ++i)
+    levels += colorMngrApplyUnfade_fake.arg0_history[i];
+
+  zassert_equal(SEQ_MNGR_BREATHER_SPAN, levels,
+    "seqMngrUpdateSingleBreatherFrame failed to complete the cycle in time.");
+  zassert_false(fixture->ctx->inhale,
+    "seqMngrUpdateSingleBreatherFrame failed to complete the cycle in time.");
+}
+
+/**
+ * @test  seqMngrUpdateSingleBreatherFrame must not touch the pixels of a
+ *        static breather, i.e. with an infinite sequence length.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_Static)
+{
+  Color_t color;
+
+  seqMngrSetCycle(fixture->ctx, ZEPHYR_TIME_FOREVER, SECONDS, 30);
+  zassert_true(seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT),
+    "seqMngrUpdateSingleBreatherFrame failed to report the pixel update.");
+  zassert_false(seqMngrIsAnimated(fixture->ctx),
+    "seqMngrUpdateSingleBreatherFrame failed to report a static sequence.");
+  zassert_false(seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, false,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT),
+    "seqMngrUpdateSingleBreatherFrame failed to report the static frame.");
+  zassert_equal(0, colorMngrApplyFade_fake.call_count,
+    "seqMngrUpdateSingleBreatherFrame failed to leave the pixels untouched.");
+}
+
+/**
+ * @test  seqMngrUpdateSingleBreatherFrame must accumulate the fractional step
+ *        and fade by one level every other frame at half a level per frame.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_FractionalStep)
+{
+  Color_t color;
+
+  seqMngrSetCycle(fixture->ctx, 4, SECONDS, 256);
+  seqMngrUpdateSingleBreatherFrame(fixture->ctx, &color, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
+
+  zassert_true(seqMngrIsAnimated(fixture->ctx),
+    "seqMngrUpdateSingleBreatherFrame failed to report an animated sequence.");
+
+  for(uint8_t i = 0; i < BREATHER_TEST_COUNT * 2; ++i)
+  {
+    zassert_equal(i % 2 == 1, seqMngrUpdateSingleBreatherFrame(fixture->ctx,
+      &color, false, fixture->pixels, TEST_MAX_PIXEL_COUNT),
+      "seqMngrUpdateSingleBreatherFrame failed to report the pixel update.");
+
+    zassert_equal((i + 1) / 2, colorMngrApplyFade_fake.call_count,
+      "seqMngrUpdateSingleBreatherFrame failed to accumulate the step.");
+  }
+
+  for(uint8_t i = 0; i < colorMngrApplyFade_fake.call_count; ++i)
+    zassert_equal(1, colorMngrApplyFade_fake.arg0_history[i],
+      "seqMngrUpdateSingleBreatherFrame failed to accumulate the step.");
+}
+
 /**
  * @test  seqMngrUpdateFadeChaserFrame must set the color and set the first
  *        fade trail from the first pixel in the buffer when the reset
@@ -192,13 +366,13 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_InhaleUnfade)
 ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_ResetNotInvertedFrame)
 {
   Color_t color;
-  uint8_t step;
+  uint32_t step;
 
   color.hexColor = 0x00ffffff;
-  step = color.r / TEST_MAX_PIXEL_COUNT;
+  step = ((uint32_t)color.r << COLOR_STEP_SHIFT) / TEST_MAX_PIXEL_COUNT;
 
-  seqMngrUpdateFadeChaserFrame(&color, false, true, fixture->pixels,
-    TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateFadeChaserFrame(fixture->ctx, &color, false, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   zassert_equal(1, colorMngrSetSingle_fake.call_count,
     "seqMngrUpdateSolidFrame failed to set the pixel buffer to the initial color.");
@@ -230,13 +404,13 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_ResetNotInvertedFrame)
 ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_ResetInvertedFrame)
 {
   Color_t color;
-  uint8_t step;
+  uint32_t step;
 
   color.hexColor = 0x00ffffff;
-  step = color.r / TEST_MAX_PIXEL_COUNT;
+  step = ((uint32_t)color.r << COLOR_STEP_SHIFT) / TEST_MAX_PIXEL_COUNT;
 
-  seqMngrUpdateFadeChaserFrame(&color, true, true, fixture->pixels,
-    TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateFadeChaserFrame(fixture->ctx, &color, true, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   zassert_equal(1, colorMngrSetSingle_fake.call_count,
     "seqMngrUpdateSolidFrame failed to set the pixel buffer to the initial color.");
@@ -267,22 +441,22 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_ResetInvertedFrame)
 ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_NotInvertedWrapFrame)
 {
   Color_t color;
-  uint8_t step;
+  uint32_t step;
   uint32_t chaserPoint = 1;
 
   color.hexColor = 0x00ffffff;
-  step = color.r / TEST_MAX_PIXEL_COUNT;
+  step = ((uint32_t)color.r << COLOR_STEP_SHIFT) / TEST_MAX_PIXEL_COUNT;
 
-  seqMngrUpdateFadeChaserFrame(&color, false, true, fixture->pixels,
-    TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateFadeChaserFrame(fixture->ctx, &color, false, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   RESET_FAKE(colorMngrSetSingle);
   RESET_FAKE(colorMngrApplyFadeTrail);
 
   for(uint8_t i = 0; i < TEST_MAX_PIXEL_COUNT; ++i)
   {
-    seqMngrUpdateFadeChaserFrame(&color, false, false, fixture->pixels,
-      TEST_MAX_PIXEL_COUNT);
+    seqMngrUpdateFadeChaserFrame(fixture->ctx, &color, false, false,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
     zassert_equal(1, colorMngrApplyFadeTrail_fake.call_count,
       "seqMngrUpdateSolidFrame failed to fade the pixels.");
@@ -313,22 +487,22 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_NotInvertedWrapFrame)
 ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_InvertedWrapFrame)
 {
   Color_t color;
-  uint8_t step;
+  uint32_t step;
   int32_t chaserPoint = 8;
 
   color.hexColor = 0x00ffffff;
-  step = color.r / TEST_MAX_PIXEL_COUNT;
+  step = ((uint32_t)color.r << COLOR_STEP_SHIFT) / TEST_MAX_PIXEL_COUNT;
 
-  seqMngrUpdateFadeChaserFrame(&color, true, true, fixture->pixels,
-    TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateFadeChaserFrame(fixture->ctx, &color, true, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   RESET_FAKE(colorMngrSetSingle);
   RESET_FAKE(colorMngrApplyFadeTrail);
 
   for(uint8_t i = 0; i < TEST_MAX_PIXEL_COUNT; ++i)
   {
-    seqMngrUpdateFadeChaserFrame(&color, true, false, fixture->pixels,
-      TEST_MAX_PIXEL_COUNT);
+    seqMngrUpdateFadeChaserFrame(fixture->ctx, &color, true, false,
+      fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
     zassert_equal(1, colorMngrApplyFadeTrail_fake.call_count,
       "seqMngrUpdateSolidFrame failed to fade the pixels.");
@@ -365,8 +539,8 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeFrame_Reset)
 
   SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-  seqMngrUpdateColorRangeFrame(&startColor, &endColor, true, fixture->pixels,
-    TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateColorRangeFrame(fixture->ctx, &startColor, &endColor, true,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   zassert_equal(COLOR_CONVERT_CALL_CNT, colorMngrConvertColor_fake.call_count,
     "seqMngrUpdateColorRangeFrame failed to convert the start and end colors.");
@@ -376,15 +550,17 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeFrame_Reset)
     "seqMngrUpdateColorRangeFrame failed to convert the start and end colors.");
   zassert_equal(1, colorMngrUpdateRange_fake.call_count,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(wheelPos[0], colorMngrUpdateRange_fake.arg0_val,
+  zassert_equal(wheelPos[0], colorMngrUpdateRange_fake.arg1_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(wheelPos[1], colorMngrUpdateRange_fake.arg1_val,
+  zassert_equal(wheelPos[1], colorMngrUpdateRange_fake.arg2_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_true(colorMngrUpdateRange_fake.arg2_val,
+  zassert_equal(0, colorMngrUpdateRange_fake.arg3_val,
+    "seqMngrUpdateColorRangeFrame failed to keep the range start.");
+  zassert_true(colorMngrUpdateRange_fake.arg4_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(fixture->pixels, colorMngrUpdateRange_fake.arg3_val,
+  zassert_equal(fixture->pixels, colorMngrUpdateRange_fake.arg5_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(TEST_MAX_PIXEL_COUNT, colorMngrUpdateRange_fake.arg4_val,
+  zassert_equal(TEST_MAX_PIXEL_COUNT, colorMngrUpdateRange_fake.arg6_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
 }
 
@@ -398,10 +574,11 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeFrame_NotResetted)
   Color_t endColor = {.hexColor = 0x00ff00};
   uint8_t wheelPos[COLOR_CONVERT_CALL_CNT] = {0, 170};
 
+  fixture->ctx->phaseStep = SEQ_MNGR_PHASE_ONE;
   SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-  seqMngrUpdateColorRangeFrame(&startColor, &endColor, false, fixture->pixels,
-    TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateColorRangeFrame(fixture->ctx, &startColor, &endColor, false,
+    fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   zassert_equal(COLOR_CONVERT_CALL_CNT, colorMngrConvertColor_fake.call_count,
     "seqMngrUpdateColorRangeFrame failed to convert the start and end colors.");
@@ -411,15 +588,17 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeFrame_NotResetted)
     "seqMngrUpdateColorRangeFrame failed to convert the start and end colors.");
   zassert_equal(1, colorMngrUpdateRange_fake.call_count,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(wheelPos[0], colorMngrUpdateRange_fake.arg0_val,
+  zassert_equal(wheelPos[0], colorMngrUpdateRange_fake.arg1_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(wheelPos[1], colorMngrUpdateRange_fake.arg1_val,
+  zassert_equal(wheelPos[1], colorMngrUpdateRange_fake.arg2_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_false(colorMngrUpdateRange_fake.arg2_val,
+  zassert_equal(1, colorMngrUpdateRange_fake.arg3_val,
+    "seqMngrUpdateColorRangeFrame failed to move the range by one position.");
+  zassert_false(colorMngrUpdateRange_fake.arg4_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(fixture->pixels, colorMngrUpdateRange_fake.arg3_val,
+  zassert_equal(fixture->pixels, colorMngrUpdateRange_fake.arg5_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
-  zassert_equal(TEST_MAX_PIXEL_COUNT, colorMngrUpdateRange_fake.arg4_val,
+  zassert_equal(TEST_MAX_PIXEL_COUNT, colorMngrUpdateRange_fake.arg6_val,
     "seqMngrUpdateColorRangeFrame failed to update the color range by reseting it.");
 }
 
@@ -437,8 +616,8 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeChaserFrame_ResetNonInverted)
 
   SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-  seqMngrUpdateColorRangeChaserFrame(&startColor, &endColor, false, true,
-    fixture->pixels, TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateColorRangeChaserFrame(fixture->ctx, &startColor, &endColor,
+    false, true, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   zassert_equal(COLOR_CONVERT_CALL_CNT, colorMngrConvertColor_fake.call_count,
     "seqMngrUpdateColorRangeChaserFrame failed to convert the start and end colors.");
@@ -476,8 +655,8 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeChaserFrame_ResetInverted)
 
   SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-  seqMngrUpdateColorRangeChaserFrame(&startColor, &endColor, true, true,
-    fixture->pixels, TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateColorRangeChaserFrame(fixture->ctx, &startColor, &endColor, true,
+    true, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   zassert_equal(COLOR_CONVERT_CALL_CNT, colorMngrConvertColor_fake.call_count,
     "seqMngrUpdateColorRangeChaserFrame failed to convert the start and end colors.");
@@ -515,8 +694,8 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeChaserFrame_NonInvertedWrap)
 
   SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-  seqMngrUpdateColorRangeChaserFrame(&startColor, &endColor, false, true,
-    fixture->pixels, TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateColorRangeChaserFrame(fixture->ctx, &startColor, &endColor,
+    false, true, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   for(uint8_t i = 0; i < TEST_MAX_PIXEL_COUNT; ++i)
   {
@@ -525,8 +704,8 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeChaserFrame_NonInvertedWrap)
 
     SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-    seqMngrUpdateColorRangeChaserFrame(&startColor, &endColor, false, false,
-      fixture->pixels, TEST_MAX_PIXEL_COUNT);
+    seqMngrUpdateColorRangeChaserFrame(fixture->ctx, &startColor, &endColor,
+      false, false, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
     zassert_equal(COLOR_CONVERT_CALL_CNT, colorMngrConvertColor_fake.call_count,
       "seqMngrUpdateColorRangeChaserFrame failed to convert the start and end colors.");
@@ -569,8 +748,8 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeChaserFrame_InvertedWrap)
 
   SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-  seqMngrUpdateColorRangeChaserFrame(&startColor, &endColor, true, true,
-    fixture->pixels, TEST_MAX_PIXEL_COUNT);
+  seqMngrUpdateColorRangeChaserFrame(fixture->ctx, &startColor, &endColor, true,
+    true, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
   for(uint8_t i = 0; i < TEST_MAX_PIXEL_COUNT; ++i)
   {
@@ -579,8 +758,8 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeChaserFrame_InvertedWrap)
 
     SET_RETURN_SEQ(colorMngrConvertColor, wheelPos, COLOR_CONVERT_CALL_CNT);
 
-    seqMngrUpdateColorRangeChaserFrame(&startColor, &endColor, true, false,
-      fixture->pixels, TEST_MAX_PIXEL_COUNT);
+    seqMngrUpdateColorRangeChaserFrame(fixture->ctx, &startColor, &endColor,
+      true, false, fixture->pixels, TEST_MAX_PIXEL_COUNT);
 
     zassert_equal(COLOR_CONVERT_CALL_CNT, colorMngrConvertColor_fake.call_count,
       "seqMngrUpdateColorRangeChaserFrame failed to convert the start and end colors.");
@@ -609,4 +788,182 @@ ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeChaserFrame_InvertedWrap)
   }
 }
 
+/**
+ * @test  seqMngrUpdateFadeChaserFrame must move the chaser by one pixel every
+ *        other frame when the sequence length lasts two frames per pixel.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_FractionalStep)
+{
+  Color_t color;
+
+  color.hexColor = 0x00ffffff;
+  seqMngrSetCycle(fixture->ctx, 2 * TEST_MAX_PIXEL_COUNT, MILLI_SEC,
+    MSEC_PER_SEC);
+
+  for(uint8_t i = 0; i < 4 * TEST_MAX_PIXEL_COUNT; ++i)
+  {
+    zassert_equal(i % 2 == 0, seqMngrUpdateFadeChaserFrame(fixture->ctx,
+      &color, false, i == 0, fixture->pixels, TEST_MAX_PIXEL_COUNT),
+      "seqMngrUpdateFadeChaserFrame failed to report the pixel update.");
+    zassert_equal((i / 2) % TEST_MAX_PIXEL_COUNT,
+      colorMngrApplyFadeTrail_fake.arg1_val,
+      "seqMngrUpdateFadeChaserFrame failed to accumulate the step.");
+  }
+}
+
+/**
+ * @test  seqMngrUpdateFadeChaserFrame must keep a non zero fade step on
+ *        strips longer than the fade level.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_StripLengths)
+{
+  Color_t color;
+  size_t lengths[] = {18, 300, 1000};
+
+  color.hexColor = 0x00ffffff;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(lengths); ++i)
+  {
+    RESET_FAKE(colorMngrApplyFadeTrail);
+
+    seqMngrUpdateFadeChaserFrame(fixture->ctx, &color, true, true,
+      fixture->pixels, lengths[i]);
+
+    zassert_equal(((uint32_t)color.r << COLOR_STEP_SHIFT) / lengths[i],
+      colorMngrApplyFadeTrail_fake.arg0_val,
+      "seqMngrUpdateFadeChaserFrame failed to fade the strip of %u.",
+      lengths[i]);
+    zassert_not_equal(0, colorMngrApplyFadeTrail_fake.arg0_val,
+      "seqMngrUpdateFadeChaserFrame failed to fade the strip of %u.",
+      lengths[i]);
+    zassert_equal(lengths[i] - 1, colorMngrApplyFadeTrail_fake.arg1_val,
+      "seqMngrUpdateFadeChaserFrame failed to start the strip of %u.",
+      lengths[i]);
+  }
+}
+
+/**
+ * @brief The test section pixel count.
+*/
+#define TEST_SECTION_PIXEL_COUNT        (TEST_MAX_PIXEL_COUNT / TEST_SECTION_COUNT)
+
+/**
+ * @test  seqMngrUpdateSingleBreatherFrame must keep the breather state of
+ *        each section independent when two sections are rendered in the same
+ *        frame.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateSingleBreatherFrame_TwoSections)
+{
+  Color_t color;
+  ZephyrRgbPixel_t *sectionPixels[TEST_SECTION_COUNT] =
+    {fixture->pixels, fixture->pixels + TEST_SECTION_PIXEL_COUNT};
+  uint8_t steps[TEST_SECTION_COUNT] = {200, 1};
+
+  for(uint8_t i = 0; i < TEST_SECTION_COUNT; ++i)
+  {
+    setBreatherStep(fixture->ctx + i, steps[i]);
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx + i, &color, true,
+      sectionPixels[i], TEST_SECTION_PIXEL_COUNT);
+  }
+
+  /* the first section finishes its exhale, the second one keeps exhaling */
+  for(uint8_t j = 0; j < 2; ++j)
+  {
+    for(uint8_t i = 0; i < TEST_SECTION_COUNT; ++i)
+      seqMngrUpdateSingleBreatherFrame(fixture->ctx + i, &color, false,
+        sectionPixels[i], TEST_SECTION_PIXEL_COUNT);
+  }
+
+  RESET_FAKE(colorMngrApplyFade);
+  RESET_FAKE(colorMngrApplyUnfade);
+
+  for(uint8_t i = 0; i < TEST_SECTION_COUNT; ++i)
+    seqMngrUpdateSingleBreatherFrame(fixture->ctx + i, &color, false,
+      sectionPixels[i], TEST_SECTION_PIXEL_COUNT);
+
+  zassert_equal(1, colorMngrApplyUnfade_fake.call_count,
+    "seqMngrUpdateSingleBreatherFrame failed to keep the sections independent.");
+  zassert_equal(sectionPixels[0], colorMngrApplyUnfade_fake.arg1_val,
+    "seqMngrUpdateSingleBreatherFrame failed to keep the sections independent.");
+  zassert_equal(1, colorMngrApplyFade_fake.call_count,
+    "seqMngrUpdateSingleBreatherFrame failed to keep the sections independent.");
+  zassert_equal(sectionPixels[1], colorMngrApplyFade_fake.arg1_val,
+    "seqMngrUpdateSingleBreatherFrame failed to keep the sections independent.");
+}
+
+/**
+ * @test  seqMngrUpdateFadeChaserFrame must keep the chaser position of each
+ *        section independent when two sections are rendered in the same frame.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateFadeChaserFrame_TwoSections)
+{
+  Color_t color;
+  ZephyrRgbPixel_t *sectionPixels[TEST_SECTION_COUNT] =
+    {fixture->pixels, fixture->pixels + TEST_SECTION_PIXEL_COUNT};
+  bool isInverted[TEST_SECTION_COUNT] = {false, true};
+  int32_t chaserPoints[TEST_SECTION_COUNT] = {0, TEST_SECTION_PIXEL_COUNT - 1};
+
+  color.hexColor = 0x00ffffff;
+
+  for(uint8_t i = 0; i < TEST_SECTION_PIXEL_COUNT + 1; ++i)
+  {
+    RESET_FAKE(colorMngrApplyFadeTrail);
+
+    for(uint8_t j = 0; j < TEST_SECTION_COUNT; ++j)
+      seqMngrUpdateFadeChaserFrame(fixture->ctx + j, &color, isInverted[j],
+        i == 0, sectionPixels[j], TEST_SECTION_PIXEL_COUNT);
+
+    zassert_equal(TEST_SECTION_COUNT, colorMngrApplyFadeTrail_fake.call_count,
+      "seqMngrUpdateFadeChaserFrame failed to render both sections.");
+
+    for(uint8_t j = 0; j < TEST_SECTION_COUNT; ++j)
+    {
+      zassert_equal(chaserPoints[j], colorMngrApplyFadeTrail_fake.arg1_history[j],
+        "seqMngrUpdateFadeChaserFrame failed to keep the sections independent.");
+      zassert_equal(!isInverted[j], colorMngrApplyFadeTrail_fake.arg2_history[j],
+        "seqMngrUpdateFadeChaserFrame failed to keep the sections independent.");
+      zassert_equal(sectionPixels[j], colorMngrApplyFadeTrail_fake.arg3_history[j],
+        "seqMngrUpdateFadeChaserFrame failed to keep the sections independent.");
+      zassert_equal(TEST_SECTION_PIXEL_COUNT,
+        colorMngrApplyFadeTrail_fake.arg4_history[j],
+        "seqMngrUpdateFadeChaserFrame failed to keep the sections independent.");
+    }
+
+    ++chaserPoints[0];
+    if(chaserPoints[0] == TEST_SECTION_PIXEL_COUNT)
+      chaserPoints[0] = 0;
+    --chaserPoints[1];
+    if(chaserPoints[1] < 0)
+      chaserPoints[1] = TEST_SECTION_PIXEL_COUNT - 1;
+  }
+}
+
+/**
+ * @test  seqMngrUpdateColorRangeFrame must give each section its own color
+ *        wheel position.
+*/
+ZTEST_F(seqMngr_suite, test_seqMngrUpdateColorRangeFrame_TwoSections)
+{
+  Color_t startColor = {.hexColor = 0xff0000};
+  Color_t endColor = {.hexColor = 0x00ff00};
+  ZephyrRgbPixel_t *sectionPixels[TEST_SECTION_COUNT] =
+    {fixture->pixels, fixture->pixels + TEST_SECTION_PIXEL_COUNT};
+
+  for(uint8_t i = 0; i < TEST_SECTION_COUNT; ++i)
+    seqMngrUpdateColorRangeFrame(fixture->ctx + i, &startColor, &endColor,
+      true, sectionPixels[i], TEST_SECTION_PIXEL_COUNT);
+
+  zassert_equal(TEST_SECTION_COUNT, colorMngrUpdateRange_fake.call_count,
+    "seqMngrUpdateColorRangeFrame failed to render both sections.");
+
+  for(uint8_t i = 0; i < TEST_SECTION_COUNT; ++i)
+  {
+    zassert_equal(&fixture->ctx[i].wheelPos,
+      colorMngrUpdateRange_fake.arg0_history[i],
+      "seqMngrUpdateColorRangeFrame failed to use the section wheel position.");
+    zassert_equal(sectionPixels[i], colorMngrUpdateRange_fake.arg5_history[i],
+      "seqMngrUpdateColorRangeFrame failed to use the section pixels.");
+  }
+}
+
 /** @} */
@@ -0,0 +1,365 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_timeline.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     Timeline Module Test Cases
+ *
+ *            This file is the test cases of the timeline module.
+ *
+ * @ingroup  timeline
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "timeline.h"
+#include "timeline.c"
+
+#include "appMsg.h"
+#include "colorManager.h"
+#include "zephyrLedStrip.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(appMsgNotifyLedManager);
+FAKE_VOID_FUNC(colorMngrSetSingle, Color_t*, ZephyrRgbPixel_t*, size_t);
+
+/**
+ * @brief The test frame rate, 100 msec per frame.
+*/
+#define TEST_FPS                        10
+
+/**
+ * @brief The test section pixel count.
+*/
+#define TEST_PIXEL_COUNT                9
+
+/**
+ * @brief The test show.
+*/
+typedef struct
+{
+  TimelineHeader_t header;              /**< The show header. */
+  TimelineTrack_t track0;               /**< The first track header. */
+  TimelineKey_t keys0[3];               /**< The first track keyframes. */
+  TimelineTrack_t track1;               /**< The second track header. */
+  TimelineKey_t keys1[1];               /**< The second track keyframes. */
+} TestShow_t;
+
+/**
+ * @brief The test show template. The section 0 fades in linearly up to
+ *        500 msec, holds its color and turns blue at 800 msec. The section 1
+ *        stays red.
+*/
+static const TestShow_t showTemplate = {
+  .header = {.version = TIMELINE_VERSION, .trackCount = 2,
+             .durationMs = 1000},
+  .track0 = {.sectionId = 0, .keyCount = 3},
+  .keys0 = {
+    {.timeMs = 0, .color = {.r = 0, .g = 0, .b = 0},
+     .curve = TIMELINE_CURVE_LINEAR},
+    {.timeMs = 500, .color = {.r = 200, .g = 100, .b = 0},
+     .curve = TIMELINE_CURVE_STEP},
+    {.timeMs = 800, .color = {.r = 0, .g = 0, .b = 255},
+     .curve = TIMELINE_CURVE_LINEAR},
+  },
+  .track1 = {.sectionId = 1, .keyCount = 1},
+  .keys1 = {{.timeMs = 0, .color = {.r = 255}}},
+};
+
+/**
+ * @brief The test show.
+*/
+static TestShow_t testShow;
+
+/**
+ * @brief The test pixels.
+*/
+static ZephyrRgbPixel_t testPixels[TEST_PIXEL_COUNT];
+
+/**
+ * @brief The rendered color.
+*/
+static Color_t renderedColor;
+
+/**
+ * @brief   The custom set single color mock, capturing the color.
+ *
+ * @param color       The color.
+ * @param pixels      The pixel buffer.
+ * @param pixelCnt    The pixel count.
+ */
+static void captureSetSingle(Color_t *color, ZephyrRgbPixel_t *pixels,
+                             size_t pixelCnt)
+{
+  renderedColor = *color;
+}
+
+/**
+ * @brief   Write the test show in the timeline buffer and play it from its
+ *          start.
+ *
+ * @return  The play status.
+ */
+static int playTestShow(void)
+{
+  int rc;
+
+  rc = timelineWrite(0, (const uint8_t *)&testShow, sizeof(testShow));
+  if(rc < 0)
+    return rc;
+
+  rc = timelinePlay();
+  if(rc == 0)
+    timelineRewind(TEST_FPS);
+
+  return rc;
+}
+
+/**
+ * @brief   Advance the show by a frame count.
+ *
+ * @param frameCnt    The frame count.
+*/
+static void advanceFrames(uint32_t frameCnt)
+{
+  for(uint32_t i = 0; i < frameCnt; ++i)
+    timelineAdvance();
+}
+
+static void timelineCaseSetup(void *f)
+{
+  RESET_FAKE(appMsgNotifyLedManager);
+  RESET_FAKE(colorMngrSetSingle);
+
+  colorMngrSetSingle_fake.custom_fake = captureSetSingle;
+
+  memset(&show, 0x00, sizeof(show));
+  memset(buffer, 0x00, sizeof(buffer));
+  testShow = showTemplate;
+  renderedColor.hexColor = 0;
+}
+
+ZTEST_SUITE(timeline_suite, NULL, NULL, timelineCaseSetup, NULL, NULL);
+
+/**
+ * @test  timelineWrite must reject a chunk out of the buffer.
+*/
+ZTEST(timeline_suite, test_timelineWrite_OutOfBuffer)
+{
+  uint8_t chunk[4] = {0};
+
+  zassert_equal(-EINVAL, timelineWrite(CONFIG_LED_MNGR_TIMELINE_SIZE - 3,
+    chunk, sizeof(chunk)), "timelineWrite failed to return the error code.");
+  zassert_equal(0, timelineWrite(CONFIG_LED_MNGR_TIMELINE_SIZE - 4,
+    chunk, sizeof(chunk)), "timelineWrite failed to write the last chunk.");
+}
+
+/**
+ * @test  timelineWrite must be rejected until the consumer released the show.
+*/
+ZTEST(timeline_suite, test_timelineWrite_Busy)
+{
+  zassert_equal(0, playTestShow(), "timelinePlay failed to play the show.");
+
+  timelineStop();
+  zassert_false(timelineIsActive(), "timelineStop failed to stop the show.");
+  zassert_equal(-EBUSY, timelineWrite(0, (const uint8_t *)&testShow,
+    sizeof(testShow)), "timelineWrite failed to wait for the release.");
+  zassert_equal(-EBUSY, timelinePlay(),
+    "timelinePlay failed to wait for the release.");
+
+  timelineRelease();
+  zassert_equal(0, timelineWrite(0, (const uint8_t *)&testShow,
+    sizeof(testShow)), "timelineWrite failed to write the released show.");
+}
+
+/**
+ * @test  timelinePlay must reject an invalid show and leave it stopped.
+*/
+ZTEST(timeline_suite, test_timelinePlay_Invalid)
+{
+  TestShow_t shows[7];
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(shows); ++i)
+    shows[i] = showTemplate;
+
+  shows[0].header.version = TIMELINE_VERSION + 1;
+  shows[1].header.durationMs = 0;
+  shows[2].track1.sectionId = APP_MSG_LED_SECTION_COUNT;
+  shows[3].track1.sectionId = 0;
+  shows[4].keys0[2].timeMs = 400;
+  shows[5].keys0[1].curve = TIMELINE_CURVE_COUNT;
+  shows[6].keys1[0].timeMs = 1001;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(shows); ++i)
+  {
+    testShow = shows[i];
+    zassert_equal(-EBADMSG, playTestShow(),
+      "timelinePlay failed to reject the invalid show %u.", i);
+    zassert_false(timelineIsActive(),
+      "timelinePlay failed to leave the show stopped.");
+  }
+
+  zassert_equal(0, appMsgNotifyLedManager_fake.call_count,
+    "timelinePlay notified the LED manager of an invalid show.");
+}
+
+/**
+ * @test  timelinePlay must index the show tracks, start the show and notify
+ *        the LED manager.
+*/
+ZTEST(timeline_suite, test_timelinePlay_Success)
+{
+  TimelineStatus_t status;
+
+  zassert_equal(0, playTestShow(), "timelinePlay failed to play the show.");
+
+  zassert_true(timelineIsActive(), "timelinePlay failed to start the show.");
+  zassert_equal(1, appMsgNotifyLedManager_fake.call_count,
+    "timelinePlay failed to notify the LED manager.");
+  zassert_true(timelineHasTrack(0) && timelineHasTrack(1),
+    "timelinePlay failed to index the tracks.");
+  zassert_false(timelineHasTrack(APP_MSG_LED_SECTION_COUNT),
+    "timelineHasTrack failed to reject the invalid section.");
+
+  timelineGetStatus(&status);
+  zassert_equal(2, status.trackCount, "bad status track count.");
+  zassert_equal(1000, status.durationMs, "bad status duration.");
+}
+
+/**
+ * @test  timelineRender must interpolate the color between 2 keyframes.
+*/
+ZTEST(timeline_suite, test_timelineRender_Linear)
+{
+  playTestShow();
+  advanceFrames(2);
+
+  zassert_true(timelineRender(0, testPixels, TEST_PIXEL_COUNT),
+    "timelineRender failed to update the pixels.");
+  zassert_equal(80, renderedColor.r, "bad interpolated red.");
+  zassert_equal(40, renderedColor.g, "bad interpolated green.");
+  zassert_equal(0, renderedColor.b, "bad interpolated blue.");
+  zassert_equal(testPixels, colorMngrSetSingle_fake.arg1_val,
+    "timelineRender failed to render the section pixels.");
+  zassert_equal(TEST_PIXEL_COUNT, colorMngrSetSingle_fake.arg2_val,
+    "timelineRender failed to render every section pixel.");
+}
+
+/**
+ * @test  timelineRender must hold the color of a step keyframe, then hold
+ *        the last keyframe color.
+*/
+ZTEST(timeline_suite, test_timelineRender_Step)
+{
+  playTestShow();
+
+  advanceFrames(6);
+  timelineRender(0, testPixels, TEST_PIXEL_COUNT);
+  zassert_equal(0x00c86400, renderedColor.hexColor,
+    "timelineRender failed to hold the step keyframe color.");
+
+  advanceFrames(2);
+  timelineRender(0, testPixels, TEST_PIXEL_COUNT);
+  zassert_equal(0x000000ff, renderedColor.hexColor,
+    "timelineRender failed to reach the next keyframe color.");
+
+  advanceFrames(1);
+  zassert_false(timelineRender(0, testPixels, TEST_PIXEL_COUNT),
+    "timelineRender failed to hold the last keyframe color.");
+}
+
+/**
+ * @test  timelineRender must hold the first keyframe color before it.
+*/
+ZTEST(timeline_suite, test_timelineRender_BeforeFirstKey)
+{
+  testShow.keys0[0].timeMs = 300;
+  testShow.keys0[0].color.r = 10;
+  playTestShow();
+
+  advanceFrames(1);
+  zassert_true(timelineRender(0, testPixels, TEST_PIXEL_COUNT),
+    "timelineRender failed to update the pixels.");
+  zassert_equal(0x000a0000, renderedColor.hexColor,
+    "timelineRender failed to hold the first keyframe color.");
+}
+
+/**
+ * @test  timelineRender must only update the pixels when the color changed.
+*/
+ZTEST(timeline_suite, test_timelineRender_Unchanged)
+{
+  playTestShow();
+
+  zassert_true(timelineRender(1, testPixels, TEST_PIXEL_COUNT),
+    "timelineRender failed to render the first frame.");
+  advanceFrames(1);
+  zassert_false(timelineRender(1, testPixels, TEST_PIXEL_COUNT),
+    "timelineRender updated the pixels of an unchanged color.");
+  zassert_equal(1, colorMngrSetSingle_fake.call_count,
+    "timelineRender rendered an unchanged color.");
+
+  timelineRewind(TEST_FPS);
+  zassert_true(timelineRender(1, testPixels, TEST_PIXEL_COUNT),
+    "timelineRender failed to render again after the rewind.");
+}
+
+/**
+ * @test  timelineAdvance must stop the show at its end.
+*/
+ZTEST(timeline_suite, test_timelineAdvance_End)
+{
+  playTestShow();
+
+  advanceFrames(9);
+  zassert_true(timelineIsActive(), "timelineAdvance stopped the show early.");
+  zassert_false(timelineAdvance(), "timelineAdvance failed to end the show.");
+  zassert_false(timelineIsActive(), "timelineAdvance failed to stop the show.");
+}
+
+/**
+ * @test  timelineAdvance must restart a looping show at its end.
+*/
+ZTEST(timeline_suite, test_timelineAdvance_Loop)
+{
+  testShow.header.flags = TIMELINE_FLAG_LOOP;
+  playTestShow();
+
+  advanceFrames(9);
+  timelineRender(0, testPixels, TEST_PIXEL_COUNT);
+  zassert_equal(0x000000ff, renderedColor.hexColor, "bad color at the end.");
+
+  advanceFrames(2);
+  zassert_true(timelineIsActive(), "timelineAdvance stopped a looping show.");
+  zassert_true(timelineRender(0, testPixels, TEST_PIXEL_COUNT),
+    "timelineRender failed to render the restarted show.");
+  zassert_equal(40, renderedColor.r,
+    "timelineAdvance failed to restart the show.");
+}
+
+/**
+ * @test  applyCurve must shape the weight with each curve.
+*/
+ZTEST(timeline_suite, test_applyCurve_Shape)
+{
+  const uint32_t half = TIMELINE_FIXED_ONE / 2;
+  uint32_t expectedHalves[TIMELINE_CURVE_COUNT] = {0, half, half / 2,
+                                                   half + half / 2, half};
+
+  for(uint8_t i = 0; i < TIMELINE_CURVE_COUNT; ++i)
+  {
+    zassert_equal(0, applyCurve(i, 0), "curve %u failed to start at 0.", i);
+    zassert_equal(expectedHalves[i], applyCurve(i, half),
+      "curve %u failed to shape the middle weight.", i);
+    zassert_true(applyCurve(i, TIMELINE_FIXED_ONE - 1) <= TIMELINE_FIXED_ONE,
+      "curve %u overflowed the weight.", i);
+  }
+}
+
+/** @} */
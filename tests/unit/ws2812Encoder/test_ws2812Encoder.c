@@ -0,0 +1,204 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      test_ws2812Encoder.c
+ * @author    jbacon
+ * @date      2026-10-17
+ * @brief     WS2812 Encoder Module Test Cases
+ *
+ *            This file is the test cases of the WS2812 encoder module.
+ *
+ * @ingroup  ws2812Encoder
+ *
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "ws2812Encoder.h"
+#include "ws2812Encoder.c"
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(const uint8_t*, colorMngrGetGammaLut);
+#endif
+
+/**
+ * @brief The test pixel count.
+*/
+#define TEST_PIXEL_COUNT                3
+
+/**
+ * @brief   Encode a color channel bit by bit, the way the LED strip driver
+ *          does, as reference.
+ *
+ * @param value       The channel value.
+ * @param symbols     The output symbols.
+ */
+static void bitEncodeChannel(uint8_t value, uint8_t *symbols)
+{
+  for(uint8_t mask = 0x80; mask > 0; mask >>= 1)
+    *symbols++ = value & mask ? WS2812_ENC_ONE_FRAME : WS2812_ENC_ZERO_FRAME;
+}
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+/**
+ * @brief The identity gamma table, the encoding tests use linear levels.
+*/
+static uint8_t identityLut[256];
+#endif
+
+static void ws2812EncCaseSetup(void *f)
+{
+#ifdef CONFIG_LED_MNGR_GAMMA
+  for(uint16_t i = 0; i < ARRAY_SIZE(identityLut); ++i)
+    identityLut[i] = i;
+
+  RESET_FAKE(colorMngrGetGammaLut);
+  colorMngrGetGammaLut_fake.return_val = identityLut;
+#endif
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+  outputScale = POWER_LIMITER_SCALE_ONE;
+#endif
+}
+
+ZTEST_SUITE(ws2812Enc_suite, NULL, NULL, ws2812EncCaseSetup, NULL, NULL);
+
+/**
+ * @test  The nibble table must give the symbols of each nibble bit, most
+ *        significant bit first in memory.
+*/
+ZTEST(ws2812Enc_suite, test_nibbleSymbols_BitOrder)
+{
+  uint8_t expected[4];
+  const uint8_t *symbols;
+
+  for(uint8_t i = 0; i < 16; ++i)
+  {
+    for(uint8_t j = 0; j < 4; ++j)
+      expected[j] = i & BIT(3 - j) ? WS2812_ENC_ONE_FRAME :
+        WS2812_ENC_ZERO_FRAME;
+
+    symbols = (const uint8_t *)(nibbleSymbols + i);
+    zassert_mem_equal(expected, symbols, sizeof(expected),
+      "nibbleSymbols failed to give the symbols of nibble 0x%x.", i);
+  }
+}
+
+/**
+ * @test  ws2812EncEncode must encode each pixel in the strip color order
+ *        (green, red, blue) and match the bit by bit reference.
+*/
+ZTEST(ws2812Enc_suite, test_ws2812EncEncode_MatchBitReference)
+{
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT] = {{.r = 0xff, .g = 0x00, .b = 0x81},
+                                               {.r = 0x5a, .g = 0xa5, .b = 0x0f},
+                                               {.r = 0x12, .g = 0xf0, .b = 0x3c}};
+  uint32_t symbols[TEST_PIXEL_COUNT * WS2812_ENC_WORDS_PER_LED];
+  uint8_t expected[TEST_PIXEL_COUNT * WS2812_ENC_SYMBOLS_PER_LED];
+  uint8_t *led;
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    led = expected + i * WS2812_ENC_SYMBOLS_PER_LED;
+    bitEncodeChannel(pixels[i].g, led);
+    bitEncodeChannel(pixels[i].r, led + 8);
+    bitEncodeChannel(pixels[i].b, led + 16);
+  }
+
+  ws2812EncEncode(pixels, TEST_PIXEL_COUNT, symbols);
+
+  zassert_mem_equal(expected, symbols, sizeof(expected),
+    "ws2812EncEncode failed to match the bit by bit reference.");
+}
+
+/**
+ * @test  ws2812EncEncode must only write the symbols of the given pixels.
+*/
+ZTEST(ws2812Enc_suite, test_ws2812EncEncode_Bounds)
+{
+  ZephyrRgbPixel_t pixel = {.r = 0xff, .g = 0xff, .b = 0xff};
+  uint32_t symbols[WS2812_ENC_WORDS_PER_LED + 1];
+
+  symbols[WS2812_ENC_WORDS_PER_LED] = 0xdeadbeef;
+
+  ws2812EncEncode(&pixel, 1, symbols);
+
+  for(uint8_t i = 0; i < WS2812_ENC_WORDS_PER_LED; ++i)
+    zassert_equal(nibbleSymbols[0x0f], symbols[i],
+      "ws2812EncEncode failed to encode the pixel.");
+  zassert_equal(0xdeadbeef, symbols[WS2812_ENC_WORDS_PER_LED],
+    "ws2812EncEncode failed to stay in the pixel symbols.");
+}
+
+#ifdef CONFIG_LED_MNGR_GAMMA
+/**
+ * @test  ws2812EncEncode must encode the gamma corrected channels, fetching
+ *        the gamma table once per call.
+*/
+ZTEST(ws2812Enc_suite, test_ws2812EncEncode_Gamma)
+{
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT] = {{.r = 0xff, .g = 0x00, .b = 0x81},
+                                               {.r = 0x5a, .g = 0xa5, .b = 0x0f},
+                                               {.r = 0x12, .g = 0xf0, .b = 0x3c}};
+  uint32_t symbols[TEST_PIXEL_COUNT * WS2812_ENC_WORDS_PER_LED];
+  uint8_t expected[TEST_PIXEL_COUNT * WS2812_ENC_SYMBOLS_PER_LED];
+  uint8_t gammaLut[256];
+  uint8_t *led;
+
+  for(uint16_t i = 0; i < ARRAY_SIZE(gammaLut); ++i)
+    gammaLut[i] = 255 - i;
+
+  colorMngrGetGammaLut_fake.return_val = gammaLut;
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    led = expected + i * WS2812_ENC_SYMBOLS_PER_LED;
+    bitEncodeChannel(gammaLut[pixels[i].g], led);
+    bitEncodeChannel(gammaLut[pixels[i].r], led + 8);
+    bitEncodeChannel(gammaLut[pixels[i].b], led + 16);
+  }
+
+  ws2812EncEncode(pixels, TEST_PIXEL_COUNT, symbols);
+
+  zassert_equal(1, colorMngrGetGammaLut_fake.call_count,
+    "ws2812EncEncode failed to fetch the gamma table once.");
+  zassert_mem_equal(expected, symbols, sizeof(expected),
+    "ws2812EncEncode failed to encode the gamma corrected channels.");
+}
+#endif
+
+#ifdef CONFIG_LED_MNGR_POWER_LIMIT
+/**
+ * @test  ws2812EncEncode must encode the channels scaled by the power
+ *        limiter scale.
+*/
+ZTEST(ws2812Enc_suite, test_ws2812EncEncode_PowerScale)
+{
+  ZephyrRgbPixel_t pixels[TEST_PIXEL_COUNT] = {{.r = 0xff, .g = 0x00, .b = 0x81},
+                                               {.r = 0x5a, .g = 0xa5, .b = 0x0f},
+                                               {.r = 0x12, .g = 0xf0, .b = 0x3c}};
+  uint32_t symbols[TEST_PIXEL_COUNT * WS2812_ENC_WORDS_PER_LED];
+  uint8_t expected[TEST_PIXEL_COUNT * WS2812_ENC_SYMBOLS_PER_LED];
+  uint16_t scale = 100;
+  uint8_t *led;
+
+  for(uint8_t i = 0; i < TEST_PIXEL_COUNT; ++i)
+  {
+    led = expected + i * WS2812_ENC_SYMBOLS_PER_LED;
+    bitEncodeChannel(pixels[i].g * scale >> POWER_LIMITER_SCALE_SHIFT, led);
+    bitEncodeChannel(pixels[i].r * scale >> POWER_LIMITER_SCALE_SHIFT, led + 8);
+    bitEncodeChannel(pixels[i].b * scale >> POWER_LIMITER_SCALE_SHIFT, led + 16);
+  }
+
+  ws2812EncSetScale(scale);
+  ws2812EncEncode(pixels, TEST_PIXEL_COUNT, symbols);
+
+  zassert_mem_equal(expected, symbols, sizeof(expected),
+    "ws2812EncEncode failed to encode the scaled channels.");
+}
+#endif
+
+/** @} */